@@ -14,6 +14,14 @@ enum class EPrimitiveType : unsigned char
     EPT_Max,
 };
 
+/** 드로우에 사용할 셰이더 조합 (VS + PS + InputLayout) */
+enum class EShaderType : unsigned char
+{
+    EST_Simple,
+    EST_SphereImpostor,  // 인스턴스당 사각형 하나, 픽셀 셰이더에서 구 표면을 계산
+    EST_Max,
+};
+
 enum Direction
 {
     Left,
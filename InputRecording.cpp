@@ -0,0 +1,324 @@
+﻿#include "InputRecording.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+
+
+namespace
+{
+    constexpr uint8 Magic[4] = { 'I', 'N', 'R', 'C' };
+    constexpr uint32 Version = 1;
+
+    /** 모든 정수를 리틀 엔디언으로 쓰는 바이트 버퍼 */
+    class FByteWriter
+    {
+    public:
+        void WriteUInt8(uint8 Value) { Bytes.Add(Value); }
+
+        void WriteUInt32(uint32 Value)
+        {
+            for (int32 i = 0; i < 4; ++i)
+            {
+                Bytes.Add(static_cast<uint8>(Value >> (i * 8)));
+            }
+        }
+
+        void WriteFloat(float Value) { WriteUInt32(std::bit_cast<uint32>(Value)); }
+
+        /** 7비트씩 끊어서 위 비트가 남았으면 최상위 비트를 켬 */
+        void WriteVarint(uint64 Value)
+        {
+            while (Value >= 0x80)
+            {
+                Bytes.Add(static_cast<uint8>(Value | 0x80));
+                Value >>= 7;
+            }
+            Bytes.Add(static_cast<uint8>(Value));
+        }
+
+        /** 절댓값이 작은 음수도 짧게 쓰도록 부호를 최하위 비트로 옮김 */
+        void WriteSignedVarint(int64 Value)
+        {
+            WriteVarint((static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+        }
+
+        void WriteBytes(std::span<const uint8> Data) { Bytes.Append(Data); }
+
+        const TArray<uint8>& GetBytes() const { return Bytes; }
+
+    private:
+        TArray<uint8> Bytes;
+    };
+
+    /** 범위를 벗어나면 이후 읽기는 모두 0을 돌려주고 IsValid가 false가 됨 */
+    class FByteReader
+    {
+    public:
+        explicit FByteReader(std::span<const uint8> InBytes) : Bytes(InBytes) {}
+
+        uint8 ReadUInt8()
+        {
+            if (Offset >= Bytes.size())
+            {
+                bValid = false;
+                return 0;
+            }
+            return Bytes[Offset++];
+        }
+
+        uint32 ReadUInt32()
+        {
+            uint32 Value = 0;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                Value |= static_cast<uint32>(ReadUInt8()) << (i * 8);
+            }
+            return Value;
+        }
+
+        float ReadFloat() { return std::bit_cast<float>(ReadUInt32()); }
+
+        uint64 ReadVarint()
+        {
+            uint64 Value = 0;
+            for (int32 Shift = 0; Shift < 64; Shift += 7)
+            {
+                const uint8 Byte = ReadUInt8();
+                Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+                if ((Byte & 0x80) == 0)
+                {
+                    return Value;
+                }
+            }
+            bValid = false;
+            return 0;
+        }
+
+        int64 ReadSignedVarint()
+        {
+            const uint64 Value = ReadVarint();
+            return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+        }
+
+        std::span<const uint8> ReadBytes(size_t Size)
+        {
+            if (Size > Bytes.size() - Offset)
+            {
+                bValid = false;
+                Offset = Bytes.size();
+                return {};
+            }
+            const std::span<const uint8> Result = Bytes.subspan(Offset, Size);
+            Offset += Size;
+            return Result;
+        }
+
+        size_t GetRemaining() const { return Bytes.size() - Offset; }
+        bool IsValid() const { return bValid; }
+
+    private:
+        std::span<const uint8> Bytes;
+        size_t Offset = 0;
+        bool bValid = true;
+    };
+
+    bool HasPosition(EInputEventType Type)
+    {
+        return Type == EInputEventType::MouseDown || Type == EInputEventType::MouseUp || Type == EInputEventType::MouseMove;
+    }
+
+    bool HasViewSize(EInputEventType Type)
+    {
+        return Type == EInputEventType::MouseDown || Type == EInputEventType::MouseUp;
+    }
+}
+
+void FInputRecording::Reset(float InFrameTime, uint32 InRandomSeed)
+{
+    FrameTime = InFrameTime;
+    RandomSeed = InRandomSeed;
+    Events.Empty();
+    FrameStarts.Empty();
+    UserData.Empty();
+}
+
+void FInputRecording::BeginFrame()
+{
+    FrameStarts.Add(static_cast<uint32>(Events.Num()));
+}
+
+void FInputRecording::AddEvent(const FInputEvent& Event)
+{
+    // BeginFrame 전에 들어온 이벤트는 첫 프레임에 넣음
+    if (FrameStarts.Num() == 0)
+    {
+        BeginFrame();
+    }
+    Events.Add(Event);
+}
+
+std::span<const FInputEvent> FInputRecording::GetFrameEvents(uint32 FrameIndex) const
+{
+    if (FrameIndex >= NumFrames())
+    {
+        return {};
+    }
+
+    const uint32 First = FrameStarts[FrameIndex];
+    const uint32 Last = FrameIndex + 1 < NumFrames() ? FrameStarts[FrameIndex + 1] : NumEvents();
+    return { Events.GetData() + First, Last - First };
+}
+
+void FInputRecording::SetUserData(std::span<const uint8> Data)
+{
+    UserData.Empty();
+    UserData.Append(Data);
+}
+
+bool FInputRecording::Save(const std::filesystem::path& Path) const
+{
+    FByteWriter Writer;
+    Writer.WriteBytes(Magic);
+    Writer.WriteUInt32(Version);
+    Writer.WriteFloat(FrameTime);
+    Writer.WriteUInt32(RandomSeed);
+    Writer.WriteUInt32(NumFrames());
+    Writer.WriteUInt32(NumEvents());
+    Writer.WriteUInt32(static_cast<uint32>(UserData.Num()));
+    Writer.WriteBytes(GetUserData());
+
+    int64 LastMicroseconds = 0;
+    int32 LastX = 0;
+    int32 LastY = 0;
+    for (uint32 Frame = 0; Frame < NumFrames(); ++Frame)
+    {
+        const std::span<const FInputEvent> FrameEvents = GetFrameEvents(Frame);
+        Writer.WriteVarint(FrameEvents.size());
+
+        for (const FInputEvent& Event : FrameEvents)
+        {
+            Writer.WriteUInt8(static_cast<uint8>(Event.Type));
+            Writer.WriteUInt8(Event.Code);
+
+            // 여러 스레드에서 들어온 이벤트는 시각이 뒤바뀔 수 있어서 부호 있는 차이로 씀
+            const int64 Microseconds = std::llround(Event.Timestamp * 1.0e6);
+            Writer.WriteSignedVarint(Microseconds - LastMicroseconds);
+            LastMicroseconds = Microseconds;
+
+            if (HasPosition(Event.Type))
+            {
+                Writer.WriteSignedVarint(static_cast<int64>(Event.X) - LastX);
+                Writer.WriteSignedVarint(static_cast<int64>(Event.Y) - LastY);
+                LastX = Event.X;
+                LastY = Event.Y;
+            }
+            if (HasViewSize(Event.Type))
+            {
+                Writer.WriteVarint(Event.ViewWidth);
+                Writer.WriteVarint(Event.ViewHeight);
+            }
+        }
+    }
+
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    if (!File)
+    {
+        return false;
+    }
+
+    const TArray<uint8>& Bytes = Writer.GetBytes();
+    File.write(reinterpret_cast<const char*>(Bytes.GetData()), static_cast<std::streamsize>(Bytes.Num()));
+    return static_cast<bool>(File);
+}
+
+bool FInputRecording::Load(const std::filesystem::path& Path)
+{
+    Reset(1.0f / 60.0f, 0);
+
+    std::ifstream File(Path, std::ios::binary | std::ios::ate);
+    if (!File)
+    {
+        return false;
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(static_cast<size_t>(File.tellg()));
+    File.seekg(0);
+    if (!File.read(reinterpret_cast<char*>(Bytes.GetData()), static_cast<std::streamsize>(Bytes.Num())))
+    {
+        return false;
+    }
+
+    FByteReader Reader({ Bytes.GetData(), Bytes.Num() });
+    const std::span<const uint8> FileMagic = Reader.ReadBytes(sizeof(Magic));
+    if (!Reader.IsValid() || !std::equal(FileMagic.begin(), FileMagic.end(), Magic) || Reader.ReadUInt32() != Version)
+    {
+        return false;
+    }
+
+    const float InFrameTime = Reader.ReadFloat();
+    const uint32 InRandomSeed = Reader.ReadUInt32();
+    const uint32 InNumFrames = Reader.ReadUInt32();
+    const uint32 InNumEvents = Reader.ReadUInt32();
+    const std::span<const uint8> InUserData = Reader.ReadBytes(Reader.ReadUInt32());
+
+    // 프레임마다 최소 1바이트, 이벤트마다 최소 3바이트이므로 그보다 크다고 적힌 파일은 미리 거름
+    if (!Reader.IsValid() || InNumFrames > Reader.GetRemaining() || InNumEvents > Reader.GetRemaining() / 3)
+    {
+        return false;
+    }
+
+    FrameTime = InFrameTime;
+    RandomSeed = InRandomSeed;
+    SetUserData(InUserData);
+    FrameStarts.Reserve(InNumFrames);
+    Events.Reserve(InNumEvents);
+
+    int64 Microseconds = 0;
+    int32 X = 0;
+    int32 Y = 0;
+    for (uint32 Frame = 0; Frame < InNumFrames && Reader.IsValid(); ++Frame)
+    {
+        BeginFrame();
+
+        const uint64 NumFrameEvents = Reader.ReadVarint();
+        for (uint64 i = 0; i < NumFrameEvents && Reader.IsValid(); ++i)
+        {
+            FInputEvent Event;
+            Event.Type = static_cast<EInputEventType>(Reader.ReadUInt8());
+            Event.Code = Reader.ReadUInt8();
+            if (Event.Type > EInputEventType::MouseMove)
+            {
+                Reset(1.0f / 60.0f, 0);
+                return false;
+            }
+
+            Microseconds += Reader.ReadSignedVarint();
+            Event.Timestamp = static_cast<double>(Microseconds) * 1.0e-6;
+
+            if (HasPosition(Event.Type))
+            {
+                X += static_cast<int32>(Reader.ReadSignedVarint());
+                Y += static_cast<int32>(Reader.ReadSignedVarint());
+                Event.X = X;
+                Event.Y = Y;
+            }
+            if (HasViewSize(Event.Type))
+            {
+                Event.ViewWidth = static_cast<uint16>(Reader.ReadVarint());
+                Event.ViewHeight = static_cast<uint16>(Reader.ReadVarint());
+            }
+            Events.Add(Event);
+        }
+    }
+
+    // 뒤에 남는 바이트가 있으면 프레임 수나 이벤트 수가 어긋난 파일
+    if (!Reader.IsValid() || NumEvents() != InNumEvents || Reader.GetRemaining() != 0)
+    {
+        Reset(1.0f / 60.0f, 0);
+        return false;
+    }
+    return true;
+}
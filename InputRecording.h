@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "InputSystem.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 프레임별 입력 이벤트 녹화
+ *
+ * InputSystem::ProcessEvents가 꺼낸 이벤트를 프레임 단위로 모아 두었다가 파일로 저장하고,
+ * 재생할 때는 같은 프레임 번호에 같은 이벤트를 다시 넣는다. 마우스 이동도 이벤트이므로
+ * 카메라 회전에 쓰이는 이동량까지 그대로 재현된다.
+ * 재생은 FrameTime 고정 스텝으로 돌려야 하고, 시뮬레이션은 RandomSeed로 Reset해서 맞춘다.
+ *
+ * 파일은 헤더 뒤에 프레임마다 이벤트 수와 이벤트를 varint로 담는다.
+ * 시각은 직전 이벤트와의 차이(마이크로초), 마우스 좌표는 직전 좌표와의 차이라서 대부분 1~3바이트로 끝난다.
+ */
+class FInputRecording
+{
+public:
+    /** 녹화를 새로 시작, 지금까지 담긴 프레임과 추가 데이터는 지워짐 */
+    void Reset(float InFrameTime, uint32 InRandomSeed);
+
+    /** 새 프레임을 시작, 이후 AddEvent는 이 프레임에 들어감 */
+    void BeginFrame();
+
+    void AddEvent(const FInputEvent& Event);
+
+    bool Save(const std::filesystem::path& Path) const;
+
+    /** 파일이 없거나 형식이 맞지 않으면 false, 이때 내용은 비어 있음 */
+    bool Load(const std::filesystem::path& Path);
+
+    uint32 NumFrames() const { return static_cast<uint32>(FrameStarts.Num()); }
+    uint32 NumEvents() const { return static_cast<uint32>(Events.Num()); }
+
+    std::span<const FInputEvent> GetFrameEvents(uint32 FrameIndex) const;
+
+    float GetFrameTime() const { return FrameTime; }
+    uint32 GetRandomSeed() const { return RandomSeed; }
+
+    /** 재생 조건을 맞추는 데 필요한 추가 데이터 (시뮬레이션 설정 등), 내용은 쓰는 쪽이 정함 */
+    void SetUserData(std::span<const uint8> Data);
+    std::span<const uint8> GetUserData() const { return { UserData.GetData(), UserData.Num() }; }
+
+private:
+    float FrameTime = 1.0f / 60.0f;
+    uint32 RandomSeed = 0;
+
+    TArray<FInputEvent> Events;
+    TArray<uint32> FrameStarts;    // 프레임마다 첫 이벤트의 Events 인덱스
+    TArray<uint8> UserData;
+};
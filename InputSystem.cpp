@@ -1,65 +1,176 @@
 ﻿#include "InputSystem.h"
 
 #include "Enum.h"
+#include "InputRecording.h"
 #include "UCamera.h"
+#include "Core/Container/Map.h"
+#include "Core/Time/Clock.h"
 
 InputSystem::InputSystem()
 {
-    for (bool& key : _keys)
-    {
-        key = false;
-    }
+}
 
-    for (bool& m : mouse)
-    {
-        m=false;
-    }
+double InputSystem::GetTime() const
+{
+    return Clock ? Clock->GetSeconds() : 0.0;
 }
 
-bool InputSystem::IsPressedKey(EKeyCode key) const
+bool InputSystem::PushEvent(const FInputEvent& Event)
 {
-    return _keys[static_cast<uint8_t>(key)];
+    if (!EventQueue.Push(Event))
+    {
+        NumDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
 }
 
 void InputSystem::KeyDown(EKeyCode key)
 {
-    _keys[static_cast<uint8_t>(key)] = true;
+    FInputEvent Event;
+    Event.Timestamp = GetTime();
+    Event.Type = EInputEventType::KeyDown;
+    Event.Code = static_cast<uint8>(key);
+    PushEvent(Event);
 }
 
 void InputSystem::KeyUp(EKeyCode key)
 {
-    _keys[static_cast<uint8_t>(key)] = false;
+    FInputEvent Event;
+    Event.Timestamp = GetTime();
+    Event.Type = EInputEventType::KeyUp;
+    Event.Code = static_cast<uint8>(key);
+    PushEvent(Event);
+}
+
+void InputSystem::MouseKeyDown(FVector MouseDownPoint, FVector WindowSize, int isRight) {
+    FInputEvent Event;
+    Event.Timestamp = GetTime();
+    Event.Type = EInputEventType::MouseDown;
+    Event.Code = static_cast<uint8>(isRight != 0);
+    Event.X = static_cast<int32>(MouseDownPoint.X);
+    Event.Y = static_cast<int32>(MouseDownPoint.Y);
+    Event.ViewWidth = static_cast<uint16>(WindowSize.X);
+    Event.ViewHeight = static_cast<uint16>(WindowSize.Y);
+    PushEvent(Event);
 }
 
-std::vector<EKeyCode> InputSystem::GetPressedKeys() {
-    std::vector<EKeyCode> ret;
+void InputSystem::MouseKeyUp(FVector MouseUpPoint, FVector WindowSize, int isRight) {
+    FInputEvent Event;
+    Event.Timestamp = GetTime();
+    Event.Type = EInputEventType::MouseUp;
+    Event.Code = static_cast<uint8>(isRight != 0);
+    Event.X = static_cast<int32>(MouseUpPoint.X);
+    Event.Y = static_cast<int32>(MouseUpPoint.Y);
+    Event.ViewWidth = static_cast<uint16>(WindowSize.X);
+    Event.ViewHeight = static_cast<uint16>(WindowSize.Y);
+    PushEvent(Event);
+}
+
+void InputSystem::MouseMove(FVector MousePoint)
+{
+    FInputEvent Event;
+    Event.Timestamp = GetTime();
+    Event.Type = EInputEventType::MouseMove;
+    Event.X = static_cast<int32>(MousePoint.X);
+    Event.Y = static_cast<int32>(MousePoint.Y);
+    PushEvent(Event);
+}
+
+void InputSystem::ProcessEvents()
+{
+    // 클릭은 이번 프레임 것만 남기고, 눌림/뗌과 이동량은 지난 프레임 상태 기준
+    Snapshot.PreviousKeys = Snapshot.Keys;
+    Snapshot.PreviousMouseButtons = Snapshot.MouseButtons;
+    Snapshot.MouseClicked.Reset();
+    Snapshot.MousePrePos = Snapshot.MousePos;
+    Snapshot.Time = GetTime();
+    Snapshot.NumEvents = 0;
+
+    if (Recording)
+    {
+        Recording->BeginFrame();
+    }
+
+    FInputEvent Event;
+    while (EventQueue.Pop(Event))
+    {
+        if (Replay)
+        {
+            continue;
+        }
 
-    for (int i = 0; i < 256; i++) {
-        if (_keys[ i ]) {
-            ret.push_back(static_cast< EKeyCode >( i ));
+        ApplyEvent(Event);
+        ++Snapshot.NumEvents;
+        if (Recording)
+        {
+            Recording->AddEvent(Event);
         }
     }
 
-    return ret;
+    if (Replay && ReplayFrame < Replay->NumFrames())
+    {
+        for (const FInputEvent& ReplayEvent : Replay->GetFrameEvents(ReplayFrame))
+        {
+            ApplyEvent(ReplayEvent);
+            ++Snapshot.NumEvents;
+        }
+        ++ReplayFrame;
+    }
 }
-void InputSystem::MouseKeyDown(FVector MouseDownPoint, FVector WindowSize, int isRight) {
-    mouse[isRight] = true;
-    onceMouse[isRight] = true;
-    MouseKeyDownPos[isRight] = MouseDownPoint;
-    MouseKeyDownNDCPos[isRight] = CalNDCPos(MouseKeyDownPos[isRight], WindowSize);
-} //MouseKeyDownPos 설정
 
-void InputSystem::MouseKeyUp(FVector MouseUpPoint, FVector WindowSize, int isRight) {
-    mouse[isRight] = false;
-    onceMouse[isRight] = false;
+void InputSystem::StartRecording(FInputRecording* InRecording)
+{
+    Recording = InRecording;
+    if (Recording)
+    {
+        Snapshot = FInputSnapshot();
+    }
+}
+
+void InputSystem::StartReplay(const FInputRecording* InReplay)
+{
+    Replay = InReplay;
+    ReplayFrame = 0;
+    if (Replay)
+    {
+        Snapshot = FInputSnapshot();
+    }
+}
+
+bool InputSystem::IsReplayFinished() const
+{
+    return Replay && ReplayFrame >= Replay->NumFrames();
 }
 
-void InputSystem::ExpireOnceMouse()
+void InputSystem::ApplyEvent(const FInputEvent& Event)
 {
-    for (bool& i : onceMouse)
+    switch (Event.Type)
+    {
+    case EInputEventType::KeyDown:
+        Snapshot.Keys.Set(Event.Code);
+        break;
+    case EInputEventType::KeyUp:
+        Snapshot.Keys.Clear(Event.Code);
+        break;
+    case EInputEventType::MouseDown:
     {
-        i = false;
-    }  
+        const uint32 Button = Event.Code != 0;
+        const FVector Position(static_cast<float>(Event.X), static_cast<float>(Event.Y), 0);
+        Snapshot.MouseButtons.Set(Button);
+        Snapshot.MouseClicked.Set(Button);
+        Snapshot.MouseDownPos[Button] = Position;
+        Snapshot.MouseDownNDCPos[Button] = CalNDCPos(Position, FVector(Event.ViewWidth, Event.ViewHeight, 0));
+        break;
+    }
+    case EInputEventType::MouseUp:
+        // 같은 프레임에 눌렀다 떼도 MouseClicked는 남김
+        Snapshot.MouseButtons.Clear(Event.Code != 0);
+        break;
+    case EInputEventType::MouseMove:
+        Snapshot.MousePos = FVector(static_cast<float>(Event.X), static_cast<float>(Event.Y), 0);
+        break;
+    }
 }
 
 FVector InputSystem::CalNDCPos(FVector MousePos, FVector WindowSize)
@@ -67,20 +178,10 @@ FVector InputSystem::CalNDCPos(FVector MousePos, FVector WindowSize)
     return {( MousePos.X / ( WindowSize.X / 2 ) ) - 1, ( MousePos.Y / ( WindowSize.Y / 2 ) ) - 1, 0};
 }
 
-#include <unordered_map>
 #include <utility>
 #include <cmath>
 
-struct pair_hash {
-    template <class T1, class T2>
-    std::size_t operator () (std::pair<T1, T2> const& v) const {
-        auto h1 = std::hash<T1>{}( v.first );
-        auto h2 = std::hash<T2>{}( v.second );
-        return h1 ^ h2;
-    }
-};
-
-std::unordered_map<Direction, FVector> DicKeyAddVector //speed는 곱해서 쓰자
+TMap<Direction, FVector> DicKeyAddVector //speed는 곱해서 쓰자
 {
     {Left, FVector(-10, 0, 0)},
     {Right, FVector(10, 0, 0)},
@@ -1,11 +1,17 @@
 ﻿#pragma once
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include "Core/AbstractClass/Singleton.h"
+#include "Core/Async/MpscQueue.h"
+#include "Core/Container/StaticBitArray.h"
 #include "Core/Math/Vector.h"
 
+class IClock;
+class FInputRecording;
+
 /**
  * 윈도우 키 코드 열거형
  * @note https://learn.microsoft.com/en-us/windows/win32/inputdev/virtual-key-codes
@@ -121,67 +127,183 @@ enum class EKeyCode : uint8_t
     RAlt = 0xA5,
 };
 
+/** InputSystem에 쌓이는 입력 이벤트 종류 */
+enum class EInputEventType : uint8
+{
+    KeyDown,
+    KeyUp,
+    MouseDown,
+    MouseUp,
+    MouseMove,
+};
+
+/** WndProc 등에서 만들어 InputSystem::PushEvent로 넣는 입력 이벤트 */
+struct FInputEvent
+{
+    double Timestamp = 0.0;     // 초, InputSystem에 설정한 시계 기준
+    int32 X = 0;                // 마우스 위치 (픽셀)
+    int32 Y = 0;
+    uint16 ViewWidth = 0;       // 마우스 버튼 이벤트의 NDC 좌표 계산에 쓰는 창 크기
+    uint16 ViewHeight = 0;
+    EInputEventType Type = EInputEventType::KeyDown;
+    uint8 Code = 0;             // 키 이벤트는 EKeyCode, 마우스 버튼 이벤트는 0이 좌클릭 1이 우클릭
+};
+
+/** 키 코드마다 한 비트 */
+using FKeyMask = TStaticBitArray<256>;
+
+/** 마우스 버튼마다 한 비트, 0이 좌클릭 1이 우클릭 */
+using FMouseButtonMask = TStaticBitArray<2>;
+
+/**
+ * 한 프레임 동안 바뀌지 않는 입력 상태, InputSystem::ProcessEvents가 새로 만든다.
+ * 지난 프레임 상태도 함께 들고 있어서 눌림/뗌 판정은 두 마스크의 비트 연산이다.
+ * 다른 스레드에서 입력을 봐야 하면 이 구조체를 값으로 복사해서 넘길 것
+ */
+struct FInputSnapshot
+{
+    FKeyMask Keys;
+    FKeyMask PreviousKeys;
+    FMouseButtonMask MouseButtons;
+    FMouseButtonMask PreviousMouseButtons;
+    FMouseButtonMask MouseClicked;  // 이번 프레임에 눌린 적이 있음, 같은 프레임에 떼어도 남음
+    FVector MouseDownPos[2];
+    FVector MouseDownNDCPos[2];
+    FVector MousePrePos;        // 지난 프레임의 MousePos
+    FVector MousePos;
+    double Time = 0.0;          // ProcessEvents를 부른 시각
+    uint32 NumEvents = 0;       // 이번 프레임에 처리한 이벤트 수
+};
+
+/**
+ * 입력 상태
+ *
+ * 입력은 이벤트로 큐에 쌓였다가 프레임 시작에 ProcessEvents에서 한꺼번에 적용된다.
+ * 이벤트는 아무 스레드에서나 넣을 수 있고, 상태는 ProcessEvents를 부르는 스레드에서만 읽는다.
+ */
 class InputSystem : public TSingleton<InputSystem>
 {
 public:
     InputSystem();
 
+    /** 이벤트 시각을 잴 시계, 설정하지 않으면 0으로 찍힘 */
+    void SetClock(const IClock* InClock) { Clock = InClock; }
+    double GetTime() const;
+
     /**
-     * 키를 눌림 상태로 전환합니다. 
+     * 이벤트를 큐에 넣습니다. 아무 스레드에서나 호출할 수 있으며, 상태는 다음 ProcessEvents에서 바뀜
+     * @return 큐가 가득 차서 버려졌으면 false
+     */
+    bool PushEvent(const FInputEvent& Event);
+
+    /**
+     * 키 눌림 이벤트를 현재 시각으로 넣습니다.
      */
     void KeyDown(EKeyCode key);
 
     /**
-     * 키를 눌리지 않은 상태로 전환합니다.
+     * 키 뗌 이벤트를 현재 시각으로 넣습니다.
      */
     void KeyUp(EKeyCode key);
 
+    void MouseKeyDown(FVector MouseDownPoint, FVector WindowSize, int isRight);
+
+    void MouseKeyUp(FVector MouseUpPoint, FVector WindowSize, int isRight);
+
+    void MouseMove(FVector MousePoint);
+
+    /** 프레임 시작에 한 번 호출, 쌓인 이벤트를 순서대로 적용해서 새 스냅샷을 만듦 */
+    void ProcessEvents();
 
-    std::vector<EKeyCode> GetPressedKeys();
+    /**
+     * ProcessEvents마다 한 프레임씩 Recording에 적용한 이벤트를 담음, nullptr이면 녹화 중지
+     * 재생과 같은 상태에서 시작하도록 눌린 키와 마우스 상태를 비움
+     */
+    void StartRecording(FInputRecording* InRecording);
+
+    /**
+     * ProcessEvents마다 큐 대신 Replay의 다음 프레임 이벤트를 적용, nullptr이면 재생 중지
+     * 눌린 키와 마우스 상태를 비우고 시작하며, 재생하는 동안 큐에 들어온 이벤트는 버림
+     */
+    void StartReplay(const FInputRecording* InReplay);
+
+    bool IsReplaying() const { return Replay != nullptr; }
+
+    /** 재생 중 다음에 적용할 프레임 번호, 녹화 프레임 수와 같아지면 재생이 끝난 것 */
+    uint32 GetReplayFrame() const { return ReplayFrame; }
+    bool IsReplayFinished() const;
+
+    const FInputSnapshot& GetSnapshot() const { return Snapshot; }
+
+    /** 큐가 가득 차서 버린 이벤트 수 */
+    uint64 GetNumDroppedEvents() const { return NumDroppedEvents.load(std::memory_order_relaxed); }
+
+    /** 눌린 키 마스크, 범위 for로 눌린 키 코드를 순회 */
+    const FKeyMask& GetPressedKeys() const { return Snapshot.Keys; }
+
+    /** 이번 프레임에 새로 눌린 키 */
+    FKeyMask GetJustPressedKeys() const { return Snapshot.Keys.AndNot(Snapshot.PreviousKeys); }
+
+    /** 이번 프레임에 떼어진 키 */
+    FKeyMask GetJustReleasedKeys() const { return Snapshot.PreviousKeys.AndNot(Snapshot.Keys); }
 
     /**
      * 키가 눌려있는지 확인합니다.
      * @param key 감지 할 키
      * @return key의 눌림 여부
      */
-    [[nodiscard]] bool IsPressedKey(EKeyCode key) const;
+    [[nodiscard]] bool IsPressedKey(EKeyCode key) const { return Snapshot.Keys.Test(static_cast<uint8>(key)); }
 
-    void MouseKeyDown(FVector MouseDownPoint, FVector WindowSize, int isRight);
+    /**
+     * 지난 프레임에는 떼어져 있다가 이번 프레임에 눌려 있는지 확인합니다.
+     * 한 프레임 안에서 눌렀다 뗀 키는 잡지 못함
+     */
+    [[nodiscard]] bool WasKeyJustPressed(EKeyCode key) const
+    {
+        const uint8 Index = static_cast<uint8>(key);
+        return Snapshot.Keys.Test(Index) && !Snapshot.PreviousKeys.Test(Index);
+    }
 
-    void MouseKeyUp(FVector MouseUpPoint, FVector WindowSize, int isRight);
+    /** 지난 프레임에는 눌려 있다가 이번 프레임에 떼어졌는지 확인합니다. */
+    [[nodiscard]] bool WasKeyJustReleased(EKeyCode key) const
+    {
+        const uint8 Index = static_cast<uint8>(key);
+        return !Snapshot.Keys.Test(Index) && Snapshot.PreviousKeys.Test(Index);
+    }
 
-    void ExpireOnceMouse();
+    bool IsPressedMouse(bool isRight) const { return Snapshot.MouseButtons.Test(isRight); }
 
-    bool IsPressedMouse(bool isRight) { return mouse[isRight]; }
+    /** 이번 프레임에 눌린 적이 있는지, 같은 프레임에 떼었어도 true */
+    bool GetMouseDown(bool isRight) const { return Snapshot.MouseClicked.Test(isRight); }
 
-    bool GetMouseDown(bool isRight) { return onceMouse[isRight]; }
+    bool WasMouseJustReleased(bool isRight) const { return !Snapshot.MouseButtons.Test(isRight) && Snapshot.PreviousMouseButtons.Test(isRight); }
 
-    FVector GetMouseDownPos(int isRight) { return MouseKeyDownPos[isRight]; }
+    FVector GetMouseDownPos(int isRight) { return Snapshot.MouseDownPos[isRight]; }
 
-    FVector GetMouseDownNDCPos(int isRight) { return MouseKeyDownNDCPos[isRight]; }
+    FVector GetMouseDownNDCPos(int isRight) { return Snapshot.MouseDownNDCPos[isRight]; }
 
-    FVector GetMousePos() { return MousePos;}
-    FVector GetMouseNDCPos() { return MouseNDCPos;}
-    FVector GetMousePrePos() { return MousePrePos;}
+    FVector GetMousePos() { return Snapshot.MousePos;}
+    FVector GetMousePrePos() { return Snapshot.MousePrePos;}
     
     FVector CalNDCPos(FVector MousePos, FVector WindowSize);
 
-    void SetMousePrePos(FVector PMP) { MousePrePos = PMP;}
-    void SetMousePos(FVector MP){ SetMousePrePos(MousePos); MousePos = MP;}
-    void SetMouseNDCPos(FVector MNP) {MouseNDCPos = MNP;}
+private:
+    /** 스냅샷에 이벤트 하나를 적용 */
+    void ApplyEvent(const FInputEvent& Event);
 
 private:
     // std::unordered_map<EKeyCode, std::unordered_set<void()>> InputHandlers; //인풋핸들러 각 오브젝트에서 키에 해당하는 함수를 할당한 다음 업데이트에서 눌린 키에 해당하는 함수 계속 돌려줘서 실행 
 
-    bool mouse[2]; //0이 좌클릭 1이 우클릭
-    bool onceMouse[2];
-    bool _keys[256];
+    TMpscQueue<FInputEvent, 1024> EventQueue;
+    std::atomic<uint64> NumDroppedEvents = 0;
+    const IClock* Clock = nullptr;
+
+    FInputRecording* Recording = nullptr;
+    const FInputRecording* Replay = nullptr;
+    uint32 ReplayFrame = 0;
+
+    FInputSnapshot Snapshot;
     bool bIsBlockInput = false;
-    FVector MouseKeyDownPos[2];
-    FVector MouseKeyDownNDCPos[2];
-    FVector MousePrePos;
-    FVector MousePos;
-    FVector MouseNDCPos;
 };
 
 class InputHandler {
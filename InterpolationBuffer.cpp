@@ -0,0 +1,88 @@
+﻿#include "InterpolationBuffer.h"
+
+#include <algorithm>
+
+#include "UObject.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define INTERPOLATION_USE_SSE 1
+#else
+#define INTERPOLATION_USE_SSE 0
+#endif
+
+void FInterpolationBuffer::Resize(uint32 InNum)
+{
+    Count = InNum;
+    Stride = (InNum + 3) & ~3u;
+    Data.resize(static_cast<size_t>(Stride) * ChannelCount * 2);
+}
+
+void FInterpolationBuffer::SetPrevious(uint32 Index, const FVector& Location, const FVector& Rotation)
+{
+    SetState(false, Index, Location, Rotation);
+}
+
+void FInterpolationBuffer::SetCurrent(uint32 Index, const FVector& Location, const FVector& Rotation)
+{
+    SetState(true, Index, Location, Rotation);
+}
+
+void FInterpolationBuffer::SetState(bool bCurrent, uint32 Index, const FVector& Location, const FVector& Rotation)
+{
+    GetChannel(bCurrent, LocationX)[Index] = Location.X;
+    GetChannel(bCurrent, LocationY)[Index] = Location.Y;
+    GetChannel(bCurrent, LocationZ)[Index] = Location.Z;
+    GetChannel(bCurrent, RotationX)[Index] = Rotation.X;
+    GetChannel(bCurrent, RotationY)[Index] = Rotation.Y;
+    GetChannel(bCurrent, RotationZ)[Index] = Rotation.Z;
+}
+
+void FInterpolationBuffer::Interpolate(float Alpha, FObjectRenderState* OutStates) const
+{
+    // 스택에 들어가는 크기로 잘라서 채널별로 보간한 뒤 AoS로 흩뿌림
+    constexpr uint32 BlockSize = 256;
+    float Block[ChannelCount][BlockSize];
+
+    for (uint32 Begin = 0; Begin < Count; Begin += BlockSize)
+    {
+        const uint32 Num = std::min(BlockSize, Count - Begin);
+        for (uint32 Channel = 0; Channel < ChannelCount; ++Channel)
+        {
+            Lerp(
+                GetChannel(false, static_cast<EChannel>(Channel)) + Begin,
+                GetChannel(true, static_cast<EChannel>(Channel)) + Begin,
+                Alpha, Block[Channel], Num
+            );
+        }
+
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            FObjectRenderState& State = OutStates[Begin + i];
+            State.Location = FVector(Block[LocationX][i], Block[LocationY][i], Block[LocationZ][i]);
+            State.Rotation = FVector(Block[RotationX][i], Block[RotationY][i], Block[RotationZ][i]);
+        }
+    }
+}
+
+void FInterpolationBuffer::Lerp(const float* A, const float* B, float Alpha, float* Out, uint32 Num)
+{
+    uint32 i = 0;
+
+#if INTERPOLATION_USE_SSE
+    const __m128 AlphaV = _mm_set1_ps(Alpha);
+    const __m128 InvAlphaV = _mm_set1_ps(1.0f - Alpha);
+    for (; i + 4 <= Num; i += 4)
+    {
+        const __m128 AV = _mm_loadu_ps(A + i);
+        const __m128 BV = _mm_loadu_ps(B + i);
+        _mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(AV, InvAlphaV), _mm_mul_ps(BV, AlphaV)));
+    }
+#endif
+
+    const float InvAlpha = 1.0f - Alpha;
+    for (; i < Num; ++i)
+    {
+        Out[i] = A[i] * InvAlpha + B[i] * Alpha;
+    }
+}
@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/Vector.h"
+
+struct FObjectRenderState;
+
+/**
+ * 고정 스텝 사이를 보간하기 위한 이전/현재 상태 버퍼
+ * 채널(Location.X, Location.Y, ...)마다 연속된 float 배열로 저장하는 SoA 레이아웃이라
+ * 보간은 채널 단위로 SIMD Lerp 한 번씩만 돌면 된다.
+ */
+class FInterpolationBuffer
+{
+public:
+    enum EChannel : uint32
+    {
+        LocationX,
+        LocationY,
+        LocationZ,
+        RotationX,
+        RotationY,
+        RotationZ,
+        ChannelCount
+    };
+
+    /** 오브젝트 수를 바꿉니다. 기존 값은 보존되지 않습니다. */
+    void Resize(uint32 InNum);
+    uint32 Num() const { return Count; }
+
+    void SetPrevious(uint32 Index, const FVector& Location, const FVector& Rotation);
+    void SetCurrent(uint32 Index, const FVector& Location, const FVector& Rotation);
+
+    /**
+     * 이전 상태와 현재 상태 사이를 보간해서 OutStates의 Location, Rotation에 씁니다.
+     * @param Alpha 0이면 이전 상태, 1이면 현재 상태
+     * @param OutStates Num() 크기의 배열, Location/Rotation 이외의 값은 건드리지 않음
+     */
+    void Interpolate(float Alpha, FObjectRenderState* OutStates) const;
+
+    /**
+     * Out[i] = A[i] * (1 - Alpha) + B[i] * Alpha, 가능하면 SIMD로 4개씩 처리
+     * A + (B - A) * Alpha와 달리 Alpha가 0, 1이면 A, B가 그대로 나온다.
+     */
+    static void Lerp(const float* A, const float* B, float Alpha, float* Out, uint32 Num);
+
+private:
+    float* GetChannel(bool bCurrent, EChannel Channel) { return Data.data() + ((bCurrent ? static_cast<uint32>(ChannelCount) : 0u) + Channel) * Stride; }
+    const float* GetChannel(bool bCurrent, EChannel Channel) const { return Data.data() + ((bCurrent ? static_cast<uint32>(ChannelCount) : 0u) + Channel) * Stride; }
+
+    void SetState(bool bCurrent, uint32 Index, const FVector& Location, const FVector& Rotation);
+
+private:
+    std::vector<float> Data;  // [이전 채널들][현재 채널들], 채널마다 Stride 개
+    uint32 Count = 0;
+    uint32 Stride = 0;        // 4의 배수로 올림한 Count
+};
@@ -0,0 +1,244 @@
+﻿#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define OCCLUSION_USE_SSE 1
+#else
+#define OCCLUSION_USE_SSE 0
+#endif
+
+FOcclusionCuller::FOcclusionCuller()
+{
+    SetResolution(256, 256);
+    SetProjection(3.14159265f / 4.0f, 1.0f, 0.1f);
+}
+
+void FOcclusionCuller::SetResolution(int InWidth, int InHeight)
+{
+    Width = std::max(4, (InWidth + 3) & ~3);
+    Height = std::max(1, InHeight);
+
+    Levels.clear();
+    int LevelWidth = Width;
+    int LevelHeight = Height;
+    while (true)
+    {
+        Levels.push_back({LevelWidth, LevelHeight, std::vector<float>(static_cast<size_t>(LevelWidth) * LevelHeight, FLT_MAX)});
+        if (LevelWidth == 1 && LevelHeight == 1)
+        {
+            break;
+        }
+        LevelWidth = std::max(1, (LevelWidth + 1) / 2);
+        LevelHeight = std::max(1, (LevelHeight + 1) / 2);
+    }
+}
+
+void FOcclusionCuller::SetProjection(float FovY, float AspectRatio, float InNearZ)
+{
+    const float TanHalfFov = std::tan(FovY * 0.5f);
+    ProjScaleY = 1.0f / TanHalfFov;
+    ProjScaleX = ProjScaleY / AspectRatio;
+    NearZ = InNearZ;
+}
+
+float FOcclusionCuller::GetDepth(int Level, int X, int Y) const
+{
+    const FDepthLevel& L = Levels[Level];
+    return L.Depth[static_cast<size_t>(Y) * L.Width + X];
+}
+
+FOcclusionStats FOcclusionCuller::Cull(const FOcclusionSphere* Spheres, uint32 Count, uint8* OutVisible)
+{
+    FOcclusionStats Stats;
+    Stats.NumTested = Count;
+
+    ClearDepth();
+
+    // 가까우면서 화면에서 크게 보이는 구를 오클루더로 선택
+    OccluderCandidates.clear();
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const FOcclusionSphere& S = Spheres[i];
+        if (S.OccluderRadius > 0.0f && S.Z - S.OccluderRadius > NearZ)
+        {
+            OccluderCandidates.push_back(i);
+        }
+    }
+
+    auto ScreenSize = [Spheres](uint32 Index) { return Spheres[Index].OccluderRadius / Spheres[Index].Z; };
+    if (OccluderCandidates.size() > static_cast<size_t>(MaxOccluders))
+    {
+        std::nth_element(OccluderCandidates.begin(), OccluderCandidates.begin() + MaxOccluders, OccluderCandidates.end(),
+            [&ScreenSize](uint32 A, uint32 B) { return ScreenSize(A) > ScreenSize(B); });
+        OccluderCandidates.resize(MaxOccluders);
+    }
+
+    for (const uint32 Index : OccluderCandidates)
+    {
+        RasterizeOccluder(Spheres[Index]);
+    }
+    Stats.NumOccluders = static_cast<uint32>(OccluderCandidates.size());
+
+    BuildHiZ();
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        const bool bOccluded = Stats.NumOccluders > 0 && IsOccluded(Spheres[i]);
+        OutVisible[i] = bOccluded ? 0 : 1;
+        Stats.NumCulled += bOccluded ? 1 : 0;
+    }
+
+    return Stats;
+}
+
+void FOcclusionCuller::ClearDepth()
+{
+    std::vector<float>& Depth = Levels[0].Depth;
+    std::fill(Depth.begin(), Depth.end(), FLT_MAX);
+}
+
+FOcclusionCuller::FScreenRect FOcclusionCuller::ProjectSphere(const FOcclusionSphere& Sphere, float Radius, float Depth) const
+{
+    const float InvZ = 1.0f / Sphere.Z;
+    const float CenterX = (Sphere.X * ProjScaleX * InvZ * 0.5f + 0.5f) * static_cast<float>(Width);
+    const float CenterY = (0.5f - Sphere.Y * ProjScaleY * InvZ * 0.5f) * static_cast<float>(Height);
+    const float HalfX = Radius * ProjScaleX / Depth * 0.5f * static_cast<float>(Width);
+    const float HalfY = Radius * ProjScaleY / Depth * 0.5f * static_cast<float>(Height);
+    return {CenterX - HalfX, CenterY - HalfY, CenterX + HalfX, CenterY + HalfY};
+}
+
+void FOcclusionCuller::RasterizeOccluder(const FOcclusionSphere& Sphere)
+{
+    // 화면 중심에서 r/Z 안쪽의 원은 항상 구의 실루엣 안에 있고,
+    // 그 안의 앞면 깊이는 모두 중심 Z보다 가까우므로 중심 Z를 쓰면 보수적인 오클루더가 된다.
+    // Hi-Z는 텍셀 전체가 가려졌다고 보므로, 텍셀 중심이 아니라 텍셀 전체가 원 안에 들어갈 때만 쓴다.
+    const FScreenRect Rect = ProjectSphere(Sphere, Sphere.OccluderRadius, Sphere.Z);
+    const float CenterX = (Rect.MinX + Rect.MaxX) * 0.5f;
+    const float CenterY = (Rect.MinY + Rect.MaxY) * 0.5f;
+    const float RadiusX = (Rect.MaxX - Rect.MinX) * 0.5f;
+    const float RadiusY = (Rect.MaxY - Rect.MinY) * 0.5f;
+    if (RadiusX < 0.5f || RadiusY < 0.5f)
+    {
+        return;
+    }
+
+    const int MinY = std::max(0, static_cast<int>(std::ceil(Rect.MinY)));
+    const int MaxY = std::min(Height - 1, static_cast<int>(std::floor(Rect.MaxY)) - 1);
+
+    std::vector<float>& Depth = Levels[0].Depth;
+    const float Z = Sphere.Z;
+#if OCCLUSION_USE_SSE
+    const __m128 Z4 = _mm_set1_ps(Z);
+#endif
+
+    for (int y = MinY; y <= MaxY; ++y)
+    {
+        // 원이 볼록하므로 중심에서 먼 쪽 가장자리의 가로 폭 안에 네 모서리가 들어가면 텍셀 전체가 원 안
+        const float EdgeY = std::max(std::fabs(static_cast<float>(y) - CenterY), std::fabs(static_cast<float>(y + 1) - CenterY));
+        const float Dy = EdgeY / RadiusY;
+        const float Span = 1.0f - Dy * Dy;
+        if (Span <= 0.0f)
+        {
+            continue;
+        }
+
+        const float HalfWidth = RadiusX * std::sqrt(Span);
+        const int X0 = std::max(0, static_cast<int>(std::ceil(CenterX - HalfWidth)));
+        const int X1 = std::min(Width - 1, static_cast<int>(std::floor(CenterX + HalfWidth)) - 1);
+
+        float* Row = Depth.data() + static_cast<size_t>(y) * Width;
+        int x = X0;
+#if OCCLUSION_USE_SSE
+        for (; x + 4 <= X1 + 1; x += 4)
+        {
+            _mm_storeu_ps(Row + x, _mm_min_ps(_mm_loadu_ps(Row + x), Z4));
+        }
+#endif
+        for (; x <= X1; ++x)
+        {
+            Row[x] = std::min(Row[x], Z);
+        }
+    }
+}
+
+void FOcclusionCuller::BuildHiZ()
+{
+    for (size_t Level = 1; Level < Levels.size(); ++Level)
+    {
+        const FDepthLevel& Src = Levels[Level - 1];
+        FDepthLevel& Dst = Levels[Level];
+
+        for (int y = 0; y < Dst.Height; ++y)
+        {
+            const float* Row0 = Src.Depth.data() + static_cast<size_t>(std::min(y * 2, Src.Height - 1)) * Src.Width;
+            const float* Row1 = Src.Depth.data() + static_cast<size_t>(std::min(y * 2 + 1, Src.Height - 1)) * Src.Width;
+            float* Out = Dst.Depth.data() + static_cast<size_t>(y) * Dst.Width;
+
+            int x = 0;
+#if OCCLUSION_USE_SSE
+            // 원본 8텍셀 -> 결과 4텍셀
+            for (; x * 2 + 8 <= Src.Width && x + 4 <= Dst.Width; x += 4)
+            {
+                const __m128 A = _mm_max_ps(_mm_loadu_ps(Row0 + x * 2), _mm_loadu_ps(Row1 + x * 2));
+                const __m128 B = _mm_max_ps(_mm_loadu_ps(Row0 + x * 2 + 4), _mm_loadu_ps(Row1 + x * 2 + 4));
+                const __m128 Even = _mm_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0));
+                const __m128 Odd = _mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1));
+                _mm_storeu_ps(Out + x, _mm_max_ps(Even, Odd));
+            }
+#endif
+            for (; x < Dst.Width; ++x)
+            {
+                const int X0 = std::min(x * 2, Src.Width - 1);
+                const int X1 = std::min(x * 2 + 1, Src.Width - 1);
+                Out[x] = std::max(std::max(Row0[X0], Row0[X1]), std::max(Row1[X0], Row1[X1]));
+            }
+        }
+    }
+}
+
+bool FOcclusionCuller::IsOccluded(const FOcclusionSphere& Sphere) const
+{
+    const float NearestZ = Sphere.Z - Sphere.Radius;
+    if (NearestZ <= NearZ)
+    {
+        return false;
+    }
+
+    // 화면 밖으로 치우친 구도 감싸도록 |X|, |Y|만큼 반지름을 키운 보수적인 사각형
+    const float Scale = (Sphere.Z + std::max(std::fabs(Sphere.X), std::fabs(Sphere.Y))) / Sphere.Z;
+    const FScreenRect Rect = ProjectSphere(Sphere, Sphere.Radius * Scale, NearestZ);
+
+    if (Rect.MaxX < 0.0f || Rect.MaxY < 0.0f || Rect.MinX >= static_cast<float>(Width) || Rect.MinY >= static_cast<float>(Height))
+    {
+        // 화면 밖은 프러스텀 컬링 몫으로 남겨둠
+        return false;
+    }
+
+    const int X0 = std::max(0, static_cast<int>(Rect.MinX));
+    const int Y0 = std::max(0, static_cast<int>(Rect.MinY));
+    const int X1 = std::min(Width - 1, static_cast<int>(Rect.MaxX));
+    const int Y1 = std::min(Height - 1, static_cast<int>(Rect.MaxY));
+
+    // 사각형이 최대 2x2 텍셀에 들어가는 Mip 선택
+    int Level = 0;
+    while (Level + 1 < static_cast<int>(Levels.size())
+        && ((X1 >> Level) - (X0 >> Level) > 1 || (Y1 >> Level) - (Y0 >> Level) > 1))
+    {
+        ++Level;
+    }
+
+    float MaxDepth = 0.0f;
+    for (int y = Y0 >> Level; y <= Y1 >> Level; ++y)
+    {
+        for (int x = X0 >> Level; x <= X1 >> Level; ++x)
+        {
+            MaxDepth = std::max(MaxDepth, GetDepth(Level, x, y));
+        }
+    }
+
+    return NearestZ > MaxDepth;
+}
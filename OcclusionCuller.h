@@ -0,0 +1,98 @@
+﻿#pragma once
+
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 뷰 공간(LH, +Z가 전방)에서의 구 형태 바운드
+ */
+struct FOcclusionSphere
+{
+    float X, Y, Z;
+    float Radius;          // 메시를 완전히 감싸는 반지름 (가려짐 판정용)
+    float OccluderRadius;  // 메시 안에 완전히 들어가는 반지름 (가리는 쪽으로 쓸 때 사용, 0이면 오클루더 제외)
+};
+
+struct FOcclusionStats
+{
+    uint32 NumTested = 0;
+    uint32 NumOccluders = 0;
+    uint32 NumCulled = 0;
+
+    /** 컬링된 인스턴스 비율 [0, 1] */
+    float GetCulledRatio() const { return NumTested > 0 ? static_cast<float>(NumCulled) / static_cast<float>(NumTested) : 0.0f; }
+};
+
+/**
+ * CPU 소프트웨어 오클루전 컬러
+ *
+ * 1. 가까우면서 화면에서 큰 구를 오클루더로 골라 저해상도 깊이 버퍼에 그린다.
+ * 2. 깊이 버퍼로 2x2 최댓값 Hi-Z 피라미드를 만든다.
+ * 3. 나머지 인스턴스의 화면 사각형을 적당한 Mip에서 검사해서 완전히 가려지면 컬링한다.
+ *
+ * 깊이는 뷰 공간 Z(선형)를 그대로 저장하며, D3D와 무관하게 동작한다.
+ */
+class FOcclusionCuller
+{
+public:
+    FOcclusionCuller();
+
+    /** 깊이 버퍼 해상도를 설정합니다. 가로는 4의 배수로 올림됩니다. */
+    void SetResolution(int InWidth, int InHeight);
+
+    /** 렌더러와 같은 원근 투영 값을 설정합니다. */
+    void SetProjection(float FovY, float AspectRatio, float InNearZ);
+
+    /** 한 프레임에 깊이 버퍼에 그릴 최대 오클루더 수 */
+    void SetMaxOccluders(int InMaxOccluders) { MaxOccluders = InMaxOccluders; }
+
+    /**
+     * 가려진 구를 걸러냅니다.
+     * @param Spheres 뷰 공간 바운드 배열
+     * @param Count 바운드 개수
+     * @param OutVisible Count 크기의 배열, 보이면 1 가려졌으면 0이 기록됨
+     * @return 이번 컬링 통계
+     */
+    FOcclusionStats Cull(const FOcclusionSphere* Spheres, uint32 Count, uint8* OutVisible);
+
+    int GetWidth() const { return Width; }
+    int GetHeight() const { return Height; }
+    int GetNumLevels() const { return static_cast<int>(Levels.size()); }
+
+    /** Level 번째 Hi-Z Mip의 (X, Y) 깊이, 0번이 원본 깊이 버퍼 */
+    float GetDepth(int Level, int X, int Y) const;
+
+private:
+    struct FDepthLevel
+    {
+        int Width;
+        int Height;
+        std::vector<float> Depth;
+    };
+
+    struct FScreenRect
+    {
+        float MinX, MinY, MaxX, MaxY;
+    };
+
+    void ClearDepth();
+    void RasterizeOccluder(const FOcclusionSphere& Sphere);
+    void BuildHiZ();
+    bool IsOccluded(const FOcclusionSphere& Sphere) const;
+
+    /** 구를 반지름 Radius로 투영한 화면 사각형 (픽셀 단위) */
+    FScreenRect ProjectSphere(const FOcclusionSphere& Sphere, float Radius, float Depth) const;
+
+private:
+    int Width = 0;
+    int Height = 0;
+    int MaxOccluders = 32;
+
+    float ProjScaleX = 1.0f;  // 1 / (tan(FovY/2) * Aspect)
+    float ProjScaleY = 1.0f;  // 1 / tan(FovY/2)
+    float NearZ = 0.1f;
+
+    std::vector<FDepthLevel> Levels;
+    std::vector<uint32> OccluderCandidates;
+};
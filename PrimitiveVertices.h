@@ -14,6 +14,24 @@ inline FVertexSimple AxisZVertices[] = {
 {0.0f, 0.0f, -10.0f, 0.0f,0.0f, 1.0f, 1.0f},
 };
 
+inline FVertexSimple TriangleVertices[] =
+{
+	{  0.0f,  0.5f, 0.0f,  1.0f, 0.0f, 0.0f, 1.0f }, // Top (red)
+	{  0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f, 1.0f }, // Bottom-right (green)
+	{ -0.5f, -0.5f, 0.0f,  0.0f, 0.0f, 1.0f, 1.0f }, // Bottom-left (blue)
+};
+
+// 구 임포스터용 사각형, 위치는 카메라를 향한 평면의 (U, V) 좌표로 사용됨
+inline FVertexSimple ImpostorQuadVertices[] =
+{
+	{ -1.0f, -1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+	{ -1.0f,  1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+	{  1.0f, -1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+	{ -1.0f,  1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+	{  1.0f,  1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+	{  1.0f, -1.0f, 0.0f,  1.0f, 1.0f, 1.0f, 1.0f },
+};
+
 inline FVertexSimple CubeVertices[] =
 {
     // Front face (Z+)
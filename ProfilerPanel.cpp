@@ -0,0 +1,315 @@
+﻿#include "ProfilerPanel.h"
+
+#include <algorithm>
+
+#include "ImGui/imgui.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/MemoryAllocInfo.h"
+
+void FProfilerPanel::Draw(FProfilerHistory& History, bool* bOpen)
+{
+    if (!ImGui::Begin("Profiler", bOpen))
+    {
+        ImGui::End();
+        return;
+    }
+
+    bool bFrozen = History.IsFrozen();
+    if (ImGui::Checkbox("Freeze", &bFrozen))
+    {
+        History.SetFrozen(bFrozen);
+        if (!bFrozen)
+        {
+            SelectedFrame = -1;
+        }
+    }
+
+    ImGui::SameLine();
+    int MaxFrames = static_cast<int>(History.GetMaxFrames());
+    ImGui::SetNextItemWidth(150.0f);
+    if (ImGui::SliderInt("History", &MaxFrames, 30, 1000))
+    {
+        History.SetMaxFrames(static_cast<uint32>(MaxFrames));
+    }
+
+    if (History.NumFrames() == 0)
+    {
+        ImGui::TextUnformatted("No frames captured.");
+        ImGui::End();
+        return;
+    }
+
+    if (SelectedFrame >= static_cast<int>(History.NumFrames()))
+    {
+        SelectedFrame = -1;
+    }
+
+    DrawFrameHistory(History);
+
+    const uint32 FrameIndex = SelectedFrame >= 0 ? static_cast<uint32>(SelectedFrame) : History.NumFrames() - 1;
+    const FProfileFrame& Frame = History.GetFrame(FrameIndex);
+    ImGui::Text("Frame %u / %u: %.3f ms", FrameIndex + 1, History.NumFrames(), Frame.Milliseconds);
+
+    if (ImGui::CollapsingHeader("Flame Graph", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        DrawFlameGraph(History, Frame);
+    }
+    if (ImGui::CollapsingHeader("Scopes", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        DrawScopeStats(History);
+    }
+    if (FMemoryAllocInfo::IsEnabled() && ImGui::CollapsingHeader("Memory", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        DrawMemoryStats();
+    }
+
+    ImGui::End();
+}
+
+void FProfilerPanel::DrawFrameHistory(FProfilerHistory& History)
+{
+    const float Width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+    constexpr float Height = 120.0f;
+
+    const ImVec2 Origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##FrameHistory", ImVec2(Width, Height));
+    const bool bHovered = ImGui::IsItemHovered();
+    const bool bClicked = ImGui::IsItemClicked();
+
+    ImDrawList* DrawList = ImGui::GetWindowDrawList();
+    DrawList->AddRectFilled(Origin, ImVec2(Origin.x + Width, Origin.y + Height), IM_COL32(20, 20, 20, 255));
+
+    // 세로 축은 히스토리 안의 최대 프레임 시간과 목표 시간 중 큰 값
+    double ScaleMilliseconds = TargetFrameTime;
+    for (uint32 i = 0; i < History.NumFrames(); ++i)
+    {
+        ScaleMilliseconds = std::max(ScaleMilliseconds, History.GetFrame(i).Milliseconds);
+    }
+    const float PixelsPerMillisecond = Height / static_cast<float>(ScaleMilliseconds);
+    const float BarWidth = Width / static_cast<float>(History.GetMaxFrames());
+
+    // 최근 프레임이 오른쪽 끝에 오도록 정렬
+    const float FirstBarX = Origin.x + Width - BarWidth * static_cast<float>(History.NumFrames());
+    int HoveredFrame = -1;
+    for (uint32 i = 0; i < History.NumFrames(); ++i)
+    {
+        const FProfileFrame& Frame = History.GetFrame(i);
+        const float Left = FirstBarX + BarWidth * static_cast<float>(i);
+        const float Right = Left + std::max(BarWidth - 1.0f, 1.0f);
+
+        float Bottom = Origin.y + Height;
+        double Accounted = 0.0;
+        for (const FProfileScopeTime& Scope : Frame.Breakdown)
+        {
+            const float Top = Bottom - static_cast<float>(Scope.Milliseconds) * PixelsPerMillisecond;
+            DrawList->AddRectFilled(ImVec2(Left, Top), ImVec2(Right, Bottom), GetScopeColor(Scope.Name));
+            Bottom = Top;
+            Accounted += Scope.Milliseconds;
+        }
+
+        // 어느 하위 스코프에도 속하지 않은 시간
+        const float Top = Bottom - static_cast<float>(std::max(Frame.Milliseconds - Accounted, 0.0)) * PixelsPerMillisecond;
+        DrawList->AddRectFilled(ImVec2(Left, Top), ImVec2(Right, Bottom), IM_COL32(90, 90, 90, 255));
+
+        if (static_cast<int>(i) == SelectedFrame)
+        {
+            DrawList->AddRect(ImVec2(Left, Origin.y), ImVec2(Right, Origin.y + Height), IM_COL32(255, 255, 255, 255));
+        }
+
+        const float MouseX = ImGui::GetIO().MousePos.x;
+        if (bHovered && MouseX >= Left && MouseX < Left + BarWidth)
+        {
+            HoveredFrame = static_cast<int>(i);
+        }
+    }
+
+    if (TargetFrameTime > 0.0f)
+    {
+        const float TargetY = Origin.y + Height - TargetFrameTime * PixelsPerMillisecond;
+        DrawList->AddLine(ImVec2(Origin.x, TargetY), ImVec2(Origin.x + Width, TargetY), IM_COL32(255, 80, 80, 200));
+    }
+
+    if (HoveredFrame >= 0)
+    {
+        const FProfileFrame& Frame = History.GetFrame(static_cast<uint32>(HoveredFrame));
+        ImGui::BeginTooltip();
+        ImGui::Text("Frame: %.3f ms", Frame.Milliseconds);
+        for (const FProfileScopeTime& Scope : Frame.Breakdown)
+        {
+            ImGui::ColorButton(Scope.Name, ImGui::ColorConvertU32ToFloat4(GetScopeColor(Scope.Name)), ImGuiColorEditFlags_NoTooltip, ImVec2(10, 10));
+            ImGui::SameLine();
+            ImGui::Text("%s: %.3f ms", Scope.Name, Scope.Milliseconds);
+        }
+        ImGui::EndTooltip();
+
+        // 클릭하면 멈추고 그 프레임을 보여줌
+        if (bClicked)
+        {
+            SelectedFrame = HoveredFrame;
+            History.SetFrozen(true);
+        }
+    }
+}
+
+void FProfilerPanel::DrawFlameGraph(const FProfilerHistory& History, const FProfileFrame& Frame) const
+{
+    constexpr float RowHeight = 18.0f;
+    const float Width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+    const double FrameTicks = static_cast<double>(std::max<uint64>(Frame.EndTicks - Frame.StartTicks, 1));
+
+    // 스레드마다 필요한 줄 수
+    uint32 NumRows = 0;
+    TFrameArray<std::pair<uint32, uint32>> ThreadRows;  // (ThreadIndex, 첫 줄)
+    for (size_t i = 0; i < Frame.Events.size();)
+    {
+        const uint32 ThreadIndex = Frame.Events[i].ThreadIndex;
+        uint32 MaxDepth = 0;
+        for (; i < Frame.Events.size() && Frame.Events[i].ThreadIndex == ThreadIndex; ++i)
+        {
+            MaxDepth = std::max(MaxDepth, Frame.Events[i].Depth);
+        }
+        ThreadRows.Emplace(ThreadIndex, NumRows);
+        NumRows += MaxDepth + 2;  // 스레드 사이에 한 줄 띄움
+    }
+
+    const ImVec2 Origin = ImGui::GetCursorScreenPos();
+    const float Height = std::max(NumRows, 1u) * RowHeight;
+    ImGui::InvisibleButton("##FlameGraph", ImVec2(Width, Height));
+    const bool bHovered = ImGui::IsItemHovered();
+    const ImVec2 Mouse = ImGui::GetIO().MousePos;
+
+    ImDrawList* DrawList = ImGui::GetWindowDrawList();
+    DrawList->PushClipRect(Origin, ImVec2(Origin.x + Width, Origin.y + Height), true);
+
+    const FProfileEvent* HoveredEvent = nullptr;
+    size_t ThreadRowIndex = 0;
+    for (const FProfileEvent& Event : Frame.Events)
+    {
+        while (ThreadRows[ThreadRowIndex].first != Event.ThreadIndex)
+        {
+            ++ThreadRowIndex;
+        }
+
+        const double StartRatio = static_cast<double>(static_cast<int64>(Event.StartTicks - Frame.StartTicks)) / FrameTicks;
+        const double EndRatio = static_cast<double>(static_cast<int64>(Event.EndTicks - Frame.StartTicks)) / FrameTicks;
+        const float Left = Origin.x + static_cast<float>(StartRatio) * Width;
+        const float Right = std::max(Origin.x + static_cast<float>(EndRatio) * Width, Left + 1.0f);
+        const float Top = Origin.y + static_cast<float>(ThreadRows[ThreadRowIndex].second + Event.Depth) * RowHeight;
+        const float Bottom = Top + RowHeight - 1.0f;
+
+        DrawList->AddRectFilled(ImVec2(Left, Top), ImVec2(Right, Bottom), GetScopeColor(Event.Name));
+
+        // 이름이 들어갈 공간이 있을 때만 표시
+        const float TextWidth = ImGui::CalcTextSize(Event.Name).x;
+        if (Right - Left > TextWidth + 4.0f)
+        {
+            DrawList->AddText(ImVec2(Left + 2.0f, Top + 1.0f), IM_COL32(0, 0, 0, 255), Event.Name);
+        }
+
+        if (bHovered && Mouse.x >= Left && Mouse.x < Right && Mouse.y >= Top && Mouse.y < Bottom)
+        {
+            HoveredEvent = &Event;
+        }
+    }
+
+    DrawList->PopClipRect();
+
+    if (HoveredEvent)
+    {
+        ImGui::BeginTooltip();
+        ImGui::Text("%s", HoveredEvent->Name);
+        ImGui::Text("%.3f ms (thread %u, depth %u)", History.TicksToMilliseconds(HoveredEvent->EndTicks - HoveredEvent->StartTicks), HoveredEvent->ThreadIndex, HoveredEvent->Depth);
+        ImGui::EndTooltip();
+    }
+}
+
+void FProfilerPanel::DrawScopeStats(const FProfilerHistory& History) const
+{
+    constexpr ImGuiTableFlags Flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("##ScopeStats", 6, Flags))
+    {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Scope");
+    ImGui::TableSetupColumn("Last");
+    ImGui::TableSetupColumn("Min");
+    ImGui::TableSetupColumn("Avg");
+    ImGui::TableSetupColumn("P99");
+    ImGui::TableSetupColumn("Max");
+    ImGui::TableHeadersRow();
+
+    for (const FProfileScopeStats& Stats : History.GetScopeStats())
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::ColorButton(Stats.Name, ImGui::ColorConvertU32ToFloat4(GetScopeColor(Stats.Name)), ImGuiColorEditFlags_NoTooltip, ImVec2(10, 10));
+        ImGui::SameLine();
+        ImGui::TextUnformatted(Stats.Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", Stats.Last);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", Stats.Min);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", Stats.Average);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", Stats.P99);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", Stats.Max);
+    }
+
+    ImGui::EndTable();
+}
+
+void FProfilerPanel::DrawMemoryStats() const
+{
+    constexpr ImGuiTableFlags Flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("##MemoryStats", 5, Flags))
+    {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Tag");
+    ImGui::TableSetupColumn("Live KB");
+    ImGui::TableSetupColumn("Sampled Peak KB");
+    ImGui::TableSetupColumn("Live Allocs");
+    ImGui::TableSetupColumn("Allocs/Frame");
+    ImGui::TableHeadersRow();
+
+    auto DrawRow = [](const char* Name, const FMemoryTagStats& Stats)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(Name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", Stats.LiveBytes / 1024.0);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", Stats.SampledPeakBytes / 1024.0);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", Stats.NumLiveAllocations);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", Stats.FrameAllocations);
+    };
+
+    for (uint8 Tag = 0; Tag < static_cast<uint8>(EMemoryTag::Max); ++Tag)
+    {
+        DrawRow(GetMemoryTagName(static_cast<EMemoryTag>(Tag)), FMemoryAllocInfo::GetStats(static_cast<EMemoryTag>(Tag)));
+    }
+    DrawRow("Total", FMemoryAllocInfo::GetTotalStats());
+
+    ImGui::EndTable();
+}
+
+unsigned int FProfilerPanel::GetScopeColor(const char* Name)
+{
+    // FNV-1a 해시로 색상(Hue)을 고르고, 채도와 밝기는 고정
+    uint32 Hash = 2166136261u;
+    for (const char* Char = Name; *Char; ++Char)
+    {
+        Hash = (Hash ^ static_cast<uint8>(*Char)) * 16777619u;
+    }
+
+    float R, G, B;
+    ImGui::ColorConvertHSVtoRGB(static_cast<float>(Hash % 360) / 360.0f, 0.55f, 0.9f, R, G, B);
+    return ImGui::ColorConvertFloat4ToU32(ImVec4(R, G, B, 1.0f));
+}
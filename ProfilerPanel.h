@@ -0,0 +1,29 @@
+﻿#pragma once
+
+#include "Core/Profiler/ProfilerHistory.h"
+
+/**
+ * FProfilerHistory를 보여주는 ImGui 창
+ * 최근 프레임의 서브시스템별 시간을 누적 막대로, 선택한 프레임을 플레임 그래프로, 스코프별 통계와 태그별 메모리를 표로 그린다.
+ * 막대를 클릭하면 히스토리를 멈추고 그 프레임을 보여준다.
+ */
+class FProfilerPanel
+{
+public:
+    void Draw(FProfilerHistory& History, bool* bOpen = nullptr);
+
+    /** 막대 그래프에 목표 프레임 시간 선을 그림 (ms, 0이면 안 그림) */
+    float TargetFrameTime = 1000.0f / 60.0f;
+
+private:
+    void DrawFrameHistory(FProfilerHistory& History);
+    void DrawFlameGraph(const FProfilerHistory& History, const FProfileFrame& Frame) const;
+    void DrawScopeStats(const FProfilerHistory& History) const;
+    void DrawMemoryStats() const;
+
+    /** 이름마다 항상 같은 색 */
+    static unsigned int GetScopeColor(const char* Name);
+
+private:
+    int SelectedFrame = -1;  // -1이면 가장 최근 프레임
+};
@@ -0,0 +1,55 @@
+﻿#include "RenderBatch.h"
+
+#include <algorithm>
+
+void FRenderBatchBuilder::Reset()
+{
+    Keys.Empty();
+    Batches.Empty();
+}
+
+void FRenderBatchBuilder::AddInstance(EShaderType Shader, EPrimitiveType Primitive, uint32 SourceIndex)
+{
+    Keys.Add(FDrawKey::Make(Shader, Primitive, SourceIndex));
+}
+
+void FRenderBatchBuilder::Build()
+{
+    Batches.Empty();
+    if (Keys.Num() == 0)
+    {
+        return;
+    }
+
+    // SourceIndex가 하위 비트에 있으므로 같은 배치 안에서는 제출 순서가 유지됨
+    Keys.Sort();
+
+    FDrawBatch Current = {Keys[0].GetShader(), Keys[0].GetPrimitive(), 0, 0};
+    for (uint32 i = 0; i < static_cast<uint32>(Keys.Num()); ++i)
+    {
+        if (!Keys[i].IsSameState(Keys[Current.InstanceOffset]))
+        {
+            Batches.Add(Current);
+            Current = {Keys[i].GetShader(), Keys[i].GetPrimitive(), i, 0};
+        }
+        ++Current.InstanceCount;
+    }
+    Batches.Add(Current);
+}
+
+uint32 FRenderBatchBuilder::ClampBatches(uint32 MaxInstanceCount, TArray<FDrawBatch>& OutBatches) const
+{
+    const uint32 NumInstances = std::min(static_cast<uint32>(Keys.Num()), MaxInstanceCount);
+
+    OutBatches.Empty();
+    for (FDrawBatch Batch : Batches)
+    {
+        if (Batch.InstanceOffset >= NumInstances)
+        {
+            break;
+        }
+        Batch.InstanceCount = std::min(Batch.InstanceCount, NumInstances - Batch.InstanceOffset);
+        OutBatches.Add(Batch);
+    }
+    return NumInstances;
+}
@@ -0,0 +1,84 @@
+﻿#pragma once
+
+#include "Enum.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 정렬 가능한 드로우 키
+ * 상위 비트부터 Shader -> Primitive -> 제출 순서로 배치되어 있어서
+ * 키를 정렬하기만 하면 같은 상태를 쓰는 인스턴스끼리 연속으로 모인다.
+ *
+ * | 63..56 Shader | 55..48 Primitive | 47..32 예약 | 31..0 SourceIndex |
+ */
+struct FDrawKey
+{
+    uint64 Value = 0;
+
+    static FDrawKey Make(EShaderType Shader, EPrimitiveType Primitive, uint32 SourceIndex)
+    {
+        FDrawKey Key;
+        Key.Value = static_cast<uint64>(Shader) << 56
+            | static_cast<uint64>(Primitive) << 48
+            | static_cast<uint64>(SourceIndex);
+        return Key;
+    }
+
+    EShaderType GetShader() const { return static_cast<EShaderType>(Value >> 56 & 0xff); }
+    EPrimitiveType GetPrimitive() const { return static_cast<EPrimitiveType>(Value >> 48 & 0xff); }
+    uint32 GetSourceIndex() const { return static_cast<uint32>(Value & 0xffffffff); }
+
+    /** SourceIndex를 제외한 상태 비트만 비교 */
+    bool IsSameState(const FDrawKey& Other) const { return (Value >> 48) == (Other.Value >> 48); }
+
+    bool operator<(const FDrawKey& Other) const { return Value < Other.Value; }
+};
+
+/**
+ * 인스턴스 드로우 한 번에 해당하는 묶음
+ * 공유 인스턴스 버퍼의 [InstanceOffset, InstanceOffset + InstanceCount) 구간을 사용한다.
+ */
+struct FDrawBatch
+{
+    EShaderType Shader;
+    EPrimitiveType Primitive;
+    uint32 InstanceOffset;
+    uint32 InstanceCount;
+};
+
+/**
+ * 오브젝트들을 (Shader, Primitive) 별로 묶어서 인스턴스 드로우 목록을 만든다.
+ * 렌더러와 무관한 순수 CPU 코드라 D3D 없이도 사용할 수 있다.
+ */
+class FRenderBatchBuilder
+{
+public:
+    /** 이번 프레임에 쌓인 인스턴스와 배치를 모두 비웁니다. */
+    void Reset();
+
+    /**
+     * 인스턴스를 하나 등록합니다.
+     * @param SourceIndex 호출자 쪽 인스턴스 데이터 배열에서의 인덱스
+     */
+    void AddInstance(EShaderType Shader, EPrimitiveType Primitive, uint32 SourceIndex);
+
+    /** 키를 정렬하고 같은 상태끼리 묶어서 배치 목록을 만듭니다. */
+    void Build();
+
+    /** Build 이후 정렬된 순서에서 SortedIndex 번째 인스턴스의 원래 인덱스 */
+    uint32 GetSourceIndex(uint32 SortedIndex) const { return Keys[SortedIndex].GetSourceIndex(); }
+
+    const TArray<FDrawBatch>& GetBatches() const { return Batches; }
+
+    /**
+     * Build 이후, 인스턴스 버퍼에 MaxInstanceCount개까지만 들어갈 때 그릴 배치 목록을 OutBatches에 채웁니다.
+     * 용량을 넘는 배치는 빼고, 경계에 걸친 배치는 인스턴스 수를 줄인다.
+     * @return 그릴 인스턴스 수
+     */
+    uint32 ClampBatches(uint32 MaxInstanceCount, TArray<FDrawBatch>& OutBatches) const;
+    size_t NumInstances() const { return Keys.Num(); }
+
+private:
+    TArray<FDrawKey> Keys;
+    TArray<FDrawBatch> Batches;
+};
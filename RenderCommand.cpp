@@ -0,0 +1,114 @@
+﻿#include "RenderCommand.h"
+
+#include <algorithm>
+
+#include "Core/Async/TaskPool.h"
+#include "Core/Profiler/Profiler.h"
+
+void FParallelCommandSubmitter::SplitBatches(const TArray<FDrawBatch>& Batches, uint32 NumChunks, std::vector<std::vector<FDrawBatch>>& OutChunks)
+{
+    OutChunks.resize(NumChunks);
+    for (std::vector<FDrawBatch>& Chunk : OutChunks)
+    {
+        Chunk.clear();
+    }
+
+    uint64 TotalInstances = 0;
+    for (const FDrawBatch& Batch : Batches)
+    {
+        TotalInstances += Batch.InstanceCount;
+    }
+    if (NumChunks == 0 || TotalInstances == 0)
+    {
+        return;
+    }
+
+    const uint64 PerChunk = (TotalInstances + NumChunks - 1) / NumChunks;
+    uint32 ChunkIndex = 0;
+    uint64 ChunkFill = 0;
+
+    for (const FDrawBatch& Batch : Batches)
+    {
+        FDrawBatch Remaining = Batch;
+        while (Remaining.InstanceCount > 0)
+        {
+            // 마지막 청크는 나머지를 모두 받음
+            const uint64 Space = ChunkIndex + 1 == NumChunks ? Remaining.InstanceCount : PerChunk - ChunkFill;
+            const uint32 Take = static_cast<uint32>(std::min<uint64>(Space, Remaining.InstanceCount));
+
+            FDrawBatch Piece = Remaining;
+            Piece.InstanceCount = Take;
+            OutChunks[ChunkIndex].push_back(Piece);
+
+            Remaining.InstanceOffset += Take;
+            Remaining.InstanceCount -= Take;
+            ChunkFill += Take;
+
+            if (ChunkFill == PerChunk && ChunkIndex + 1 < NumChunks)
+            {
+                ++ChunkIndex;
+                ChunkFill = 0;
+            }
+        }
+    }
+}
+
+void FParallelCommandSubmitter::Submit(IRenderDevice& Device, FTaskPool& TaskPool, const TArray<FDrawBatch>& Batches)
+{
+    const uint32 NumRecorders = Device.GetNumRecorders();
+    SplitBatches(Batches, NumRecorders, Chunks);
+
+    TaskPool.ParallelFor(NumRecorders, [this, &Device](uint32 Index)
+    {
+        PROFILE_SCOPE("RecordCommands");
+
+        IRenderCommandRecorder& Recorder = Device.GetRecorder(Index);
+        Recorder.BeginRecording();
+        for (const FDrawBatch& Batch : Chunks[Index])
+        {
+            Recorder.RecordBatch(Batch);
+        }
+        Recorder.FinishRecording();
+    });
+
+    // 기록은 병렬이지만 재생은 항상 Recorder 순서대로
+    PROFILE_SCOPE("ExecuteCommandLists");
+    for (uint32 i = 0; i < NumRecorders; ++i)
+    {
+        Device.ExecuteRecorded(i);
+    }
+}
+
+FRecordingRenderDevice::FRecordingRenderDevice(uint32 NumRecorders)
+{
+    Recorders.reserve(NumRecorders);
+    for (uint32 i = 0; i < NumRecorders; ++i)
+    {
+        Recorders.emplace_back(i);
+    }
+}
+
+void FRecordingRenderDevice::ExecuteRecorded(uint32 Index)
+{
+    FRecorder& Recorder = Recorders[Index];
+    ReplayedCommands.insert(ReplayedCommands.end(), Recorder.Recorded.begin(), Recorder.Recorded.end());
+    Recorder.Recorded.clear();
+}
+
+void FRecordingRenderDevice::FRecorder::BeginRecording()
+{
+    Pending.clear();
+    Pending.push_back({FCommand::EType::Begin, Index, {}});
+}
+
+void FRecordingRenderDevice::FRecorder::RecordBatch(const FDrawBatch& Batch)
+{
+    Pending.push_back({FCommand::EType::Draw, Index, Batch});
+}
+
+void FRecordingRenderDevice::FRecorder::FinishRecording()
+{
+    Pending.push_back({FCommand::EType::Finish, Index, {}});
+    Recorded.swap(Pending);
+    Pending.clear();
+}
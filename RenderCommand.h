@@ -0,0 +1,103 @@
+﻿#pragma once
+
+#include <vector>
+
+#include "RenderBatch.h"
+
+class FTaskPool;
+
+/**
+ * 드로우 명령을 기록하는 대상
+ * D3D11에서는 Deferred Context 하나가 하나의 Recorder에 해당한다.
+ * 서로 다른 Recorder는 서로 다른 스레드에서 동시에 기록될 수 있다.
+ */
+class IRenderCommandRecorder
+{
+public:
+    virtual ~IRenderCommandRecorder() = default;
+
+    /** 기록 시작, 파이프라인 상태(렌더 타겟, 뷰포트 등)를 다시 설정합니다. */
+    virtual void BeginRecording() = 0;
+
+    /** 배치 하나에 대한 드로우를 기록합니다. */
+    virtual void RecordBatch(const FDrawBatch& Batch) = 0;
+
+    /** 기록을 마치고 재생 가능한 명령 리스트로 만듭니다. */
+    virtual void FinishRecording() = 0;
+};
+
+/**
+ * 명령 기록과 재생을 제공하는 렌더 디바이스 추상화
+ */
+class IRenderDevice
+{
+public:
+    virtual ~IRenderDevice() = default;
+
+    virtual uint32 GetNumRecorders() const = 0;
+    virtual IRenderCommandRecorder& GetRecorder(uint32 Index) = 0;
+
+    /** Index 번째 Recorder가 기록한 명령을 메인 컨텍스트에서 실행합니다. */
+    virtual void ExecuteRecorded(uint32 Index) = 0;
+};
+
+/**
+ * 배치 목록을 Recorder 수만큼 나눠 병렬로 기록하고, 원래 순서대로 재생한다.
+ */
+class FParallelCommandSubmitter
+{
+public:
+    /**
+     * 배치를 인스턴스 수 기준으로 고르게 NumChunks개로 나눕니다.
+     * 한 배치가 경계에 걸치면 InstanceOffset을 나눠서 두 드로우로 쪼갭니다.
+     */
+    static void SplitBatches(const TArray<FDrawBatch>& Batches, uint32 NumChunks, std::vector<std::vector<FDrawBatch>>& OutChunks);
+
+    /** 기록은 TaskPool에서 병렬로, 재생은 호출 스레드에서 순서대로 실행합니다. */
+    void Submit(IRenderDevice& Device, FTaskPool& TaskPool, const TArray<FDrawBatch>& Batches);
+
+private:
+    std::vector<std::vector<FDrawBatch>> Chunks;
+};
+
+/**
+ * GPU 없이 기록/재생 순서를 확인하기 위한 디바이스
+ * 재생된 명령이 ReplayedCommands에 순서대로 쌓인다.
+ */
+class FRecordingRenderDevice : public IRenderDevice
+{
+public:
+    struct FCommand
+    {
+        enum class EType : uint8 { Begin, Draw, Finish } Type;
+        uint32 RecorderIndex;
+        FDrawBatch Batch;
+    };
+
+    explicit FRecordingRenderDevice(uint32 NumRecorders);
+
+    uint32 GetNumRecorders() const override { return static_cast<uint32>(Recorders.size()); }
+    IRenderCommandRecorder& GetRecorder(uint32 Index) override { return Recorders[Index]; }
+    void ExecuteRecorded(uint32 Index) override;
+
+    const std::vector<FCommand>& GetReplayedCommands() const { return ReplayedCommands; }
+    void ClearReplayed() { ReplayedCommands.clear(); }
+
+private:
+    class FRecorder : public IRenderCommandRecorder
+    {
+    public:
+        explicit FRecorder(uint32 InIndex) : Index(InIndex) {}
+
+        void BeginRecording() override;
+        void RecordBatch(const FDrawBatch& Batch) override;
+        void FinishRecording() override;
+
+        uint32 Index;
+        std::vector<FCommand> Pending;     // 기록 중인 명령
+        std::vector<FCommand> Recorded;    // FinishRecording으로 닫힌 명령 리스트
+    };
+
+    std::vector<FRecorder> Recorders;
+    std::vector<FCommand> ReplayedCommands;
+};
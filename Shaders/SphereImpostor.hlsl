@@ -0,0 +1,91 @@
+// SphereImpostor.hlsl
+
+/**
+ * 구 임포스터 셰이더
+ * 인스턴스마다 카메라를 향한 사각형 하나만 그리고, 픽셀 셰이더에서 광선-구 교차로 표면과 깊이를 구한다.
+ * CPU 레퍼런스 구현은 SphereImpostor.cpp에 있으며 수식이 동일해야 한다.
+ */
+cbuffer FMatrix : register(b0)
+{
+    matrix World;
+    matrix View;
+    matrix Proj;
+};
+
+struct VS_INPUT
+{
+    float4 position : POSITION; // 사각형 코너 (-1 ~ 1)
+    float4 color : COLOR;
+    float4 Sphere : WORLD0;     // xyz: 뷰 공간 중심, w: 반지름
+    float4 Unused0 : WORLD1;
+    float4 Unused1 : WORLD2;
+    float4 Unused2 : WORLD3;
+};
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float3 viewPos : TEXCOORD0;                 // 사각형 위의 뷰 공간 위치 (눈에서의 광선 방향)
+    nointerpolation float4 sphere : TEXCOORD1;  // 뷰 공간 중심, 반지름
+};
+
+struct PS_OUTPUT
+{
+    float4 color : SV_TARGET;
+    float depth : SV_Depth;
+};
+
+PS_INPUT mainVS(VS_INPUT input)
+{
+    PS_INPUT output;
+
+    float3 Center = input.Sphere.xyz;
+    float Radius = input.Sphere.w;
+
+    // 중심을 지나고 시선에 수직인 평면에서 실루엣 원뿔의 반지름은 r * d / sqrt(d^2 - r^2)
+    float DistSq = dot(Center, Center);
+    float Enlarge = sqrt(DistSq / max(DistSq - Radius * Radius, 1e-6f));
+
+    float3 W = normalize(Center);
+    float3 U = normalize(cross(float3(0, 1, 0), W));
+    float3 V = cross(W, U);
+
+    float3 ViewPos = Center + (U * input.position.x + V * input.position.y) * Radius * Enlarge;
+
+    output.position = mul(float4(ViewPos, 1.0f), Proj);
+    output.viewPos = ViewPos;
+    output.sphere = input.Sphere;
+
+    return output;
+}
+
+PS_OUTPUT mainPS(PS_INPUT input)
+{
+    PS_OUTPUT output;
+
+    float3 Center = input.sphere.xyz;
+    float Radius = input.sphere.w;
+
+    // |tD - C|^2 = r^2
+    float3 D = normalize(input.viewPos);
+    float B = dot(D, Center);
+    float C = dot(Center, Center) - Radius * Radius;
+    float Discriminant = B * B - C;
+    if (Discriminant < 0.0f)
+    {
+        discard;
+    }
+
+    float T = B - sqrt(Discriminant);
+    float3 Hit = D * T;
+    float3 ViewNormal = (Hit - Center) / Radius;
+
+    // 메시 구와 같은 색이 나오도록 로컬(=월드) 노멀로 색을 만든다
+    float3 WorldNormal = mul((float3x3)View, ViewNormal);
+    output.color = float4(WorldNormal * 0.5f + 0.5f, 1.0f);
+
+    float4 Clip = mul(float4(Hit, 1.0f), Proj);
+    output.depth = Clip.z / Clip.w;
+
+    return output;
+}
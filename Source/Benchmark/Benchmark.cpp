@@ -0,0 +1,149 @@
+﻿#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+FBenchmarkState::FBenchmarkState(int64 InSize, uint64 InIterations)
+    : Size(InSize)
+    , Iterations(InIterations)
+    , RemainingIterations(InIterations)
+    , ItemsPerIteration(static_cast<uint64>(std::max<int64>(InSize, 1)))
+{
+}
+
+void FBenchmarkState::PauseTiming()
+{
+    if (bTiming)
+    {
+        const std::chrono::duration<double> Elapsed = FClock::now() - StartTime;
+        ElapsedSeconds += Elapsed.count();
+        bTiming = false;
+    }
+}
+
+void FBenchmarkState::ResumeTiming()
+{
+    if (!bTiming)
+    {
+        bTiming = true;
+        StartTime = FClock::now();
+    }
+}
+
+void FBenchmarkRunner::Register(const std::string& Name, const std::vector<int64>& Sizes, FBenchmarkFunction Function)
+{
+    Cases.push_back({ Name, Sizes, std::move(Function) });
+}
+
+std::vector<FBenchmarkResult> FBenchmarkRunner::Run(const FBenchmarkSettings& Settings, const std::function<void(const FBenchmarkResult&)>& OnResult) const
+{
+    std::vector<FBenchmarkResult> Results;
+    for (const FCase& Case : Cases)
+    {
+        if (!Settings.Filter.empty() && Case.Name.find(Settings.Filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        for (const int64 Size : Case.Sizes)
+        {
+            if (Size > Settings.MaxSize)
+            {
+                continue;
+            }
+
+            Results.push_back(RunCase(Case, Size, Settings));
+            if (OnResult)
+            {
+                OnResult(Results.back());
+            }
+        }
+    }
+    return Results;
+}
+
+std::vector<int64> FBenchmarkRunner::DefaultSizes()
+{
+    return { 1 << 10, 1 << 14, 1 << 17, 1 << 20 };
+}
+
+FBenchmarkResult FBenchmarkRunner::RunCase(const FCase& Case, int64 Size, const FBenchmarkSettings& Settings)
+{
+    // 반복 한 번이 MinTime 이상 걸리는 반복 횟수를 찾음, 이 과정이 예열도 겸함
+    uint64 Iterations = 1;
+    while (true)
+    {
+        FBenchmarkState State(Size, Iterations);
+        Case.Function(State);
+
+        const double Elapsed = State.GetElapsedSeconds();
+        if (Elapsed >= Settings.MinTime || Iterations >= (1ull << 30))
+        {
+            break;
+        }
+
+        // 목표보다 조금 넉넉하게 잡고, 너무 짧게 잰 값은 믿지 않고 최대 10배씩만 늘림
+        const double Scale = Elapsed > 0.0 ? Settings.MinTime * 1.2 / Elapsed : 10.0;
+        const uint64 NextIterations = static_cast<uint64>(static_cast<double>(Iterations) * std::clamp(Scale, 2.0, 10.0));
+        Iterations = std::max(NextIterations, Iterations + 1);
+    }
+
+    FBenchmarkResult Result;
+    Result.Name = Case.Name;
+    Result.Size = Size;
+    Result.Iterations = Iterations;
+
+    const uint32 Repetitions = std::max(Settings.Repetitions, 1u);
+    for (uint32 Repetition = 0; Repetition < Repetitions; ++Repetition)
+    {
+        FBenchmarkState State(Size, Iterations);
+        Case.Function(State);
+
+        const double Items = static_cast<double>(Iterations) * static_cast<double>(State.GetItemsPerIteration());
+        Result.Samples.push_back(State.GetElapsedSeconds() * 1.0e9 / Items);
+    }
+
+    double Sum = 0.0;
+    for (const double Sample : Result.Samples)
+    {
+        Sum += Sample;
+    }
+    Result.Mean = Sum / static_cast<double>(Result.Samples.size());
+
+    double SquaredSum = 0.0;
+    for (const double Sample : Result.Samples)
+    {
+        SquaredSum += (Sample - Result.Mean) * (Sample - Result.Mean);
+    }
+    Result.StdDev = Result.Samples.size() > 1 ? std::sqrt(SquaredSum / static_cast<double>(Result.Samples.size() - 1)) : 0.0;
+
+    const auto [MinIt, MaxIt] = std::minmax_element(Result.Samples.begin(), Result.Samples.end());
+    Result.Min = *MinIt;
+    Result.Max = *MaxIt;
+
+    std::vector<double> Sorted = Result.Samples;
+    Result.Median = ComputeMedian(Sorted);
+    Result.ItemsPerSecond = Result.Median > 0.0 ? 1.0e9 / Result.Median : 0.0;
+
+    return Result;
+}
+
+double ComputeMedian(std::vector<double>& Values)
+{
+    if (Values.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t Middle = Values.size() / 2;
+    std::nth_element(Values.begin(), Values.begin() + Middle, Values.end());
+    if (Values.size() % 2 == 1)
+    {
+        return Values[Middle];
+    }
+
+    const double Upper = Values[Middle];
+    const double Lower = *std::max_element(Values.begin(), Values.begin() + Middle);
+    return (Lower + Upper) * 0.5;
+}
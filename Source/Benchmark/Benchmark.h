@@ -0,0 +1,157 @@
+﻿#pragma once
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+
+/**
+ * 컴파일러가 Value를 계산하는 코드를 지우지 못하게 합니다.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(Value) : "memory");
+#else
+    const volatile char* Sink = reinterpret_cast<const volatile char*>(&Value);
+    (void)*Sink;
+    _ReadWriteBarrier();
+#endif
+}
+
+/**
+ * 벤치마크 함수 하나가 한 번 실행될 때의 상태
+ * 준비 코드는 KeepRunning 루프 밖에 두고, 루프 안의 코드만 측정한다.
+ *
+ *     while (State.KeepRunning())
+ *     {
+ *         ...
+ *     }
+ */
+class FBenchmarkState
+{
+public:
+    FBenchmarkState(int64 InSize, uint64 InIterations);
+
+    /** 케이스에 주어진 데이터 크기 */
+    int64 GetSize() const { return Size; }
+
+    bool KeepRunning()
+    {
+        if (RemainingIterations == 0)
+        {
+            PauseTiming();
+            return false;
+        }
+        if (!bStarted)
+        {
+            bStarted = true;
+            ResumeTiming();
+        }
+        --RemainingIterations;
+        return true;
+    }
+
+    /** 루프 안에서 매번 데이터를 되돌려야 할 때 그 부분을 측정에서 뺍니다. */
+    void PauseTiming();
+    void ResumeTiming();
+
+    /** 한 번 반복할 때 처리하는 항목 수, 기본값은 Size */
+    void SetItemsPerIteration(uint64 InItems) { ItemsPerIteration = InItems; }
+    uint64 GetItemsPerIteration() const { return ItemsPerIteration; }
+
+    uint64 GetIterations() const { return Iterations; }
+    double GetElapsedSeconds() const { return ElapsedSeconds; }
+
+private:
+    using FClock = std::chrono::steady_clock;
+
+    int64 Size;
+    uint64 Iterations;
+    uint64 RemainingIterations;
+    uint64 ItemsPerIteration;
+
+    bool bStarted = false;
+    bool bTiming = false;
+    FClock::time_point StartTime;
+    double ElapsedSeconds = 0.0;
+};
+
+using FBenchmarkFunction = std::function<void(FBenchmarkState&)>;
+
+/**
+ * 케이스 하나, 크기 하나에 대한 측정 결과
+ * 시간은 모두 항목 하나당 나노초
+ */
+struct FBenchmarkResult
+{
+    std::string Name;
+    int64 Size = 0;
+    uint64 Iterations = 0;
+
+    /** 반복(Repetition)마다 잰 값 */
+    std::vector<double> Samples;
+
+    double Median = 0.0;
+    double Mean = 0.0;
+    double Min = 0.0;
+    double Max = 0.0;
+    double StdDev = 0.0;
+
+    /** Median 기준 초당 처리 항목 수 */
+    double ItemsPerSecond = 0.0;
+};
+
+struct FBenchmarkSettings
+{
+    /** 이름에 이 문자열이 들어간 케이스만 실행, 비어 있으면 전부 */
+    std::string Filter;
+
+    /** 반복 한 번이 최소 이만큼 걸리도록 반복 횟수를 늘림 (초) */
+    double MinTime = 0.05;
+
+    /** 같은 케이스를 몇 번 재서 통계를 낼지 */
+    uint32 Repetitions = 5;
+
+    /** 이보다 큰 크기는 건너뜀 */
+    int64 MaxSize = 1 << 20;
+};
+
+/**
+ * 벤치마크 케이스 목록과 실행기
+ */
+class FBenchmarkRunner
+{
+public:
+    /** 케이스를 추가합니다. Sizes의 크기마다 따로 측정됨 */
+    void Register(const std::string& Name, const std::vector<int64>& Sizes, FBenchmarkFunction Function);
+
+    /** 조건에 맞는 케이스를 모두 실행하고, 끝날 때마다 OnResult를 부릅니다. */
+    std::vector<FBenchmarkResult> Run(const FBenchmarkSettings& Settings, const std::function<void(const FBenchmarkResult&)>& OnResult = nullptr) const;
+
+    /** 흔히 쓰는 크기 목록 (1K ~ 1M) */
+    static std::vector<int64> DefaultSizes();
+
+private:
+    struct FCase
+    {
+        std::string Name;
+        std::vector<int64> Sizes;
+        FBenchmarkFunction Function;
+    };
+
+    static FBenchmarkResult RunCase(const FCase& Case, int64 Size, const FBenchmarkSettings& Settings);
+
+private:
+    std::vector<FCase> Cases;
+};
+
+/** 중앙값, Values의 순서가 바뀜 */
+double ComputeMedian(std::vector<double>& Values);
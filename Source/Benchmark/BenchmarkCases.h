@@ -0,0 +1,29 @@
+﻿#pragma once
+
+class FBenchmarkRunner;
+
+
+/** Core/Math 벡터 연산 */
+void RegisterMathBenchmarks(FBenchmarkRunner& Runner);
+
+/** Core/Container TArray */
+void RegisterContainerBenchmarks(FBenchmarkRunner& Runner);
+
+/** UObject 이동과 충돌 처리 */
+void RegisterPhysicsBenchmarks(FBenchmarkRunner& Runner);
+
+/** 인스턴스마다 행렬을 만드는 렌더링 준비 단계 */
+void RegisterRenderBenchmarks(FBenchmarkRunner& Runner);
+
+/** PROFILE_SCOPE 하나의 비용 */
+void RegisterProfilerBenchmarks(FBenchmarkRunner& Runner);
+
+/** 위의 케이스를 모두 등록합니다. */
+inline void RegisterAllBenchmarks(FBenchmarkRunner& Runner)
+{
+    RegisterMathBenchmarks(Runner);
+    RegisterContainerBenchmarks(Runner);
+    RegisterPhysicsBenchmarks(Runner);
+    RegisterRenderBenchmarks(Runner);
+    RegisterProfilerBenchmarks(Runner);
+}
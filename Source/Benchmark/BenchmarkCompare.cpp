@@ -0,0 +1,188 @@
+﻿#include "BenchmarkCompare.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+
+
+namespace
+{
+    using FBenchmarkKey = std::pair<std::string, int64>;
+
+    /** 두 측정값 묶음의 중앙값 변화율에 대한 부트스트랩 신뢰 구간 */
+    void ComputeChangeInterval(const std::vector<double>& Baseline, const std::vector<double>& Current, const FBenchmarkCompareSettings& Settings, double& OutLow, double& OutHigh)
+    {
+        std::mt19937 Random(20240601);
+        std::uniform_int_distribution<size_t> PickBaseline(0, Baseline.size() - 1);
+        std::uniform_int_distribution<size_t> PickCurrent(0, Current.size() - 1);
+
+        std::vector<double> BaselineResample(Baseline.size());
+        std::vector<double> CurrentResample(Current.size());
+        std::vector<double> Changes;
+        Changes.reserve(Settings.NumResamples);
+
+        for (uint32 i = 0; i < Settings.NumResamples; ++i)
+        {
+            for (double& Value : BaselineResample)
+            {
+                Value = Baseline[PickBaseline(Random)];
+            }
+            for (double& Value : CurrentResample)
+            {
+                Value = Current[PickCurrent(Random)];
+            }
+
+            const double BaselineMedian = ComputeMedian(BaselineResample);
+            if (BaselineMedian > 0.0)
+            {
+                Changes.push_back(ComputeMedian(CurrentResample) / BaselineMedian - 1.0);
+            }
+        }
+
+        if (Changes.empty())
+        {
+            OutLow = OutHigh = 0.0;
+            return;
+        }
+
+        std::sort(Changes.begin(), Changes.end());
+        const double Tail = (1.0 - Settings.Confidence) * 0.5;
+        const size_t LowIndex = static_cast<size_t>(Tail * static_cast<double>(Changes.size() - 1));
+        const size_t HighIndex = static_cast<size_t>((1.0 - Tail) * static_cast<double>(Changes.size() - 1));
+        OutLow = Changes[LowIndex];
+        OutHigh = Changes[HighIndex];
+    }
+
+    const char* GetVerdictName(EBenchmarkVerdict Verdict)
+    {
+        switch (Verdict)
+        {
+        case EBenchmarkVerdict::Unchanged: return "ok";
+        case EBenchmarkVerdict::Improved:  return "IMPROVED";
+        case EBenchmarkVerdict::Regressed: return "REGRESSED";
+        case EBenchmarkVerdict::New:       return "new";
+        case EBenchmarkVerdict::Missing:   return "missing";
+        }
+        return "";
+    }
+}
+
+std::vector<FBenchmarkComparison> CompareBenchmarkResults(const std::vector<FBenchmarkResult>& Baseline, const std::vector<FBenchmarkResult>& Current, const FBenchmarkCompareSettings& Settings)
+{
+    std::map<FBenchmarkKey, const FBenchmarkResult*> BaselineByKey;
+    for (const FBenchmarkResult& Result : Baseline)
+    {
+        BaselineByKey[{ Result.Name, Result.Size }] = &Result;
+    }
+
+    std::vector<FBenchmarkComparison> Comparisons;
+    for (const FBenchmarkResult& Result : Current)
+    {
+        FBenchmarkComparison Comparison;
+        Comparison.Name = Result.Name;
+        Comparison.Size = Result.Size;
+        Comparison.CurrentMedian = Result.Median;
+
+        const auto Found = BaselineByKey.find({ Result.Name, Result.Size });
+        if (Found == BaselineByKey.end())
+        {
+            Comparison.Verdict = EBenchmarkVerdict::New;
+            Comparisons.push_back(Comparison);
+            continue;
+        }
+
+        const FBenchmarkResult& Base = *Found->second;
+        BaselineByKey.erase(Found);
+
+        Comparison.BaselineMedian = Base.Median;
+        Comparison.Change = Base.Median > 0.0 ? Result.Median / Base.Median - 1.0 : 0.0;
+
+        bool bSignificant = true;
+        if (Base.Samples.size() > 1 && Result.Samples.size() > 1)
+        {
+            ComputeChangeInterval(Base.Samples, Result.Samples, Settings, Comparison.ChangeLow, Comparison.ChangeHigh);
+            bSignificant = Comparison.ChangeLow > 0.0 || Comparison.ChangeHigh < 0.0;
+        }
+        else
+        {
+            Comparison.ChangeLow = Comparison.ChangeHigh = Comparison.Change;
+        }
+
+        if (bSignificant && Comparison.Change > Settings.Threshold)
+        {
+            Comparison.Verdict = EBenchmarkVerdict::Regressed;
+        }
+        else if (bSignificant && Comparison.Change < -Settings.Threshold)
+        {
+            Comparison.Verdict = EBenchmarkVerdict::Improved;
+        }
+        Comparisons.push_back(Comparison);
+    }
+
+    // 기준에는 있었는데 이번에 안 돌린 케이스, 필터를 걸고 돌리면 흔하므로 실패로 보지 않음
+    for (const FBenchmarkResult& Result : Baseline)
+    {
+        if (BaselineByKey.count({ Result.Name, Result.Size }) > 0)
+        {
+            FBenchmarkComparison Comparison;
+            Comparison.Name = Result.Name;
+            Comparison.Size = Result.Size;
+            Comparison.BaselineMedian = Result.Median;
+            Comparison.Verdict = EBenchmarkVerdict::Missing;
+            Comparisons.push_back(Comparison);
+        }
+    }
+
+    return Comparisons;
+}
+
+std::string FormatBenchmarkComparison(const std::vector<FBenchmarkComparison>& Comparisons, const FBenchmarkCompareSettings& Settings)
+{
+    std::string Report;
+    char Line[256];
+
+    std::snprintf(Line, sizeof(Line), "%-32s %10s %12s %12s %9s %21s  %s\n", "Benchmark", "Size", "Base(ns)", "Current(ns)", "Change", "CI", "Result");
+    Report += Line;
+
+    uint32 Counts[5] = {};
+    for (const FBenchmarkComparison& Comparison : Comparisons)
+    {
+        ++Counts[static_cast<uint8>(Comparison.Verdict)];
+
+        if (Comparison.Verdict == EBenchmarkVerdict::New || Comparison.Verdict == EBenchmarkVerdict::Missing)
+        {
+            char Base[32] = "-";
+            char Current[32] = "-";
+            const bool bNew = Comparison.Verdict == EBenchmarkVerdict::New;
+            std::snprintf(bNew ? Current : Base, 32, "%.3f", bNew ? Comparison.CurrentMedian : Comparison.BaselineMedian);
+            std::snprintf(Line, sizeof(Line), "%-32s %10lld %12s %12s %9s %21s  %s\n",
+                Comparison.Name.c_str(), static_cast<long long>(Comparison.Size), Base, Current, "-", "-", GetVerdictName(Comparison.Verdict));
+        }
+        else
+        {
+            char Interval[32];
+            std::snprintf(Interval, sizeof(Interval), "[%+.1f%%, %+.1f%%]", Comparison.ChangeLow * 100.0, Comparison.ChangeHigh * 100.0);
+            std::snprintf(Line, sizeof(Line), "%-32s %10lld %12.3f %12.3f %+8.1f%% %21s  %s\n",
+                Comparison.Name.c_str(), static_cast<long long>(Comparison.Size), Comparison.BaselineMedian, Comparison.CurrentMedian,
+                Comparison.Change * 100.0, Interval, GetVerdictName(Comparison.Verdict));
+        }
+        Report += Line;
+    }
+
+    std::snprintf(Line, sizeof(Line), "\n%u regressed, %u improved, %u unchanged, %u new, %u missing (threshold %.1f%%, %.0f%% confidence)\n",
+        Counts[static_cast<uint8>(EBenchmarkVerdict::Regressed)], Counts[static_cast<uint8>(EBenchmarkVerdict::Improved)],
+        Counts[static_cast<uint8>(EBenchmarkVerdict::Unchanged)], Counts[static_cast<uint8>(EBenchmarkVerdict::New)],
+        Counts[static_cast<uint8>(EBenchmarkVerdict::Missing)], Settings.Threshold * 100.0, Settings.Confidence * 100.0);
+    Report += Line;
+
+    return Report;
+}
+
+bool HasBenchmarkRegression(const std::vector<FBenchmarkComparison>& Comparisons)
+{
+    return std::any_of(Comparisons.begin(), Comparisons.end(), [](const FBenchmarkComparison& Comparison)
+    {
+        return Comparison.Verdict == EBenchmarkVerdict::Regressed;
+    });
+}
@@ -0,0 +1,61 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+
+
+enum class EBenchmarkVerdict : uint8
+{
+    Unchanged,
+    Improved,
+    Regressed,
+    New,      // 기준 결과에 없던 케이스
+    Missing,  // 이번 결과에 없는 케이스
+};
+
+struct FBenchmarkCompareSettings
+{
+    /** 중앙값이 이 비율 넘게 느려지면 회귀 (0.1 = 10%) */
+    double Threshold = 0.1;
+
+    /** 변화량 신뢰 구간의 신뢰 수준 */
+    double Confidence = 0.95;
+
+    /** 신뢰 구간을 구할 때 부트스트랩 재표본 수 */
+    uint32 NumResamples = 2000;
+};
+
+/**
+ * 케이스 하나, 크기 하나에 대한 비교 결과
+ * Change는 중앙값 변화율 (+0.2 = 20% 느려짐)
+ */
+struct FBenchmarkComparison
+{
+    std::string Name;
+    int64 Size = 0;
+
+    double BaselineMedian = 0.0;
+    double CurrentMedian = 0.0;
+
+    double Change = 0.0;
+    double ChangeLow = 0.0;
+    double ChangeHigh = 0.0;
+
+    EBenchmarkVerdict Verdict = EBenchmarkVerdict::Unchanged;
+};
+
+/**
+ * 두 실행 결과를 (이름, 크기)별로 비교합니다.
+ *
+ * 중앙값 변화가 Threshold를 넘고, 반복별 측정값을 부트스트랩해서 구한 변화량의 신뢰 구간이 0을 포함하지 않을 때만
+ * 회귀나 개선으로 본다. 측정값이 한 개뿐이면 신뢰 구간 없이 중앙값만 비교한다.
+ * 부트스트랩은 고정된 시드를 써서 같은 입력이면 항상 같은 결과가 나온다.
+ */
+std::vector<FBenchmarkComparison> CompareBenchmarkResults(const std::vector<FBenchmarkResult>& Baseline, const std::vector<FBenchmarkResult>& Current, const FBenchmarkCompareSettings& Settings);
+
+/** 사람이 읽을 비교표와 요약 */
+std::string FormatBenchmarkComparison(const std::vector<FBenchmarkComparison>& Comparisons, const FBenchmarkCompareSettings& Settings);
+
+/** 회귀가 하나라도 있는지 */
+bool HasBenchmarkRegression(const std::vector<FBenchmarkComparison>& Comparisons);
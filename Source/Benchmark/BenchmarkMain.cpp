@@ -0,0 +1,169 @@
+﻿#include "BenchmarkMain.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "BenchmarkCases.h"
+#include "BenchmarkCompare.h"
+#include "BenchmarkResultFile.h"
+
+
+namespace
+{
+    /** "--Name=Value" 형태면 Value를 꺼냄 */
+    bool ParseOption(const std::string& Arg, const char* Name, std::string& OutValue)
+    {
+        const std::string Prefix = std::string("--") + Name + "=";
+        if (Arg.compare(0, Prefix.size(), Prefix) != 0)
+        {
+            return false;
+        }
+        OutValue = Arg.substr(Prefix.size());
+        return true;
+    }
+
+    void PrintUsage()
+    {
+        std::printf("Usage: t0 -bench | Benchmark\n");
+        std::printf("       [out.json] [--filter=Name] [--reps=N] [--min-time=Seconds] [--max-size=N]\n");
+        std::printf("       [--baseline=base.json] [--threshold=Percent] [--update-baseline] [--current=result.json]\n");
+    }
+}
+
+int RunBenchmarkMain(const std::vector<std::string>& Args)
+{
+    FBenchmarkSettings Settings;
+    FBenchmarkCompareSettings CompareSettings;
+    std::string OutputPath;
+    std::string BaselinePath;
+    std::string CurrentPath;
+    bool bUpdateBaseline = false;
+
+    for (const std::string& Arg : Args)
+    {
+        std::string Value;
+        if (ParseOption(Arg, "filter", Value))
+        {
+            Settings.Filter = Value;
+        }
+        else if (ParseOption(Arg, "reps", Value))
+        {
+            Settings.Repetitions = static_cast<uint32>(std::strtoul(Value.c_str(), nullptr, 10));
+        }
+        else if (ParseOption(Arg, "min-time", Value))
+        {
+            Settings.MinTime = std::strtod(Value.c_str(), nullptr);
+        }
+        else if (ParseOption(Arg, "max-size", Value))
+        {
+            Settings.MaxSize = std::strtoll(Value.c_str(), nullptr, 10);
+        }
+        else if (ParseOption(Arg, "baseline", Value))
+        {
+            BaselinePath = Value;
+        }
+        else if (ParseOption(Arg, "current", Value))
+        {
+            CurrentPath = Value;
+        }
+        else if (ParseOption(Arg, "threshold", Value))
+        {
+            CompareSettings.Threshold = std::strtod(Value.c_str(), nullptr) / 100.0;
+        }
+        else if (Arg == "--update-baseline")
+        {
+            bUpdateBaseline = true;
+        }
+        else if (Arg.compare(0, 2, "--") == 0 || !OutputPath.empty())
+        {
+            std::printf("Unknown argument: %s\n", Arg.c_str());
+            PrintUsage();
+            return 2;
+        }
+        else
+        {
+            OutputPath = Arg;
+        }
+    }
+
+    if (bUpdateBaseline && BaselinePath.empty())
+    {
+        std::printf("--update-baseline needs --baseline=path\n");
+        return 2;
+    }
+
+    std::vector<FBenchmarkResult> Results;
+    if (!CurrentPath.empty())
+    {
+        // 이미 저장된 결과끼리만 비교
+        if (!LoadBenchmarkResults(CurrentPath, Results))
+        {
+            std::printf("Failed to read %s\n", CurrentPath.c_str());
+            return 2;
+        }
+    }
+    else
+    {
+        FBenchmarkRunner Runner;
+        RegisterAllBenchmarks(Runner);
+
+        std::printf("%-32s %10s %12s %12s %10s %14s\n", "Benchmark", "Size", "Median(ns)", "Min(ns)", "StdDev", "Items/s");
+        Results = Runner.Run(Settings, [](const FBenchmarkResult& Result)
+        {
+            std::printf("%-32s %10lld %12.3f %12.3f %9.1f%% %14.4g\n",
+                Result.Name.c_str(), static_cast<long long>(Result.Size), Result.Median, Result.Min,
+                Result.Mean > 0.0 ? Result.StdDev / Result.Mean * 100.0 : 0.0, Result.ItemsPerSecond);
+            std::fflush(stdout);
+        });
+
+        if (Results.empty())
+        {
+            std::printf("No benchmark matched the filter \"%s\".\n", Settings.Filter.c_str());
+            return 2;
+        }
+    }
+
+    if (!OutputPath.empty())
+    {
+        if (!SaveBenchmarkResults(OutputPath, Settings, Results))
+        {
+            std::printf("Failed to write %s\n", OutputPath.c_str());
+            return 2;
+        }
+        std::printf("Results written to %s\n", OutputPath.c_str());
+    }
+
+    if (bUpdateBaseline)
+    {
+        if (!SaveBenchmarkResults(BaselinePath, Settings, Results))
+        {
+            std::printf("Failed to write %s\n", BaselinePath.c_str());
+            return 2;
+        }
+        std::printf("Baseline updated: %s\n", BaselinePath.c_str());
+        return 0;
+    }
+
+    if (BaselinePath.empty())
+    {
+        return 0;
+    }
+
+    std::vector<FBenchmarkResult> Baseline;
+    if (!LoadBenchmarkResults(BaselinePath, Baseline))
+    {
+        std::printf("Failed to read baseline %s\n", BaselinePath.c_str());
+        return 2;
+    }
+
+    const std::vector<FBenchmarkComparison> Comparisons = CompareBenchmarkResults(Baseline, Results, CompareSettings);
+    std::printf("\nCompared with %s\n%s", BaselinePath.c_str(), FormatBenchmarkComparison(Comparisons, CompareSettings).c_str());
+
+    if (HasBenchmarkRegression(Comparisons))
+    {
+        std::printf("FAILED: performance regression detected\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+
+
+/**
+ * 벤치마크 모드 진입점, 창이나 렌더러 없이 콘솔에서만 동작한다.
+ * t0 -bench와 CMake로 빌드하는 Benchmark 실행 파일이 같은 인자로 부른다.
+ *
+ *     [결과.json] [--filter=이름] [--reps=N] [--min-time=초] [--max-size=N]
+ *     [--baseline=기준.json] [--threshold=퍼센트] [--update-baseline] [--current=결과.json]
+ *
+ * --baseline을 주면 실행 결과를 기준 결과와 비교하고, --update-baseline이면 비교 대신 기준 파일을 덮어쓴다.
+ * --current를 주면 벤치마크를 돌리지 않고 저장된 결과를 기준과 비교만 한다.
+ *
+ * @param Args 프로그램 이름과 벤치마크 스위치를 뺀 나머지 인자
+ * @return 0 성공, 1 성능 회귀, 2 인자나 파일 오류
+ */
+int RunBenchmarkMain(const std::vector<std::string>& Args);
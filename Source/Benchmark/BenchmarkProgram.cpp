@@ -0,0 +1,12 @@
+﻿#include <string>
+#include <vector>
+
+#include "BenchmarkMain.h"
+
+
+/** 창이나 D3D 없이 벤치마크만 담은 실행 파일의 진입점, 인자는 t0 -bench 뒤에 붙이는 것과 같음 */
+int main(int Argc, char** Argv)
+{
+    const std::vector<std::string> Args(Argv + 1, Argv + Argc);
+    return RunBenchmarkMain(Args);
+}
@@ -0,0 +1,135 @@
+﻿#include "BenchmarkResultFile.h"
+
+#include <fstream>
+#include <sstream>
+
+// SimpleJSON은 함수 정의가 헤더에 있어서 한 번역 단위에서만 include 해야 함
+#include "SimpleJSON/Json.h"
+
+
+namespace
+{
+    const char* GetBuildConfiguration()
+    {
+#if defined(NDEBUG)
+        return "Release";
+#else
+        return "Debug";
+#endif
+    }
+
+    const char* GetCompilerName()
+    {
+#if defined(__clang__)
+        return "clang";
+#elif defined(_MSC_VER)
+        return "msvc";
+#elif defined(__GNUC__)
+        return "gcc";
+#else
+        return "unknown";
+#endif
+    }
+
+    /** 소수점이 없는 숫자는 정수로 읽히므로 둘 다 받음 */
+    double ToNumber(const json::JSON& Value)
+    {
+        return Value.JSONType() == json::JSON::Class::Integral ? static_cast<double>(Value.ToInt()) : Value.ToFloat();
+    }
+}
+
+bool SaveBenchmarkResults(const std::string& Path, const FBenchmarkSettings& Settings, const std::vector<FBenchmarkResult>& Results)
+{
+    json::JSON Root = json::Object();
+    Root["version"] = 1;
+    Root["build"] = GetBuildConfiguration();
+    Root["compiler"] = GetCompilerName();
+
+    json::JSON& SettingsJson = Root["settings"];
+    SettingsJson["filter"] = Settings.Filter;
+    SettingsJson["min_time"] = Settings.MinTime;
+    SettingsJson["repetitions"] = Settings.Repetitions;
+    SettingsJson["max_size"] = Settings.MaxSize;
+
+    json::JSON Benchmarks = json::Array();
+    for (const FBenchmarkResult& Result : Results)
+    {
+        json::JSON Entry = json::Object();
+        Entry["name"] = Result.Name;
+        Entry["size"] = Result.Size;
+        Entry["iterations"] = Result.Iterations;
+        Entry["median_ns"] = Result.Median;
+        Entry["mean_ns"] = Result.Mean;
+        Entry["min_ns"] = Result.Min;
+        Entry["max_ns"] = Result.Max;
+        Entry["stddev_ns"] = Result.StdDev;
+        Entry["items_per_second"] = Result.ItemsPerSecond;
+
+        json::JSON Samples = json::Array();
+        for (const double Sample : Result.Samples)
+        {
+            Samples.append(Sample);
+        }
+        Entry["samples_ns"] = Samples;
+
+        Benchmarks.append(Entry);
+    }
+    Root["benchmarks"] = Benchmarks;
+
+    std::ofstream File(Path, std::ios::binary);
+    if (!File)
+    {
+        return false;
+    }
+    File << Root.dump() << '\n';
+    return static_cast<bool>(File);
+}
+
+bool LoadBenchmarkResults(const std::string& Path, std::vector<FBenchmarkResult>& OutResults)
+{
+    std::ifstream File(Path, std::ios::binary);
+    if (!File)
+    {
+        return false;
+    }
+
+    std::stringstream Buffer;
+    Buffer << File.rdbuf();
+
+    json::JSON Root = json::JSON::Load(Buffer.str());
+    if (!Root.hasKey("benchmarks"))
+    {
+        return false;
+    }
+
+    OutResults.clear();
+    for (json::JSON& Entry : Root["benchmarks"].ArrayRange())
+    {
+        if (!Entry.hasKey("name") || !Entry.hasKey("size") || !Entry.hasKey("median_ns"))
+        {
+            return false;
+        }
+
+        FBenchmarkResult Result;
+        Result.Name = Entry["name"].ToString();
+        Result.Size = static_cast<int64>(ToNumber(Entry["size"]));
+        Result.Median = ToNumber(Entry["median_ns"]);
+        Result.Iterations = Entry.hasKey("iterations") ? static_cast<uint64>(ToNumber(Entry["iterations"])) : 0;
+        Result.Mean = Entry.hasKey("mean_ns") ? ToNumber(Entry["mean_ns"]) : Result.Median;
+        Result.Min = Entry.hasKey("min_ns") ? ToNumber(Entry["min_ns"]) : Result.Median;
+        Result.Max = Entry.hasKey("max_ns") ? ToNumber(Entry["max_ns"]) : Result.Median;
+        Result.StdDev = Entry.hasKey("stddev_ns") ? ToNumber(Entry["stddev_ns"]) : 0.0;
+        Result.ItemsPerSecond = Result.Median > 0.0 ? 1.0e9 / Result.Median : 0.0;
+
+        if (Entry.hasKey("samples_ns"))
+        {
+            for (const json::JSON& Sample : Entry["samples_ns"].ArrayRange())
+            {
+                Result.Samples.push_back(ToNumber(Sample));
+            }
+        }
+
+        OutResults.push_back(std::move(Result));
+    }
+    return true;
+}
@@ -0,0 +1,18 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+
+
+/**
+ * 벤치마크 결과를 JSON 파일로 저장합니다.
+ * 케이스마다 이름, 크기, 반복 횟수, 반복별 측정값(항목 하나당 ns)과 그 통계가 들어간다.
+ */
+bool SaveBenchmarkResults(const std::string& Path, const FBenchmarkSettings& Settings, const std::vector<FBenchmarkResult>& Results);
+
+/**
+ * SaveBenchmarkResults로 저장한 파일을 읽습니다.
+ * @return 파일이 없거나 형식이 맞지 않으면 false
+ */
+bool LoadBenchmarkResults(const std::string& Path, std::vector<FBenchmarkResult>& OutResults);
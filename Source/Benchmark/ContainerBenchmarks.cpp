@@ -0,0 +1,426 @@
+﻿#include "BenchmarkCases.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <span>
+#include <unordered_map>
+
+#include "Benchmark.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/InlineArray.h"
+#include "Core/Container/Map.h"
+#include "Core/Container/StaticBitArray.h"
+#include "Core/Memory/FrameArena.h"
+
+
+namespace
+{
+    TArray<int32> MakeRandomArray(int64 Count, uint32 Seed, int32 MaxValue)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_int_distribution<int32> Distribution(0, MaxValue);
+
+        TArray<int32> Array;
+        for (int64 i = 0; i < Count; ++i)
+        {
+            Array.Add(Distribution(Random));
+        }
+        return Array;
+    }
+
+    /** 하나씩 지워 가며 쓸 무작위 위치, i번째 값은 그 시점의 원소 수(Size - i)보다 작음 */
+    TArray<int32> MakeRemoveIndices(int64 Size, int64 Count, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+
+        TArray<int32> Indices;
+        Indices.Reserve(Count);
+        for (int64 i = 0; i < Count; ++i)
+        {
+            Indices.Add(static_cast<int32>(Random() % static_cast<uint32>(Size - i)));
+        }
+        return Indices;
+    }
+
+    /**
+     * 원소 1/16을 무작위로 지우고 다시 채우는 것을 반복 (공 개수를 줄였다 늘리는 경우)
+     * 항목 수는 지운 원소 수
+     */
+    template <typename TRemoveFunction>
+    void RegisterChurnBenchmark(FBenchmarkRunner& Runner, const std::string& Name, const std::vector<int64>& Sizes, const TRemoveFunction& RemoveFunction)
+    {
+        Runner.Register(Name, Sizes, [RemoveFunction](FBenchmarkState& State)
+        {
+            const int64 Size = State.GetSize();
+            const int64 NumChurn = std::max<int64>(Size / 16, 1);
+            const TArray<int32> Indices = MakeRemoveIndices(Size, NumChurn, 1);
+            TArray<int32> Array = MakeRandomArray(Size, 1, 1000);
+            State.SetItemsPerIteration(NumChurn);
+
+            while (State.KeepRunning())
+            {
+                for (const int32 Index : Indices)
+                {
+                    RemoveFunction(Array, Index);
+                }
+                for (int64 i = 0; i < NumChurn; ++i)
+                {
+                    Array.Add(static_cast<int32>(i));
+                }
+                DoNotOptimize(Array.GetData());
+            }
+        });
+    }
+
+    /**
+     * 없는 값을 찾아서 매번 끝까지 훑는 경우를 std::find와 TArray::Find로 비교
+     * TArray::Find는 T가 TIsBitwiseComparable이면 SIMD로 비교함
+     */
+    template <typename T>
+    void RegisterFindBenchmarks(FBenchmarkRunner& Runner, const std::string& TypeName)
+    {
+        const std::vector<int64> Sizes = { 16, 256, 4096, 1 << 16, 1 << 20 };
+
+        Runner.Register("Find.StdFind." + TypeName, Sizes, [](FBenchmarkState& State)
+        {
+            TArray<T> Array;
+            for (const int32 Value : MakeRandomArray(State.GetSize(), 1, 100))
+            {
+                Array.Add(static_cast<T>(Value));
+            }
+            const T Missing = static_cast<T>(101);
+
+            while (State.KeepRunning())
+            {
+                DoNotOptimize(std::find(Array.begin(), Array.end(), Missing));
+            }
+        });
+
+        Runner.Register("Find.TArray." + TypeName, Sizes, [](FBenchmarkState& State)
+        {
+            TArray<T> Array;
+            for (const int32 Value : MakeRandomArray(State.GetSize(), 1, 100))
+            {
+                Array.Add(static_cast<T>(Value));
+            }
+            const T Missing = static_cast<T>(101);
+
+            while (State.KeepRunning())
+            {
+                DoNotOptimize(Array.Find(Missing));
+            }
+        });
+    }
+
+    /** UUID처럼 흩어진 서로 다른 키, 앞의 절반은 맵에 넣고 뒤의 절반은 없는 키로 씀 */
+    TArray<uint32> MakeUniqueKeys(int64 Count, uint32 Seed)
+    {
+        TArray<uint32> Keys;
+        Keys.SetNumUninitialized(Count * 2);
+        std::iota(Keys.begin(), Keys.end(), 1u);
+        std::shuffle(Keys.begin(), Keys.end(), std::mt19937(Seed));
+        for (uint32& Key : Keys)
+        {
+            Key *= 2654435761u;  // 홀수를 곱해서 순서를 흩뜨림, 서로 다른 값은 그대로 서로 다름
+        }
+        return Keys;
+    }
+
+    /**
+     * TMap과 std::unordered_map을 같은 키로 비교
+     * 1K ~ 10M, 10M은 --max-size=10000000을 줘야 실행됨
+     */
+    template <typename TMapType, typename TAddFunction, typename TFindFunction>
+    void RegisterMapBenchmarks(FBenchmarkRunner& Runner, const std::string& MapName, const TAddFunction& AddFunction, const TFindFunction& FindFunction)
+    {
+        const std::vector<int64> Sizes = { 1 << 10, 1 << 14, 1 << 17, 1 << 20, 10'000'000 };
+
+        // 빈 맵에서 시작하므로 재해시 비용도 포함됨
+        Runner.Register("Map.Add." + MapName, Sizes, [AddFunction](FBenchmarkState& State)
+        {
+            const int64 Size = State.GetSize();
+            const TArray<uint32> Keys = MakeUniqueKeys(Size, 1);
+
+            while (State.KeepRunning())
+            {
+                TMapType Map;
+                for (int64 i = 0; i < Size; ++i)
+                {
+                    AddFunction(Map, Keys[i]);
+                }
+                DoNotOptimize(&Map);
+            }
+        });
+
+        // 있는 키와 없는 키를 각각 Size번 찾음
+        for (const bool bHit : { true, false })
+        {
+            Runner.Register(std::string(bHit ? "Map.FindHit." : "Map.FindMiss.") + MapName, Sizes, [AddFunction, FindFunction, bHit](FBenchmarkState& State)
+            {
+                const int64 Size = State.GetSize();
+                const TArray<uint32> Keys = MakeUniqueKeys(Size, 1);
+                TMapType Map;
+                for (int64 i = 0; i < Size; ++i)
+                {
+                    AddFunction(Map, Keys[i]);
+                }
+                const int64 Offset = bHit ? 0 : Size;
+
+                while (State.KeepRunning())
+                {
+                    uint32 Sum = 0;
+                    for (int64 i = 0; i < Size; ++i)
+                    {
+                        Sum += FindFunction(Map, Keys[Offset + i]);
+                    }
+                    DoNotOptimize(Sum);
+                }
+            });
+        }
+    }
+
+    /** 256칸 상태 배열에서 켜진 칸의 번호를 작은 배열에 모음 */
+    template <typename TContainer, typename TAddFunction>
+    void RegisterGatherBenchmark(FBenchmarkRunner& Runner, const std::string& Name, const TAddFunction& AddFunction)
+    {
+        // 눌린 키 수, 16을 넘으면 TInlineArray도 힙으로 넘어감
+        Runner.Register(Name, { 2, 8, 16, 64 }, [AddFunction](FBenchmarkState& State)
+        {
+            bool Keys[256] = {};
+            for (int64 i = 0; i < State.GetSize(); ++i)
+            {
+                Keys[(i * 37) % 256] = true;
+            }
+
+            while (State.KeepRunning())
+            {
+                DoNotOptimize(Keys);
+                TContainer Pressed;
+                for (int32 i = 0; i < 256; ++i)
+                {
+                    if (Keys[i])
+                    {
+                        AddFunction(Pressed, i);
+                    }
+                }
+                DoNotOptimize(&Pressed);
+            }
+        });
+    }
+}
+
+void RegisterContainerBenchmarks(FBenchmarkRunner& Runner)
+{
+    const std::vector<int64> Sizes = FBenchmarkRunner::DefaultSizes();
+
+    // 빈 배열에서 시작하므로 재할당 비용도 포함됨
+    Runner.Register("TArray.Add", Sizes, [](FBenchmarkState& State)
+    {
+        const int32 Count = static_cast<int32>(State.GetSize());
+
+        while (State.KeepRunning())
+        {
+            TArray<int32> Array;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Array.Add(i);
+            }
+            DoNotOptimize(Array.GetData());
+        }
+    });
+
+    // 값이 16종류라 전체의 1/16 정도가 지워짐
+    Runner.Register("TArray.Remove", Sizes, [](FBenchmarkState& State)
+    {
+        const TArray<int32> Source = MakeRandomArray(State.GetSize(), 1, 15);
+        TArray<int32> Array;
+
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            Array = Source;
+            State.ResumeTiming();
+
+            DoNotOptimize(Array.Remove(7));
+        }
+    });
+
+    // 뒤에서부터 하나씩 지움 (원소를 옮기지 않는 가장 싼 경우)
+    Runner.Register("TArray.RemoveAtLast", Sizes, [](FBenchmarkState& State)
+    {
+        const TArray<int32> Source = MakeRandomArray(State.GetSize(), 1, 1000);
+        TArray<int32> Array;
+
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            Array = Source;
+            State.ResumeTiming();
+
+            for (int32 i = static_cast<int32>(Array.Num()) - 1; i >= 0; --i)
+            {
+                Array.RemoveAt(i);
+            }
+            DoNotOptimize(Array.GetData());
+        }
+    });
+
+    // 1M개에서도 지우는 비용이 원소 수와 상관없어야 함
+    RegisterChurnBenchmark(Runner, "TArray.ChurnRemoveAtSwap", Sizes, [](TArray<int32>& Array, int32 Index) { Array.RemoveAtSwap(Index); });
+
+    // 비교용, 지울 때마다 뒤쪽을 모두 당기므로 큰 크기는 너무 오래 걸려서 뺌
+    RegisterChurnBenchmark(Runner, "TArray.ChurnRemoveAt", { 1 << 10, 1 << 14 }, [](TArray<int32>& Array, int32 Index) { Array.RemoveAt(Index); });
+
+    // 미리 확보한 배열에 한 번에 붙임, TArray.Add와 비교
+    Runner.Register("TArray.Append", Sizes, [](FBenchmarkState& State)
+    {
+        const TArray<int32> Source = MakeRandomArray(State.GetSize(), 1, 1000);
+
+        while (State.KeepRunning())
+        {
+            TArray<int32> Array;
+            Array.Append(std::span<const int32>(Source.GetData(), Source.Num()));
+            DoNotOptimize(Array.GetData());
+        }
+    });
+
+    // 0으로 채우지 않고 크기만 잡은 뒤 바로 덮어씀
+    Runner.Register("TArray.SetNumUninitialized", Sizes, [](FBenchmarkState& State)
+    {
+        const int32 Count = static_cast<int32>(State.GetSize());
+
+        while (State.KeepRunning())
+        {
+            TArray<int32> Array;
+            Array.SetNumUninitialized(Count);
+            int32* Data = Array.GetData();
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Data[i] = i;
+            }
+            DoNotOptimize(Array.GetData());
+        }
+    });
+
+    // 없는 값을 찾으므로 매번 끝까지 훑음
+    Runner.Register("TArray.Find", Sizes, [](FBenchmarkState& State)
+    {
+        TArray<int32> Array = MakeRandomArray(State.GetSize(), 1, 1000);
+
+        while (State.KeepRunning())
+        {
+            DoNotOptimize(Array.Find(-1));
+        }
+    });
+
+    RegisterFindBenchmarks<uint8>(Runner, "UInt8");
+    RegisterFindBenchmarks<int32>(Runner, "Int32");
+    RegisterFindBenchmarks<uint64>(Runner, "UInt64");
+
+    RegisterMapBenchmarks<TMap<uint32, uint32>>(Runner, "TMap",
+        [](TMap<uint32, uint32>& Map, uint32 Key) { Map.Add(Key, Key); },
+        [](const TMap<uint32, uint32>& Map, uint32 Key) { const uint32* Value = Map.Find(Key); return Value ? *Value : 0u; });
+    RegisterMapBenchmarks<std::unordered_map<uint32, uint32>>(Runner, "StdUnorderedMap",
+        [](std::unordered_map<uint32, uint32>& Map, uint32 Key) { Map.insert_or_assign(Key, Key); },
+        [](const std::unordered_map<uint32, uint32>& Map, uint32 Key) { const auto It = Map.find(Key); return It != Map.end() ? It->second : 0u; });
+
+    // 프레임 안에서 임시 배열을 만들고 버리는 경우, 아레나는 반복마다 Reset
+    Runner.Register("TempArray.StdVector", { 16, 256, 4096 }, [](FBenchmarkState& State)
+    {
+        const int32 Count = static_cast<int32>(State.GetSize());
+
+        while (State.KeepRunning())
+        {
+            std::vector<int32> Array;
+            Array.reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Array.push_back(i);
+            }
+            DoNotOptimize(Array.data());
+        }
+    });
+
+    Runner.Register("TempArray.TFrameArray", { 16, 256, 4096 }, [](FBenchmarkState& State)
+    {
+        const int32 Count = static_cast<int32>(State.GetSize());
+        FFrameArena& Arena = FFrameArena::Get();
+
+        while (State.KeepRunning())
+        {
+            Arena.Reset();
+            TFrameArray<int32> Array;
+            Array.Reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Array.Add(i);
+            }
+            DoNotOptimize(Array.GetData());
+        }
+    });
+
+    // 프레임마다 작은 배열을 만들었다 버리는 경우, std::vector는 매번 힙 할당
+    RegisterGatherBenchmark<std::vector<int32>>(Runner, "SmallArray.StdVector", [](std::vector<int32>& Array, int32 Value) { Array.push_back(Value); });
+    RegisterGatherBenchmark<TInlineArray<int32, 16>>(Runner, "SmallArray.TInlineArray", [](TInlineArray<int32, 16>& Array, int32 Value) { Array.Add(Value); });
+
+    // 눌린 키 순회, bool 배열은 256칸을 모두 보고 비트 배열은 켜진 비트만 건너뛰며 봄
+    Runner.Register("KeyState.BoolArray", { 2, 8, 16, 64 }, [](FBenchmarkState& State)
+    {
+        bool Keys[256] = {};
+        for (int64 i = 0; i < State.GetSize(); ++i)
+        {
+            Keys[(i * 37) % 256] = true;
+        }
+
+        while (State.KeepRunning())
+        {
+            DoNotOptimize(Keys);
+            uint32 Sum = 0;
+            for (uint32 i = 0; i < 256; ++i)
+            {
+                if (Keys[i])
+                {
+                    Sum += i;
+                }
+            }
+            DoNotOptimize(Sum);
+        }
+    });
+
+    Runner.Register("KeyState.StaticBitArray", { 2, 8, 16, 64 }, [](FBenchmarkState& State)
+    {
+        TStaticBitArray<256> Keys;
+        for (int64 i = 0; i < State.GetSize(); ++i)
+        {
+            Keys.Set(static_cast<uint32>((i * 37) % 256));
+        }
+
+        while (State.KeepRunning())
+        {
+            DoNotOptimize(&Keys);
+            uint32 Sum = 0;
+            for (uint32 Index : Keys)
+            {
+                Sum += Index;
+            }
+            DoNotOptimize(Sum);
+        }
+    });
+
+    Runner.Register("TArray.Sort", Sizes, [](FBenchmarkState& State)
+    {
+        const TArray<int32> Source = MakeRandomArray(State.GetSize(), 1, 1 << 30);
+        TArray<int32> Array;
+
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            Array = Source;
+            State.ResumeTiming();
+
+            Array.Sort();
+            DoNotOptimize(Array.GetData());
+        }
+    });
+}
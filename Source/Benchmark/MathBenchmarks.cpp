@@ -0,0 +1,293 @@
+﻿#include "BenchmarkCases.h"
+
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Transform.h"
+#include "Core/Math/Vector.h"
+#include "Core/Math/Vector4.h"
+#include "Core/Math/VectorKernels.h"
+
+
+namespace
+{
+    template <typename TVector>
+    std::vector<TVector> MakeRandomVectors(int64 Count, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Distribution(-10.0f, 10.0f);
+
+        std::vector<TVector> Vectors(static_cast<size_t>(Count));
+        for (TVector& Vector : Vectors)
+        {
+            Vector.X = Distribution(Random);
+            Vector.Y = Distribution(Random);
+            Vector.Z = Distribution(Random);
+        }
+        return Vectors;
+    }
+
+    /** 회전, 크기, 이동을 섞은 역행렬이 있는 행렬들 */
+    std::vector<FMatrix> MakeRandomMatrices(int64 Count, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> Angle(-3.14f, 3.14f);
+        std::uniform_real_distribution<float> Scale(0.5f, 2.0f);
+
+        std::vector<FMatrix> Matrices(static_cast<size_t>(Count));
+        for (FMatrix& Matrix : Matrices)
+        {
+            const FTransform Transform(
+                FVector(Position(Random), Position(Random), Position(Random)),
+                FVector(Angle(Random), Angle(Random), Angle(Random)),
+                FVector(Scale(Random), Scale(Random), Scale(Random))
+            );
+            Matrix = Transform.ToMatrix();
+        }
+        return Matrices;
+    }
+
+    /** X, Y, Z 채널을 Count개씩 이어 붙인 SoA 배열 */
+    std::vector<float> MakeRandomStreams(int64 Count, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Distribution(-10.0f, 10.0f);
+
+        std::vector<float> Streams(static_cast<size_t>(Count) * 3);
+        for (float& Value : Streams)
+        {
+            Value = Distribution(Random);
+        }
+        return Streams;
+    }
+
+    FVectorSpan MakeVectorSpan(std::vector<float>& Streams)
+    {
+        const size_t Num = Streams.size() / 3;
+        return { std::span(Streams.data(), Num), std::span(Streams.data() + Num, Num), std::span(Streams.data() + Num * 2, Num) };
+    }
+
+    /** FVector.Normalize, FVector.Length와 비교할 수 있게 같은 크기로 등록 */
+    void RegisterVectorKernelBenchmarks(FBenchmarkRunner& Runner)
+    {
+        const std::vector<int64> Sizes = FBenchmarkRunner::DefaultSizes();
+
+        Runner.Register("VectorKernels.DotN", Sizes, [](FBenchmarkState& State)
+        {
+            std::vector<float> A = MakeRandomStreams(State.GetSize(), 1);
+            std::vector<float> B = MakeRandomStreams(State.GetSize(), 2);
+            std::vector<float> Out(static_cast<size_t>(State.GetSize()));
+
+            while (State.KeepRunning())
+            {
+                VectorKernels::DotN(MakeVectorSpan(A), MakeVectorSpan(B), Out);
+                DoNotOptimize(Out.data());
+            }
+        });
+
+        for (const ESqrtMode Mode : { ESqrtMode::Exact, ESqrtMode::Fast })
+        {
+            const std::string Suffix = Mode == ESqrtMode::Exact ? ".Exact" : ".Fast";
+
+            Runner.Register("VectorKernels.LengthN" + Suffix, Sizes, [Mode](FBenchmarkState& State)
+            {
+                std::vector<float> A = MakeRandomStreams(State.GetSize(), 1);
+                std::vector<float> Out(static_cast<size_t>(State.GetSize()));
+
+                while (State.KeepRunning())
+                {
+                    VectorKernels::LengthN(MakeVectorSpan(A), Out, Mode);
+                    DoNotOptimize(Out.data());
+                }
+            });
+
+            Runner.Register("VectorKernels.NormalizeN" + Suffix, Sizes, [Mode](FBenchmarkState& State)
+            {
+                const std::vector<float> Source = MakeRandomStreams(State.GetSize(), 1);
+                std::vector<float> A(Source.size());
+
+                while (State.KeepRunning())
+                {
+                    // 정규화된 벡터를 다시 정규화하지 않도록 원본을 복사 (FVector.Normalize도 입출력 배열이 따로임)
+                    State.PauseTiming();
+                    A = Source;
+                    State.ResumeTiming();
+
+                    VectorKernels::NormalizeN(MakeVectorSpan(A), Mode);
+                    DoNotOptimize(A.data());
+                }
+            });
+        }
+    }
+
+    /** FVector와 FVector4는 같은 함수를 가지므로 같은 케이스를 타입만 바꿔서 등록 */
+    template <typename TVector>
+    void RegisterVectorBenchmarks(FBenchmarkRunner& Runner, const std::string& Prefix)
+    {
+        const std::vector<int64> Sizes = FBenchmarkRunner::DefaultSizes();
+
+        Runner.Register(Prefix + ".Add", Sizes, [](FBenchmarkState& State)
+        {
+            const std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+            const std::vector<TVector> B = MakeRandomVectors<TVector>(State.GetSize(), 2);
+            std::vector<TVector> Out(A.size());
+
+            while (State.KeepRunning())
+            {
+                for (size_t i = 0; i < A.size(); ++i)
+                {
+                    Out[i] = A[i] + B[i];
+                }
+                DoNotOptimize(Out.data());
+            }
+        });
+
+        Runner.Register(Prefix + ".MultiplyAdd", Sizes, [](FBenchmarkState& State)
+        {
+            std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+            const std::vector<TVector> B = MakeRandomVectors<TVector>(State.GetSize(), 2);
+
+            while (State.KeepRunning())
+            {
+                for (size_t i = 0; i < A.size(); ++i)
+                {
+                    A[i] += B[i] * 0.001f;
+                }
+                DoNotOptimize(A.data());
+            }
+        });
+
+        Runner.Register(Prefix + ".Dot", Sizes, [](FBenchmarkState& State)
+        {
+            const std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+            const std::vector<TVector> B = MakeRandomVectors<TVector>(State.GetSize(), 2);
+
+            while (State.KeepRunning())
+            {
+                float Sum = 0.0f;
+                for (size_t i = 0; i < A.size(); ++i)
+                {
+                    Sum += TVector::DotProduct(A[i], B[i]);
+                }
+                DoNotOptimize(Sum);
+            }
+        });
+
+        Runner.Register(Prefix + ".Cross", Sizes, [](FBenchmarkState& State)
+        {
+            const std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+            const std::vector<TVector> B = MakeRandomVectors<TVector>(State.GetSize(), 2);
+            std::vector<TVector> Out(A.size());
+
+            while (State.KeepRunning())
+            {
+                for (size_t i = 0; i < A.size(); ++i)
+                {
+                    Out[i] = TVector::CrossProduct(A[i], B[i]);
+                }
+                DoNotOptimize(Out.data());
+            }
+        });
+
+        Runner.Register(Prefix + ".Length", Sizes, [](FBenchmarkState& State)
+        {
+            const std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+
+            while (State.KeepRunning())
+            {
+                float Sum = 0.0f;
+                for (const TVector& Vector : A)
+                {
+                    Sum += Vector.Length();
+                }
+                DoNotOptimize(Sum);
+            }
+        });
+
+        Runner.Register(Prefix + ".Normalize", Sizes, [](FBenchmarkState& State)
+        {
+            const std::vector<TVector> A = MakeRandomVectors<TVector>(State.GetSize(), 1);
+            std::vector<TVector> Out(A.size());
+
+            while (State.KeepRunning())
+            {
+                for (size_t i = 0; i < A.size(); ++i)
+                {
+                    Out[i] = A[i].Normalize();
+                }
+                DoNotOptimize(Out.data());
+            }
+        });
+    }
+}
+
+void RegisterMathBenchmarks(FBenchmarkRunner& Runner)
+{
+    RegisterVectorBenchmarks<FVector>(Runner, "FVector");
+    RegisterVectorBenchmarks<FVector4>(Runner, "FVector4");
+    RegisterVectorKernelBenchmarks(Runner);
+
+    const std::vector<int64> Sizes = FBenchmarkRunner::DefaultSizes();
+
+    Runner.Register("FMatrix.Multiply", Sizes, [](FBenchmarkState& State)
+    {
+        const std::vector<FMatrix> A = MakeRandomMatrices(State.GetSize(), 1);
+        const std::vector<FMatrix> B = MakeRandomMatrices(State.GetSize(), 2);
+        std::vector<FMatrix> Out(A.size());
+
+        while (State.KeepRunning())
+        {
+            for (size_t i = 0; i < A.size(); ++i)
+            {
+                Out[i] = A[i] * B[i];
+            }
+            DoNotOptimize(Out.data());
+        }
+    });
+
+    Runner.Register("FMatrix.Inverse", Sizes, [](FBenchmarkState& State)
+    {
+        const std::vector<FMatrix> A = MakeRandomMatrices(State.GetSize(), 1);
+        std::vector<FMatrix> Out(A.size());
+
+        while (State.KeepRunning())
+        {
+            for (size_t i = 0; i < A.size(); ++i)
+            {
+                Out[i] = A[i].Inverse();
+            }
+            DoNotOptimize(Out.data());
+        }
+    });
+
+    Runner.Register("FMatrix.TransformPosition", Sizes, [](FBenchmarkState& State)
+    {
+        const FMatrix Matrix = MakeRandomMatrices(1, 1)[0];
+        const std::vector<FVector> In = MakeRandomVectors<FVector>(State.GetSize(), 2);
+        std::vector<FVector> Out(In.size());
+
+        while (State.KeepRunning())
+        {
+            for (size_t i = 0; i < In.size(); ++i)
+            {
+                Out[i] = Matrix.TransformPosition(In[i]);
+            }
+            DoNotOptimize(Out.data());
+        }
+    });
+
+    Runner.Register("FTransform.TransformPositions", Sizes, [](FBenchmarkState& State)
+    {
+        const FTransform Transform(FVector(1.0f, 2.0f, 3.0f), FVector(0.3f, -1.1f, 2.0f), FVector(0.5f, 1.5f, 2.0f));
+        const std::vector<FVector> In = MakeRandomVectors<FVector>(State.GetSize(), 2);
+        std::vector<FVector> Out(In.size());
+
+        while (State.KeepRunning())
+        {
+            Transform.TransformPositions(In.data(), Out.data(), In.size());
+            DoNotOptimize(Out.data());
+        }
+    });
+}
@@ -0,0 +1,104 @@
+﻿#include "BenchmarkCases.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "UObject.h"
+
+
+namespace
+{
+    /** UObject 생성자가 rand()를 쓰므로 시드를 고정해서 실행마다 같은 배치를 만듦 */
+    std::vector<UObject> MakeBalls(int64 Count)
+    {
+        srand(1234);
+        return std::vector<UObject>(static_cast<size_t>(Count));
+    }
+
+    std::vector<FVector> GetVelocities(const std::vector<UObject>& Balls)
+    {
+        std::vector<FVector> Velocities;
+        Velocities.reserve(Balls.size());
+        for (const UObject& Ball : Balls)
+        {
+            Velocities.push_back(Ball.Velocity);
+        }
+        return Velocities;
+    }
+
+    void SetVelocities(std::vector<UObject>& Balls, const std::vector<FVector>& Velocities)
+    {
+        for (size_t i = 0; i < Balls.size(); ++i)
+        {
+            Balls[i].Velocity = Velocities[i];
+        }
+    }
+}
+
+void RegisterPhysicsBenchmarks(FBenchmarkRunner& Runner)
+{
+    const std::vector<int64> Sizes = FBenchmarkRunner::DefaultSizes();
+
+    Runner.Register("UObject.Update", Sizes, [](FBenchmarkState& State)
+    {
+        std::vector<UObject> Balls = MakeBalls(State.GetSize());
+
+        while (State.KeepRunning())
+        {
+            for (UObject& Ball : Balls)
+            {
+                Ball.Update(1.0f / 60.0f);
+            }
+            DoNotOptimize(Balls.data());
+        }
+    });
+
+    // 반복할수록 속도가 줄어 비정규 부동소수점 영역으로 떨어지지 않도록 매번 속도를 되돌림
+    Runner.Register("UObject.HandleWallCollision", Sizes, [](FBenchmarkState& State)
+    {
+        std::vector<UObject> Balls = MakeBalls(State.GetSize());
+        const std::vector<FVector> InitialVelocities = GetVelocities(Balls);
+        const FVector Normals[] = { FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) };
+
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            SetVelocities(Balls, InitialVelocities);
+            State.ResumeTiming();
+
+            for (size_t i = 0; i < Balls.size(); ++i)
+            {
+                Balls[i].HandleWallCollision(Normals[i % 3]);
+            }
+            DoNotOptimize(Balls.data());
+        }
+    });
+
+    // 이웃한 두 공을 맞닿게 놓고 서로 다가가는 속도를 줘서 충격량 계산까지 항상 타게 함
+    Runner.Register("UObject.HandleBallCollision", Sizes, [](FBenchmarkState& State)
+    {
+        std::vector<UObject> Balls = MakeBalls(State.GetSize() * 2);
+        for (size_t i = 0; i + 1 < Balls.size(); i += 2)
+        {
+            Balls[i + 1].Location = Balls[i].Location + FVector(Balls[i].Radius + Balls[i + 1].Radius, 0.0f, 0.0f);
+            Balls[i].Velocity.X = std::abs(Balls[i].Velocity.X) + 0.1f;
+            Balls[i + 1].Velocity.X = -std::abs(Balls[i + 1].Velocity.X) - 0.1f;
+        }
+
+        const std::vector<FVector> InitialVelocities = GetVelocities(Balls);
+
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            SetVelocities(Balls, InitialVelocities);
+            State.ResumeTiming();
+
+            for (size_t i = 0; i + 1 < Balls.size(); i += 2)
+            {
+                Balls[i].HandleBallCollision(Balls[i + 1]);
+            }
+            DoNotOptimize(Balls.data());
+        }
+    });
+}
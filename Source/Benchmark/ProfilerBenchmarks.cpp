@@ -0,0 +1,58 @@
+﻿#include "BenchmarkCases.h"
+
+#include "Benchmark.h"
+#include "Core/Profiler/Profiler.h"
+
+
+namespace
+{
+    /** 빈 스코프를 Size번 열고 닫음, 항목 하나당 시간이 곧 스코프 하나의 비용 */
+    void RunScopes(FBenchmarkState& State, bool bEnabled)
+    {
+        // 스레드 버퍼 등록은 처음 한 번뿐이므로 측정에서 뺌
+        FProfiler::GetThreadBuffer();
+        const bool bWasEnabled = FProfiler::IsEnabled();
+        FProfiler::SetEnabled(bEnabled);
+
+        const int64 Count = State.GetSize();
+        while (State.KeepRunning())
+        {
+            for (int64 Index = 0; Index < Count; ++Index)
+            {
+                FProfileScope Scope("Benchmark.Scope");
+                DoNotOptimize(Index);
+            }
+        }
+
+        FProfiler::SetEnabled(bWasEnabled);
+    }
+}
+
+void RegisterProfilerBenchmarks(FBenchmarkRunner& Runner)
+{
+    // PROFILE_SCOPE는 WITH_PROFILER가 0이면 사라지므로 FProfileScope를 직접 씀
+    const std::vector<int64> Sizes = { 1 << 10, 1 << 16 };
+
+    Runner.Register("Profiler.Scope.Enabled", Sizes, [](FBenchmarkState& State)
+    {
+        RunScopes(State, true);
+    });
+
+    Runner.Register("Profiler.Scope.Disabled", Sizes, [](FBenchmarkState& State)
+    {
+        RunScopes(State, false);
+    });
+
+    // 켜진 스코프는 시각을 두 번 읽으므로 이 값의 두 배가 하한
+    Runner.Register("Profiler.ReadTicks", Sizes, [](FBenchmarkState& State)
+    {
+        const int64 Count = State.GetSize();
+        while (State.KeepRunning())
+        {
+            for (int64 Index = 0; Index < Count; ++Index)
+            {
+                DoNotOptimize(FProfiler::ReadTicks());
+            }
+        }
+    });
+}
@@ -0,0 +1,109 @@
+﻿#include "BenchmarkCases.h"
+
+#include <cstdlib>
+#include <random>
+
+#include "Benchmark.h"
+#include "UObject.h"
+#include "Core/Math/Matrix.h"
+
+#if __has_include(<DirectXMath.h>)
+#include <DirectXMath.h>
+#define BENCHMARK_WITH_DIRECTXMATH 1
+#else
+#define BENCHMARK_WITH_DIRECTXMATH 0
+#endif
+
+
+namespace
+{
+    std::vector<FObjectRenderState> MakeRenderStates(int64 Count)
+    {
+        std::mt19937 Random(1);
+        std::uniform_real_distribution<float> Position(-20.0f, 20.0f);
+        std::uniform_real_distribution<float> Angle(-3.14f, 3.14f);
+
+        std::vector<FObjectRenderState> States(static_cast<size_t>(Count));
+        for (FObjectRenderState& State : States)
+        {
+            State.Location = FVector(Position(Random), Position(Random), Position(Random));
+            State.Rotation = FVector(Angle(Random), Angle(Random), Angle(Random));
+            State.Radius = 0.1f;
+        }
+        return States;
+    }
+}
+
+void RegisterRenderBenchmarks(FBenchmarkRunner& Runner)
+{
+    // URenderer::UpdateInstance의 일반 경로와 같은 계산 (World * View * Proj 후 전치)
+    Runner.Register("Render.BuildInstanceMatrices", FBenchmarkRunner::DefaultSizes(), [](FBenchmarkState& State)
+    {
+        const std::vector<FObjectRenderState> States = MakeRenderStates(State.GetSize());
+        std::vector<FMatrix> Instances;
+        Instances.reserve(States.size());
+
+        const FMatrix ViewMatrix = FMatrix::LookAtLH(FVector(0.0f, 0.0f, -5.0f), FVector(), FVector(0.0f, 1.0f, 0.0f));
+        const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(3.14159265f / 4.0f, 1.0f, 0.1f, 100.0f);
+
+        while (State.KeepRunning())
+        {
+            Instances.clear();
+            for (const FObjectRenderState& Target : States)
+            {
+                const FMatrix WorldMatrix = FMatrix::MakeTranslation(Target.Location) * FMatrix::MakeRotation(Target.Rotation) * FMatrix::MakeScale(Target.Radius);
+                Instances.push_back((WorldMatrix * ViewMatrix * ProjMatrix).Transpose());
+            }
+            DoNotOptimize(Instances.data());
+        }
+    });
+
+#if BENCHMARK_WITH_DIRECTXMATH
+    // 위 케이스를 DirectXMath로 계산, FMatrix와 비교용
+    Runner.Register("Render.BuildInstanceMatricesDirectXMath", FBenchmarkRunner::DefaultSizes(), [](FBenchmarkState& State)
+    {
+        using namespace DirectX;
+
+        const std::vector<FObjectRenderState> States = MakeRenderStates(State.GetSize());
+        std::vector<XMMATRIX> Instances;
+        Instances.reserve(States.size());
+
+        const XMMATRIX ViewMatrix = XMMatrixLookAtLH(XMVectorSet(0.0f, 0.0f, -5.0f, 1.0f), XMVectorZero(), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+        const XMMATRIX ProjMatrix = XMMatrixPerspectiveFovLH(XM_PIDIV4, 1.0f, 0.1f, 100.0f);
+
+        while (State.KeepRunning())
+        {
+            Instances.clear();
+            for (const FObjectRenderState& Target : States)
+            {
+                const XMMATRIX ScaleMatrix = XMMatrixScaling(Target.Radius, Target.Radius, Target.Radius);
+                const XMMATRIX RotationMatrix = XMMatrixRotationRollPitchYaw(Target.Rotation.X, Target.Rotation.Y, Target.Rotation.Z);
+                const XMMATRIX TranslationMatrix = XMMatrixTranslation(Target.Location.X, Target.Location.Y, Target.Location.Z);
+                const XMMATRIX WorldMatrix = TranslationMatrix * RotationMatrix * ScaleMatrix;
+
+                Instances.push_back(XMMatrixTranspose(WorldMatrix * ViewMatrix * ProjMatrix));
+            }
+            DoNotOptimize(Instances.data());
+        }
+    });
+#endif
+
+    // 시뮬레이션 스냅샷을 만들 때마다 하는 상태 복사
+    Runner.Register("Render.GatherRenderStates", FBenchmarkRunner::DefaultSizes(), [](FBenchmarkState& State)
+    {
+        srand(1234);
+        const std::vector<UObject> Balls(static_cast<size_t>(State.GetSize()));
+        std::vector<FObjectRenderState> States;
+        States.reserve(Balls.size());
+
+        while (State.KeepRunning())
+        {
+            States.clear();
+            for (const UObject& Ball : Balls)
+            {
+                States.push_back(Ball.GetRenderState());
+            }
+            DoNotOptimize(States.data());
+        }
+    });
+}
@@ -0,0 +1,12 @@
+# 벤치마크 실행 파일의 종료 코드가 기대한 값인지 확인 (ctest에서 사용)
+#
+#   cmake -DBENCHMARK=<실행 파일> -DEXPECTED=<0|1|2> -DARGS=<인자들, 공백으로 구분> -P ExpectExitCode.cmake
+#
+# 종료 코드: 0 성공, 1 성능 회귀, 2 인자나 파일 오류
+
+separate_arguments(BenchmarkArgs NATIVE_COMMAND "${ARGS}")
+execute_process(COMMAND "${BENCHMARK}" ${BenchmarkArgs} RESULT_VARIABLE ExitCode)
+
+if(NOT ExitCode STREQUAL EXPECTED)
+    message(FATAL_ERROR "Benchmark ${ARGS} exited with ${ExitCode}, expected ${EXPECTED}")
+endif()
@@ -0,0 +1,107 @@
+﻿#pragma once
+#include <atomic>
+#include <type_traits>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 락 없는 고정 크기 MPSC 큐
+ * 여러 생산자 스레드가 Push하고, 소비자 스레드 하나가 Pop한다.
+ * 칸마다 순번을 두어 생산자끼리는 쓰기 위치만 CAS로 나눠 갖고, 소비자는 원자 RMW 없이 읽는다.
+ * 생성 뒤에는 힙 할당이 없으며, 가득 차면 Push가 실패한다.
+ *
+ * @param Capacity 2의 거듭제곱
+ */
+template <typename T, uint32 Capacity>
+class TMpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "T is copied without synchronization of its own");
+
+public:
+    TMpscQueue()
+    {
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    TMpscQueue(const TMpscQueue&) = delete;
+    TMpscQueue& operator=(const TMpscQueue&) = delete;
+
+    /**
+     * 아무 스레드에서나 호출
+     * @return 가득 차서 넣지 못했으면 false
+     */
+    bool Push(const T& Item)
+    {
+        uint32 Position = EnqueuePosition.load(std::memory_order_relaxed);
+        FCell* Cell;
+        for (;;)
+        {
+            Cell = &Cells[Position & Mask];
+            const uint32 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+            const int32 Difference = static_cast<int32>(Sequence - Position);
+            if (Difference == 0)
+            {
+                // 이 칸이 비어 있으면 위치를 선점, 실패하면 Position이 최신 값으로 바뀜
+                if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Difference < 0)
+            {
+                // 소비자가 아직 한 바퀴 전의 값을 꺼내지 않음
+                return false;
+            }
+            else
+            {
+                Position = EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        Cell->Value = Item;
+        Cell->Sequence.store(Position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * 소비자 스레드 전용
+     * 위치를 선점했지만 아직 다 쓰지 않은 생산자가 있으면 그 앞까지만 꺼낸다.
+     * @return 꺼낼 값이 없으면 false
+     */
+    bool Pop(T& OutItem)
+    {
+        FCell& Cell = Cells[DequeuePosition & Mask];
+        const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+        if (static_cast<int32>(Sequence - (DequeuePosition + 1)) < 0)
+        {
+            return false;
+        }
+
+        OutItem = Cell.Value;
+        Cell.Sequence.store(DequeuePosition + Capacity, std::memory_order_release);
+        ++DequeuePosition;
+        return true;
+    }
+
+    static constexpr uint32 GetCapacity() { return Capacity; }
+
+private:
+    static constexpr uint32 Mask = Capacity - 1;
+
+    struct FCell
+    {
+        std::atomic<uint32> Sequence;  // Position과 같으면 빈 칸, Position + 1이면 값이 있음
+        T Value;
+    };
+
+    FCell Cells[Capacity];
+
+    // 생산자와 소비자가 같은 캐시 라인을 두고 다투지 않도록 떨어뜨림
+    alignas(64) std::atomic<uint32> EnqueuePosition = 0;
+    alignas(64) uint32 DequeuePosition = 0;
+};
@@ -0,0 +1,126 @@
+﻿#include "TaskPool.h"
+
+#include "Core/Profiler/Profiler.h"
+
+
+FTaskPool::FTaskPool(uint32 NumWorkers)
+{
+    if (NumWorkers == 0)
+    {
+        const uint32 HardwareThreads = std::thread::hardware_concurrency();
+        NumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+    }
+
+    Workers.reserve(NumWorkers);
+    for (uint32 i = 0; i < NumWorkers; ++i)
+    {
+        Workers.emplace_back(&FTaskPool::WorkerLoop, this);
+    }
+}
+
+FTaskPool::~FTaskPool()
+{
+    {
+        std::lock_guard Lock(Mutex);
+        bStop = true;
+    }
+    WakeCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+}
+
+void FTaskPool::ParallelFor(uint32 InNumTasks, const std::function<void(uint32)>& Task)
+{
+    if (InNumTasks == 0)
+    {
+        return;
+    }
+
+    if (InNumTasks == 1 || Workers.empty())
+    {
+        for (uint32 i = 0; i < InNumTasks; ++i)
+        {
+            Task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard Lock(Mutex);
+        CurrentTask = &Task;
+        NumTasks = InNumTasks;
+        NextTask = 0;
+        NumCompleted = 0;
+        ++Generation;
+    }
+    WakeCondition.notify_all();
+
+    // 호출 스레드도 작업을 가져가서 처리
+    RunTasks(Task, InNumTasks);
+
+    // 작업을 가져간 워커가 모두 빠져나올 때까지 기다려야 다음 ParallelFor와 섞이지 않음
+    std::unique_lock Lock(Mutex);
+    DoneCondition.wait(Lock, [this] { return NumCompleted.load() == NumTasks && NumActiveWorkers == 0; });
+    CurrentTask = nullptr;
+}
+
+void FTaskPool::WorkerLoop()
+{
+    PROFILE_THREAD_NAME("Task Worker");
+
+    uint64 SeenGeneration = 0;
+    while (true)
+    {
+        const std::function<void(uint32)>* Task;
+        uint32 TaskCount;
+        {
+            std::unique_lock Lock(Mutex);
+            WakeCondition.wait(Lock, [this, SeenGeneration] { return bStop || Generation != SeenGeneration; });
+            if (bStop)
+            {
+                return;
+            }
+            SeenGeneration = Generation;
+
+            // 늦게 깨어나서 이미 끝난 작업이면 다음 작업을 기다림
+            if (!CurrentTask)
+            {
+                continue;
+            }
+            Task = CurrentTask;
+            TaskCount = NumTasks;
+            ++NumActiveWorkers;
+        }
+
+        RunTasks(*Task, TaskCount);
+
+        {
+            std::lock_guard Lock(Mutex);
+            --NumActiveWorkers;
+        }
+        DoneCondition.notify_all();
+    }
+}
+
+void FTaskPool::RunTasks(const std::function<void(uint32)>& Task, uint32 InNumTasks)
+{
+    while (true)
+    {
+        const uint32 Index = NextTask.fetch_add(1);
+        if (Index >= InNumTasks)
+        {
+            return;
+        }
+
+        Task(Index);
+
+        if (NumCompleted.fetch_add(1) + 1 == InNumTasks)
+        {
+            std::lock_guard Lock(Mutex);
+            DoneCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,57 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 고정된 수의 워커 스레드를 유지하는 간단한 작업 풀
+ * ParallelFor를 호출한 스레드도 작업에 참여하며, 모든 작업이 끝날 때까지 반환하지 않는다.
+ */
+class FTaskPool
+{
+public:
+    /** @param NumWorkers 호출 스레드를 제외한 워커 수, 0이면 하드웨어 스레드 수 - 1 */
+    explicit FTaskPool(uint32 NumWorkers = 0);
+    ~FTaskPool();
+
+    FTaskPool(const FTaskPool&) = delete;
+    FTaskPool& operator=(const FTaskPool&) = delete;
+
+    /**
+     * [0, NumTasks) 범위의 작업을 병렬로 실행합니다.
+     * @param NumTasks 작업 수
+     * @param Task 작업 인덱스를 받는 함수, 서로 다른 스레드에서 동시에 호출됨
+     */
+    void ParallelFor(uint32 NumTasks, const std::function<void(uint32)>& Task);
+
+    /** 호출 스레드를 포함해 동시에 실행될 수 있는 스레드 수 */
+    uint32 GetNumThreads() const { return static_cast<uint32>(Workers.size()) + 1; }
+
+private:
+    void WorkerLoop();
+    void RunTasks(const std::function<void(uint32)>& Task, uint32 InNumTasks);
+
+private:
+    std::vector<std::thread> Workers;
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable DoneCondition;
+
+    // CurrentTask, NumTasks, NumActiveWorkers는 Mutex로 보호, 워커는 잠근 채로 복사해서 씀
+    const std::function<void(uint32)>* CurrentTask = nullptr;
+    uint32 NumTasks = 0;
+    std::atomic<uint32> NextTask = 0;
+    std::atomic<uint32> NumCompleted = 0;
+
+    /** 이번 작업을 가져간 뒤 아직 RunTasks에서 나오지 않은 워커 수 */
+    uint32 NumActiveWorkers = 0;
+    uint64 Generation = 0;
+    bool bStop = false;
+};
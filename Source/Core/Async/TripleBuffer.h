@@ -0,0 +1,75 @@
+﻿#pragma once
+#include <atomic>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 락 없는 Triple Buffer
+ * 생산자 스레드 하나와 소비자 스레드 하나 사이에서 최신 값을 주고받는다.
+ * 생산자는 쓰기 버퍼를 채운 뒤 Publish하고, 소비자는 Consume으로 가장 최근에 Publish된 값을 얻는다.
+ * 양쪽 모두 서로를 기다리지 않으며, 소비자가 보는 값은 항상 Publish가 끝난 완전한 값이다.
+ */
+template <typename T>
+class TTripleBuffer
+{
+public:
+    TTripleBuffer() = default;
+
+    TTripleBuffer(const TTripleBuffer&) = delete;
+    TTripleBuffer& operator=(const TTripleBuffer&) = delete;
+
+    /** 생산자 전용: 다음에 Publish할 버퍼 */
+    T& GetWriteBuffer() { return Buffers[WriteIndex]; }
+
+    /** 생산자 전용: 쓰기 버퍼를 공개하고 새 쓰기 버퍼를 받습니다. */
+    void Publish()
+    {
+        const uint8 Old = Middle.exchange(static_cast<uint8>(WriteIndex | DirtyBit), std::memory_order_acq_rel);
+        WriteIndex = Old & IndexMask;
+    }
+
+    /**
+     * 소비자 전용: 새로 Publish된 값이 있으면 읽기 버퍼와 교체합니다.
+     * @return 새 값으로 교체되었으면 true
+     */
+    bool Consume()
+    {
+        if ((Middle.load(std::memory_order_relaxed) & DirtyBit) == 0)
+        {
+            return false;
+        }
+
+        const uint8 Old = Middle.exchange(ReadIndex, std::memory_order_acq_rel);
+        ReadIndex = Old & IndexMask;
+        return true;
+    }
+
+    /** 소비자 전용: 마지막으로 Consume한 값 */
+    const T& GetReadBuffer() const { return Buffers[ReadIndex]; }
+
+    /**
+     * 스레드를 시작하기 전에 세 버퍼를 모두 같은 값으로 초기화합니다.
+     * @note 생산자/소비자가 동작 중일 때 호출하면 안됨
+     */
+    void Reset(const T& Value)
+    {
+        for (T& Buffer : Buffers)
+        {
+            Buffer = Value;
+        }
+        WriteIndex = 0;
+        Middle.store(1, std::memory_order_relaxed);
+        ReadIndex = 2;
+    }
+
+private:
+    static constexpr uint8 DirtyBit = 0x4;
+    static constexpr uint8 IndexMask = 0x3;
+
+    T Buffers[3];
+
+    uint8 WriteIndex = 0;           // 생산자만 접근
+    std::atomic<uint8> Middle = 1;  // 공유 슬롯 인덱스 | DirtyBit
+    uint8 ReadIndex = 2;            // 소비자만 접근
+};
@@ -1,38 +1,143 @@
 ﻿#pragma once
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "Core/Container/ArraySearch.h"
 #include "Core/HAL/PlatformType.h"
 
 
-template <typename T>
-class TArray : protected std::vector<T>
+/**
+ * 인자 없는 construct를 값 초기화 대신 기본 초기화로 바꾸는 할당자 어댑터
+ * std::vector::resize가 int, float 같은 타입을 0으로 채우지 않게 해서 SetNumUninitialized를 가능하게 한다.
+ * 나머지는 모두 감싼 할당자에 넘긴다.
+ */
+template <typename Allocator>
+class TDefaultInitAllocator : public Allocator
 {
+    using Traits = std::allocator_traits<Allocator>;
+
 public:
+    using propagate_on_container_copy_assignment = typename Traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename Traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename Traits::propagate_on_container_swap;
+    using is_always_equal = typename Traits::is_always_equal;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TDefaultInitAllocator<typename Traits::template rebind_alloc<U>>;
+    };
+
+    TDefaultInitAllocator() = default;
+    TDefaultInitAllocator(const Allocator& InAllocator) : Allocator(InAllocator) {}
+
+    template <typename OtherAllocator>
+    TDefaultInitAllocator(const TDefaultInitAllocator<OtherAllocator>& Other) : Allocator(static_cast<const OtherAllocator&>(Other)) {}
+
+    TDefaultInitAllocator select_on_container_copy_construction() const
+    {
+        return TDefaultInitAllocator(Traits::select_on_container_copy_construction(*this));
+    }
+
+    template <typename U>
+    void construct(U* Ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new (static_cast<void*>(Ptr)) U;
+    }
+
+    template <typename U, typename... ArgTypes>
+    void construct(U* Ptr, ArgTypes&&... Args)
+    {
+        Traits::construct(static_cast<Allocator&>(*this), Ptr, std::forward<ArgTypes>(Args)...);
+    }
+
+    bool operator==(const TDefaultInitAllocator& Other) const
+    {
+        return static_cast<const Allocator&>(*this) == static_cast<const Allocator&>(Other);
+    }
+};
+
+/**
+ * 동적 배열
+ * @tparam Allocator 메모리를 받아올 곳, std::allocator와 같은 인터페이스면 된다. (TInlineAllocator 등)
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class TArray : protected std::vector<T, TDefaultInitAllocator<Allocator>>
+{
+    using Super = std::vector<T, TDefaultInitAllocator<Allocator>>;
+
+public:
+    using AllocatorType = Allocator;
+
     // Iterator를 사용하기 위함
-    using std::vector<T>::begin;
-    using std::vector<T>::end;
-    using std::vector<T>::rbegin;
-    using std::vector<T>::rend;
-    using std::vector<T>::operator[];
+    using Super::begin;
+    using Super::end;
+    using Super::rbegin;
+    using Super::rend;
+    using Super::operator[];
 
 public:
+    TArray() = default;
+    explicit TArray(const Allocator& InAllocator) : Super(InAllocator) {}
+
     void Init(const T& Element, size_t Number);
     void Add(const T& Item);
+    void Add(T&& Item);
     void AddUnique(const T& Item);
-    void Emplace(T&& Item);
+
+    /** 배열 끝에서 바로 생성 */
+    template <typename... ArgTypes>
+    T& Emplace(ArgTypes&&... Args);
+
+    /** 뒤에 복사해서 붙임 */
+    void Append(std::span<const T> Items);
+
+    /** Other의 원소를 뒤로 옮기고 Other는 비움 */
+    void Append(TArray&& Other);
+
     void Empty();
+
+    /** 원소 수는 그대로 두고 Number개까지 재할당 없이 넣을 수 있게 합니다. */
+    void Reserve(size_t Number);
+
+    /**
+     * 원소 수를 바꿉니다. 늘어난 원소는 기본 초기화되므로 int, float 같은 타입은 값이 정해지지 않는다.
+     * 바로 덮어쓸 버퍼를 만들 때 0으로 채우는 비용을 없애기 위해 사용한다.
+     */
+    void SetNumUninitialized(size_t NewNum);
+
     int32 Remove(const T& Item);
     bool RemoveSingle(const T& Item);
+
+    /** 순서를 유지하며 지움, 뒤쪽 원소를 모두 당기므로 O(n) */
     void RemoveAt(int32 Index);
+
+    /** 마지막 원소를 Index 자리로 옮기고 지움, 순서가 바뀌는 대신 O(1) */
+    void RemoveAtSwap(int32 Index);
+
     template <typename Predicate>
         requires std::is_invocable_r_v<bool, Predicate, const T&>
     int32 RemoveAll(const Predicate& Pred);
+
+    /** RemoveAtSwap으로 조건에 맞는 원소를 모두 지움, 순서는 유지되지 않음 */
+    template <typename Predicate>
+        requires std::is_invocable_r_v<bool, Predicate, const T&>
+    int32 RemoveAllSwap(const Predicate& Pred);
+
     T* GetData();
+    const T* GetData() const;
 
-    int32 Find(const T& Item);
-    bool Find(const T& Item, int32& Index);
+    /**
+     * Item과 같은 첫 원소의 위치, 없으면 -1
+     * 정수, 열거형, 포인터처럼 TIsBitwiseComparable인 타입은 SIMD로 여러 원소를 한 번에 비교한다.
+     */
+    int32 Find(const T& Item) const;
+    bool Find(const T& Item, int32& Index) const;
+    bool Contains(const T& Item) const;
 
     /** Size */
     size_t Num() const;
@@ -46,20 +151,26 @@ public:
     void Sort(const Compare& CompFn);
 };
 
-template <typename T>
-void TArray<T>::Init(const T& Element, size_t Number)
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Init(const T& Element, size_t Number)
 {
     this->assign(Number, Element);
 }
 
-template <typename T>
-void TArray<T>::Add(const T& Item)
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Add(const T& Item)
 {
     this->push_back(Item);
 }
 
-template <typename T>
-void TArray<T>::AddUnique(const T& Item)
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Add(T&& Item)
+{
+    this->push_back(std::move(Item));
+}
+
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::AddUnique(const T& Item)
 {
     if (Find(Item) == -1)
     {
@@ -67,28 +178,62 @@ void TArray<T>::AddUnique(const T& Item)
     }
 }
 
-template <typename T>
-void TArray<T>::Emplace(T&& Item)
+template <typename T, typename Allocator>
+template <typename... ArgTypes>
+T& TArray<T, Allocator>::Emplace(ArgTypes&&... Args)
+{
+    return this->emplace_back(std::forward<ArgTypes>(Args)...);
+}
+
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Append(std::span<const T> Items)
 {
-    this->emplace_back(std::move(Item));
+    this->insert(this->end(), Items.begin(), Items.end());
 }
 
-template <typename T>
-void TArray<T>::Empty()
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Append(TArray&& Other)
+{
+    if (this->empty())
+    {
+        // 할당자가 같으면 버퍼를 그대로 가져옴
+        static_cast<Super&>(*this) = std::move(static_cast<Super&>(Other));
+    }
+    else
+    {
+        this->insert(this->end(), std::make_move_iterator(Other.begin()), std::make_move_iterator(Other.end()));
+    }
+    Other.clear();
+}
+
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Empty()
 {
     this->clear();
 }
 
-template <typename T>
-int32 TArray<T>::Remove(const T& Item)
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Reserve(size_t Number)
+{
+    this->reserve(Number);
+}
+
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::SetNumUninitialized(size_t NewNum)
+{
+    this->resize(NewNum);
+}
+
+template <typename T, typename Allocator>
+int32 TArray<T, Allocator>::Remove(const T& Item)
 {
     auto oldSize = this->size();
     this->erase(std::remove(this->begin(), this->end(), Item), this->end());
     return static_cast<int32>(oldSize - this->size());
 }
 
-template <typename T>
-bool TArray<T>::RemoveSingle(const T& Item)
+template <typename T, typename Allocator>
+bool TArray<T, Allocator>::RemoveSingle(const T& Item)
 {
     auto it = std::find(this->begin(), this->end(), Item);
     if (it != this->end())
@@ -99,8 +244,8 @@ bool TArray<T>::RemoveSingle(const T& Item)
     return false;
 }
 
-template <typename T>
-void TArray<T>::RemoveAt(int32 Index)
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::RemoveAt(int32 Index)
 {
     if (Index >= 0 && static_cast<size_t>(Index) < this->size())
     {
@@ -108,58 +253,112 @@ void TArray<T>::RemoveAt(int32 Index)
     }
 }
 
-template <typename T>
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::RemoveAtSwap(int32 Index)
+{
+    if (Index >= 0 && static_cast<size_t>(Index) < this->size())
+    {
+        T& Last = this->back();
+        if (&(*this)[Index] != &Last)
+        {
+            (*this)[Index] = std::move(Last);
+        }
+        this->pop_back();
+    }
+}
+
+template <typename T, typename Allocator>
 template <typename Predicate>
     requires std::is_invocable_r_v<bool, Predicate, const T&>
-int32 TArray<T>::RemoveAll(const Predicate& Pred)
+int32 TArray<T, Allocator>::RemoveAll(const Predicate& Pred)
 {
     auto oldSize = this->size();
     this->erase(std::remove_if(this->begin(), this->end(), Pred), this->end());
     return static_cast<int32>(oldSize - this->size());
 }
 
-template <typename T>
-T* TArray<T>::GetData()
+template <typename T, typename Allocator>
+template <typename Predicate>
+    requires std::is_invocable_r_v<bool, Predicate, const T&>
+int32 TArray<T, Allocator>::RemoveAllSwap(const Predicate& Pred)
+{
+    const size_t OldSize = this->size();
+    size_t Index = 0;
+    size_t Count = OldSize;
+    while (Index < Count)
+    {
+        if (Pred((*this)[Index]))
+        {
+            // 끝에서 가져온 원소도 다시 검사해야 하므로 Index는 그대로
+            --Count;
+            if (Index != Count)
+            {
+                (*this)[Index] = std::move((*this)[Count]);
+            }
+        }
+        else
+        {
+            ++Index;
+        }
+    }
+    this->erase(this->begin() + Count, this->end());
+    return static_cast<int32>(OldSize - Count);
+}
+
+template <typename T, typename Allocator>
+T* TArray<T, Allocator>::GetData()
 {
     return this->data();
 }
 
-template <typename T>
-int32 TArray<T>::Find(const T& Item)
+template <typename T, typename Allocator>
+const T* TArray<T, Allocator>::GetData() const
 {
-    const auto it = std::find(this->begin(), this->end(), Item);
-    return it != this->end() ? std::distance(this->begin(), it) : -1;
+    return this->data();
 }
 
-template <typename T>
-bool TArray<T>::Find(const T& Item, int32& Index)
+template <typename T, typename Allocator>
+int32 TArray<T, Allocator>::Find(const T& Item) const
+{
+    const size_t Index = ArraySearch::Find(this->data(), this->size(), Item);
+    return Index != this->size() ? static_cast<int32>(Index) : -1;
+}
+
+template <typename T, typename Allocator>
+bool TArray<T, Allocator>::Find(const T& Item, int32& Index) const
 {
     Index = Find(Item);
     return (Index != -1);
 }
 
-template <typename T>
-size_t TArray<T>::Num() const
+template <typename T, typename Allocator>
+bool TArray<T, Allocator>::Contains(const T& Item) const
+{
+    return ArraySearch::Find(this->data(), this->size(), Item) != this->size();
+}
+
+template <typename T, typename Allocator>
+size_t TArray<T, Allocator>::Num() const
 {
     return this->size();
 }
 
-template <typename T>
-size_t TArray<T>::Len() const
+template <typename T, typename Allocator>
+size_t TArray<T, Allocator>::Len() const
 {
     return this->capacity();
 }
 
-template <typename T>
-void TArray<T>::Sort()
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Sort()
 {
     std::sort(this->begin(), this->end());
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename Compare>
     requires std::is_invocable_r_v<bool, Compare, const T&, const T&>
-void TArray<T>::Sort(const Compare& CompFn)
+void TArray<T, Allocator>::Sort(const Compare& CompFn)
 {
     std::sort(this->begin(), this->end(), CompFn);
 }
@@ -0,0 +1,156 @@
+﻿#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/VectorRegister.h"
+
+
+/**
+ * 값이 같은 것과 메모리 바이트가 같은 것이 일치하는 타입인지
+ * 참이면 TArray::Find가 바이트 비교로 여러 원소를 한 번에 훑는다.
+ * 정수, 열거형, 포인터가 기본으로 해당되고, 패딩 없는 핸들 구조체 등은 특수화해서 켤 수 있다.
+ * float은 0.0 == -0.0, NaN != NaN 때문에 해당되지 않는다.
+ */
+template <typename T>
+struct TIsBitwiseComparable
+    : std::bool_constant<(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) && std::has_unique_object_representations_v<T>>
+{
+};
+
+template <typename T>
+inline constexpr bool TIsBitwiseComparable_V = TIsBitwiseComparable<T>::value && std::is_trivially_copyable_v<T>
+    && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+
+namespace ArraySearch
+{
+#if MATH_USE_SSE
+    namespace Private
+    {
+        template <size_t Size>
+        __m128i Replicate(const void* Item)
+        {
+            if constexpr (Size == 1)
+            {
+                int8 Value;
+                std::memcpy(&Value, Item, Size);
+                return _mm_set1_epi8(Value);
+            }
+            else if constexpr (Size == 2)
+            {
+                int16 Value;
+                std::memcpy(&Value, Item, Size);
+                return _mm_set1_epi16(Value);
+            }
+            else if constexpr (Size == 4)
+            {
+                int32 Value;
+                std::memcpy(&Value, Item, Size);
+                return _mm_set1_epi32(Value);
+            }
+            else
+            {
+                int64 Value;
+                std::memcpy(&Value, Item, Size);
+                return _mm_set1_epi64x(Value);
+            }
+        }
+
+        /** 같은 원소 자리의 바이트가 모두 0xFF */
+        template <size_t Size>
+        __m128i CompareEqual(__m128i A, __m128i B)
+        {
+            if constexpr (Size == 1)
+            {
+                return _mm_cmpeq_epi8(A, B);
+            }
+            else if constexpr (Size == 2)
+            {
+                return _mm_cmpeq_epi16(A, B);
+            }
+            else if constexpr (Size == 4)
+            {
+                return _mm_cmpeq_epi32(A, B);
+            }
+            else
+            {
+                // SSE2에는 64비트 비교가 없으므로 32비트 두 칸이 모두 같은지 봄
+                const __m128i Equal32 = _mm_cmpeq_epi32(A, B);
+                return _mm_and_si128(Equal32, _mm_shuffle_epi32(Equal32, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+    }
+#endif
+
+    /**
+     * Data[0, Num)에서 Item과 바이트가 같은 첫 원소의 위치, 없으면 Num
+     * SSE2가 있으면 16바이트 레지스터 4개(64바이트, int32 16개)를 한 번에 비교하고, 남는 원소는 하나씩 비교한다.
+     */
+    template <typename T>
+        requires TIsBitwiseComparable_V<T>
+    size_t FindBitwise(const T* Data, size_t Num, const T& Item)
+    {
+        size_t i = 0;
+#if MATH_USE_SSE
+        constexpr size_t Size = sizeof(T);
+        constexpr size_t Lanes = 16 / Size;
+        const __m128i Value = Private::Replicate<Size>(&Item);
+        const char* Bytes = reinterpret_cast<const char*>(Data);
+
+        for (; i + Lanes * 4 <= Num; i += Lanes * 4)
+        {
+            const __m128i* Block = reinterpret_cast<const __m128i*>(Bytes + i * Size);
+            const __m128i Equal0 = Private::CompareEqual<Size>(_mm_loadu_si128(Block + 0), Value);
+            const __m128i Equal1 = Private::CompareEqual<Size>(_mm_loadu_si128(Block + 1), Value);
+            const __m128i Equal2 = Private::CompareEqual<Size>(_mm_loadu_si128(Block + 2), Value);
+            const __m128i Equal3 = Private::CompareEqual<Size>(_mm_loadu_si128(Block + 3), Value);
+
+            // 대부분은 못 찾으므로 네 결과를 합쳐서 한 번만 분기
+            const __m128i Any = _mm_or_si128(_mm_or_si128(Equal0, Equal1), _mm_or_si128(Equal2, Equal3));
+            if (_mm_movemask_epi8(Any) != 0)
+            {
+                const uint64 Mask = static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Equal0)))
+                    | static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Equal1))) << 16
+                    | static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Equal2))) << 32
+                    | static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Equal3))) << 48;
+                return i + std::countr_zero(Mask) / Size;
+            }
+        }
+
+        for (; i + Lanes <= Num; i += Lanes)
+        {
+            const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Bytes + i * Size));
+            const int32 Mask = _mm_movemask_epi8(Private::CompareEqual<Size>(Block, Value));
+            if (Mask != 0)
+            {
+                return i + std::countr_zero(static_cast<uint32>(Mask)) / Size;
+            }
+        }
+#endif
+        for (; i < Num; ++i)
+        {
+            if (std::memcmp(&Data[i], &Item, sizeof(T)) == 0)
+            {
+                return i;
+            }
+        }
+        return Num;
+    }
+
+    /** Data[0, Num)에서 Item과 같은 첫 원소의 위치, 없으면 Num. 타입에 따라 FindBitwise나 std::find를 고른다. */
+    template <typename T>
+    size_t Find(const T* Data, size_t Num, const T& Item)
+    {
+        if constexpr (TIsBitwiseComparable_V<T>)
+        {
+            return FindBitwise(Data, Num, Item);
+        }
+        else
+        {
+            return static_cast<size_t>(std::find(Data, Data + Num, Item) - Data);
+        }
+    }
+}
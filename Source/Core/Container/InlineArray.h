@@ -0,0 +1,130 @@
+﻿#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "Core/Container/Array.h"
+
+
+/** TInlineArray가 들고 있는 원소 N개 크기의 버퍼 */
+template <typename T, size_t N>
+struct TInlineStorage
+{
+    alignas(T) std::byte Buffer[sizeof(T) * N];
+    bool bInUse = false;
+};
+
+/**
+ * TInlineStorage에서 먼저 메모리를 받고, 버퍼가 이미 쓰이고 있거나 요청이 N개보다 크면 힙을 쓰는 할당자
+ *
+ * 버퍼는 할당 하나만 담을 수 있다. std::vector는 재할당할 때 새 블록을 먼저 받으므로
+ * 처음에 N개를 한 번에 예약해야(TInlineArray가 함) 버퍼를 제대로 쓴다.
+ * 다른 버퍼를 가리키는 할당자끼리는 같지 않으므로 컨테이너 간 이동은 원소 단위로 일어난다.
+ *
+ * @tparam TElement 버퍼에 담을 원소 타입, rebind된 다른 타입(디버그 빌드의 내부 프록시 등)은 항상 힙을 쓴다.
+ */
+template <typename T, size_t N, typename TElement = T>
+class TInlineAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TInlineAllocator<U, N, TElement>;
+    };
+
+    TInlineAllocator() = default;
+    explicit TInlineAllocator(TInlineStorage<TElement, N>* InStorage) : Storage(InStorage) {}
+
+    template <typename U>
+    TInlineAllocator(const TInlineAllocator<U, N, TElement>& Other) : Storage(Other.GetStorage()) {}
+
+    /** 복사해서 만든 컨테이너는 자기 버퍼를 따로 받아야 하므로 버퍼 없이 시작 */
+    TInlineAllocator select_on_container_copy_construction() const { return TInlineAllocator(); }
+
+    T* allocate(size_t Count)
+    {
+        if constexpr (std::is_same_v<T, TElement>)
+        {
+            if (Storage && !Storage->bInUse && Count <= N)
+            {
+                Storage->bInUse = true;
+                return reinterpret_cast<T*>(Storage->Buffer);
+            }
+        }
+        return std::allocator<T>().allocate(Count);
+    }
+
+    void deallocate(T* Ptr, size_t Count)
+    {
+        if (Storage && reinterpret_cast<std::byte*>(Ptr) == Storage->Buffer)
+        {
+            Storage->bInUse = false;
+            return;
+        }
+        std::allocator<T>().deallocate(Ptr, Count);
+    }
+
+    TInlineStorage<TElement, N>* GetStorage() const { return Storage; }
+
+    template <typename U>
+    bool operator==(const TInlineAllocator<U, N, TElement>& Other) const { return Storage == Other.GetStorage(); }
+
+private:
+    TInlineStorage<TElement, N>* Storage = nullptr;
+};
+
+/**
+ * 원소 N개까지는 객체 안의 버퍼를 쓰고, 넘치면 힙으로 옮겨 가는 TArray
+ * 매 프레임 만들었다 버리는 작은 배열에서 힙 할당을 없애기 위해 사용한다.
+ * 버퍼가 객체 안에 있으므로 이동도 원소 단위 복사(이동)가 된다.
+ */
+template <typename T, size_t N>
+class TInlineArray : private TInlineStorage<T, N>, public TArray<T, TInlineAllocator<T, N>>
+{
+    using Super = TArray<T, TInlineAllocator<T, N>>;
+
+public:
+    TInlineArray()
+        : Super(TInlineAllocator<T, N>(static_cast<TInlineStorage<T, N>*>(this)))
+    {
+        this->reserve(N);
+    }
+
+    TInlineArray(const TInlineArray& Other)
+        : TInlineArray()
+    {
+        this->assign(Other.begin(), Other.end());
+    }
+
+    TInlineArray(TInlineArray&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : TInlineArray()
+    {
+        this->assign(std::make_move_iterator(Other.begin()), std::make_move_iterator(Other.end()));
+        Other.Empty();
+    }
+
+    // 할당자가 서로 다르므로 std::vector의 대입이 원소 단위로 처리한다. 버퍼 자체는 대입하지 않음
+    TInlineArray& operator=(const TInlineArray& Other)
+    {
+        Super::operator=(Other);
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& Other) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        Super::operator=(std::move(Other));
+        Other.Empty();
+        return *this;
+    }
+
+    /** 원소가 객체 안의 버퍼에 있는지 (힙으로 넘어가지 않았는지) */
+    bool IsInline() const { return this->data() == reinterpret_cast<const T*>(TInlineStorage<T, N>::Buffer); }
+};
@@ -0,0 +1,519 @@
+﻿#pragma once
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Core/HAL/PlatformType.h"
+
+
+template <typename KeyType, typename ValueType>
+struct TPair
+{
+    KeyType Key;
+    ValueType Value;
+};
+
+/**
+ * TMap의 기본 해시 함수, std::hash를 그대로 쓴다.
+ * 정수의 std::hash는 값 그대로라서 TMap이 한 번 더 섞어서 슬롯을 고른다.
+ */
+template <typename KeyType>
+struct TMapHash
+{
+    size_t operator()(const KeyType& Key) const { return std::hash<KeyType>{}(Key); }
+};
+
+/** 문자열 키는 std::string_view, const char*로도 찾을 수 있음 */
+template <>
+struct TMapHash<std::string>
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view Key) const { return std::hash<std::string_view>{}(Key); }
+};
+
+/**
+ * 오픈 어드레싱 해시 맵 (Robin Hood 선형 탐사)
+ *
+ * 원소는 하나의 연속된 배열에 들어가고, 슬롯마다 홈 슬롯에서 몇 칸 떨어져 있는지를 1바이트 배열에 따로 둔다.
+ * 삽입할 때 홈에서 더 멀리 밀려난 원소에게 자리를 양보하므로 탐사 거리가 고르게 유지되고,
+ * 찾는 키보다 거리가 짧은 슬롯을 만나면 바로 없다고 판단할 수 있다. 삭제는 뒤쪽 원소를 당겨서(backward shift) 묘비를 남기지 않는다.
+ *
+ * - 부하율이 7/8을 넘거나 탐사 거리가 255를 넘으면 용량을 두 배로 늘린다.
+ * - 삽입과 삭제는 원소를 옮기므로 Find가 돌려준 포인터와 반복자는 Add, Remove 뒤에 무효가 된다.
+ * - Hasher와 KeyEqual이 모두 is_transparent를 가지면 Find, Contains, Remove에 KeyType이 아닌 키를 넘길 수 있다.
+ */
+template <typename KeyType, typename ValueType, typename Hasher = TMapHash<KeyType>, typename KeyEqual = std::equal_to<>>
+class TMap
+{
+public:
+    using ElementType = TPair<KeyType, ValueType>;
+
+private:
+    static constexpr bool bIsTransparent = requires { typename Hasher::is_transparent; typename KeyEqual::is_transparent; };
+
+    template <typename LookupType>
+    static constexpr bool bCanLookup = std::is_same_v<LookupType, KeyType> || std::is_convertible_v<const LookupType&, KeyType> || bIsTransparent;
+
+    /** Distances에서 빈 슬롯 */
+    static constexpr uint8 EmptyDistance = 0;
+    static constexpr uint8 MaxDistance = 255;
+    static constexpr size_t MinCapacity = 8;
+    static constexpr size_t InvalidIndex = static_cast<size_t>(-1);
+
+    template <bool bConst>
+    class TIterator
+    {
+        using MapType = std::conditional_t<bConst, const TMap, TMap>;
+
+    public:
+        using value_type = ElementType;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+
+        TIterator(MapType* InMap, size_t InIndex) : Map(InMap), Index(InIndex) { SkipEmpty(); }
+
+        reference operator*() const { return Map->Slots[Index]; }
+        pointer operator->() const { return &Map->Slots[Index]; }
+
+        TIterator& operator++()
+        {
+            ++Index;
+            SkipEmpty();
+            return *this;
+        }
+
+        bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+    private:
+        void SkipEmpty()
+        {
+            while (Index < Map->Capacity && Map->Distances[Index] == EmptyDistance)
+            {
+                ++Index;
+            }
+        }
+
+        MapType* Map;
+        size_t Index;
+    };
+
+public:
+    using Iterator = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+    TMap() = default;
+    TMap(std::initializer_list<ElementType> Elements);
+    TMap(const TMap& Other);
+    TMap(TMap&& Other) noexcept;
+    ~TMap();
+
+    TMap& operator=(const TMap& Other);
+    TMap& operator=(TMap&& Other) noexcept;
+
+    /** 키가 이미 있으면 값을 덮어씀, 값의 참조를 돌려줌 */
+    ValueType& Add(const KeyType& Key, const ValueType& Value) { return Emplace(Key, Value); }
+    ValueType& Add(const KeyType& Key, ValueType&& Value) { return Emplace(Key, std::move(Value)); }
+    ValueType& Add(KeyType&& Key, ValueType&& Value) { return Emplace(std::move(Key), std::move(Value)); }
+
+    template <typename InKeyType, typename... ArgTypes>
+    ValueType& Emplace(InKeyType&& Key, ArgTypes&&... Args);
+
+    /** 키가 없으면 기본값으로 추가 */
+    ValueType& FindOrAdd(const KeyType& Key);
+
+    /** 없으면 nullptr */
+    template <typename LookupType>
+        requires bCanLookup<LookupType>
+    ValueType* Find(const LookupType& Key)
+    {
+        const size_t Index = FindIndex(Key);
+        return Index != InvalidIndex ? &Slots[Index].Value : nullptr;
+    }
+
+    template <typename LookupType>
+        requires bCanLookup<LookupType>
+    const ValueType* Find(const LookupType& Key) const
+    {
+        const size_t Index = FindIndex(Key);
+        return Index != InvalidIndex ? &Slots[Index].Value : nullptr;
+    }
+
+    template <typename LookupType>
+        requires bCanLookup<LookupType>
+    bool Contains(const LookupType& Key) const { return FindIndex(Key) != InvalidIndex; }
+
+    /** 지운 원소 수 (0 또는 1) */
+    template <typename LookupType>
+        requires bCanLookup<LookupType>
+    int32 Remove(const LookupType& Key) { return RemoveAt(FindIndex(Key)); }
+
+    /** 모두 지움, Slack이 0이 아니면 그만큼 넣을 공간을 남겨 둠 */
+    void Empty(size_t Slack = 0);
+
+    /** Number개까지 용량을 늘리지 않고 넣을 수 있게 합니다. */
+    void Reserve(size_t Number);
+
+    size_t Num() const { return Count; }
+    bool IsEmpty() const { return Count == 0; }
+
+    /** Capacity (슬롯 수) */
+    size_t Len() const { return Capacity; }
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, Capacity); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, Capacity); }
+
+private:
+    template <typename LookupType>
+    size_t HomeIndex(const LookupType& Key) const
+    {
+        // 피보나치 해싱으로 위쪽 비트를 골라 std::hash가 항등 함수여도 고르게 퍼지게 함
+        const uint64 Hash = static_cast<uint64>(Hasher{}(Key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(Hash >> Shift);
+    }
+
+    template <typename LookupType>
+    size_t FindIndex(const LookupType& Key) const;
+
+    /** Index 슬롯을 비우고 뒤쪽 원소를 당김, InvalidIndex면 아무것도 안 함 */
+    int32 RemoveAt(size_t Index);
+
+    /** 키가 없다는 것을 아는 상태에서 새 원소를 넣을 자리를 만들고 위치를 돌려줌, 거리가 넘치면 InvalidIndex */
+    size_t MakeSlot(size_t Home);
+
+    /** 빈 맵에 이미 있는 원소를 옮겨 넣을 때 씀 */
+    void InsertUnique(ElementType&& Element);
+
+    void Rehash(size_t NewCapacity);
+    void Allocate(size_t NewCapacity);
+    void DestroyAndFree();
+
+    static size_t CapacityFor(size_t Number);
+
+private:
+    ElementType* Slots = nullptr;
+    uint8* Distances = nullptr;
+    size_t Capacity = 0;
+    size_t Count = 0;
+
+    /** 64 - log2(Capacity) */
+    uint32 Shift = 64;
+};
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>::TMap(std::initializer_list<ElementType> Elements)
+{
+    Reserve(Elements.size());
+    for (const ElementType& Element : Elements)
+    {
+        Add(Element.Key, Element.Value);
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>::TMap(const TMap& Other)
+{
+    if (Other.Count == 0)
+    {
+        return;
+    }
+
+    // 같은 용량이면 배치도 같으므로 슬롯 단위로 복사
+    Allocate(Other.Capacity);
+    for (size_t i = 0; i < Capacity; ++i)
+    {
+        if (Other.Distances[i] != EmptyDistance)
+        {
+            std::construct_at(&Slots[i], Other.Slots[i]);
+            Distances[i] = Other.Distances[i];
+            ++Count;
+        }
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>::TMap(TMap&& Other) noexcept
+    : Slots(std::exchange(Other.Slots, nullptr))
+    , Distances(std::exchange(Other.Distances, nullptr))
+    , Capacity(std::exchange(Other.Capacity, 0))
+    , Count(std::exchange(Other.Count, 0))
+    , Shift(std::exchange(Other.Shift, 64))
+{
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>::~TMap()
+{
+    DestroyAndFree();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>& TMap<KeyType, ValueType, Hasher, KeyEqual>::operator=(const TMap& Other)
+{
+    if (this != &Other)
+    {
+        TMap Copy(Other);
+        *this = std::move(Copy);
+    }
+    return *this;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+TMap<KeyType, ValueType, Hasher, KeyEqual>& TMap<KeyType, ValueType, Hasher, KeyEqual>::operator=(TMap&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        DestroyAndFree();
+        Slots = std::exchange(Other.Slots, nullptr);
+        Distances = std::exchange(Other.Distances, nullptr);
+        Capacity = std::exchange(Other.Capacity, 0);
+        Count = std::exchange(Other.Count, 0);
+        Shift = std::exchange(Other.Shift, 64);
+    }
+    return *this;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+template <typename InKeyType, typename... ArgTypes>
+ValueType& TMap<KeyType, ValueType, Hasher, KeyEqual>::Emplace(InKeyType&& Key, ArgTypes&&... Args)
+{
+    const size_t Existing = FindIndex(Key);
+    if (Existing != InvalidIndex)
+    {
+        ValueType& Value = Slots[Existing].Value;
+        Value = ValueType(std::forward<ArgTypes>(Args)...);
+        return Value;
+    }
+
+    if (Count + 1 > Capacity - Capacity / 8)
+    {
+        Rehash(CapacityFor(Count + 1));
+    }
+
+    size_t Index = MakeSlot(HomeIndex(Key));
+    while (Index == InvalidIndex)
+    {
+        Rehash(Capacity * 2);
+        Index = MakeSlot(HomeIndex(Key));
+    }
+
+    std::construct_at(&Slots[Index], ElementType{ KeyType(std::forward<InKeyType>(Key)), ValueType(std::forward<ArgTypes>(Args)...) });
+    ++Count;
+    return Slots[Index].Value;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+ValueType& TMap<KeyType, ValueType, Hasher, KeyEqual>::FindOrAdd(const KeyType& Key)
+{
+    if (ValueType* Value = Find(Key))
+    {
+        return *Value;
+    }
+    return Emplace(Key);
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+int32 TMap<KeyType, ValueType, Hasher, KeyEqual>::RemoveAt(size_t Index)
+{
+    if (Index == InvalidIndex)
+    {
+        return 0;
+    }
+
+    // 뒤에 홈에서 밀려난 원소가 있으면 한 칸씩 당김
+    const size_t Mask = Capacity - 1;
+    std::destroy_at(&Slots[Index]);
+    size_t Next = (Index + 1) & Mask;
+    while (Distances[Next] > 1)
+    {
+        std::construct_at(&Slots[Index], std::move(Slots[Next]));
+        std::destroy_at(&Slots[Next]);
+        Distances[Index] = Distances[Next] - 1;
+        Index = Next;
+        Next = (Next + 1) & Mask;
+    }
+    Distances[Index] = EmptyDistance;
+    --Count;
+    return 1;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::Empty(size_t Slack)
+{
+    DestroyAndFree();
+    if (Slack > 0)
+    {
+        Allocate(CapacityFor(Slack));
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::Reserve(size_t Number)
+{
+    const size_t NewCapacity = CapacityFor(Number);
+    if (NewCapacity > Capacity)
+    {
+        Rehash(NewCapacity);
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+template <typename LookupType>
+size_t TMap<KeyType, ValueType, Hasher, KeyEqual>::FindIndex(const LookupType& Key) const
+{
+    if (Count == 0)
+    {
+        return InvalidIndex;
+    }
+
+    // 찾는 키가 있다면 거리가 Distance 이상인 슬롯들 사이에 있음
+    const size_t Mask = Capacity - 1;
+    size_t Index = HomeIndex(Key);
+    for (uint32 Distance = 1; Distance <= Distances[Index]; ++Distance)
+    {
+        if (Distances[Index] == Distance && KeyEqual{}(Slots[Index].Key, Key))
+        {
+            return Index;
+        }
+        Index = (Index + 1) & Mask;
+    }
+    return InvalidIndex;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+size_t TMap<KeyType, ValueType, Hasher, KeyEqual>::MakeSlot(size_t Home)
+{
+    const size_t Mask = Capacity - 1;
+
+    // 새 원소가 들어갈 자리: 자기보다 홈에 가까운 원소를 처음 만나는 곳
+    size_t Index = Home;
+    uint32 Distance = 1;
+    while (Distance <= Distances[Index])
+    {
+        Index = (Index + 1) & Mask;
+        ++Distance;
+    }
+    if (Distance > MaxDistance)
+    {
+        return InvalidIndex;
+    }
+
+    // 그 뒤의 빈 칸까지 원소들을 한 칸씩 밀어야 하므로 넘치는 원소가 없는지 먼저 확인
+    size_t Last = Index;
+    while (Distances[Last] != EmptyDistance)
+    {
+        if (Distances[Last] == MaxDistance)
+        {
+            return InvalidIndex;
+        }
+        Last = (Last + 1) & Mask;
+    }
+
+    while (Last != Index)
+    {
+        const size_t Previous = (Last - 1) & Mask;
+        std::construct_at(&Slots[Last], std::move(Slots[Previous]));
+        std::destroy_at(&Slots[Previous]);
+        Distances[Last] = Distances[Previous] + 1;
+        Last = Previous;
+    }
+
+    Distances[Index] = static_cast<uint8>(Distance);
+    return Index;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::InsertUnique(ElementType&& Element)
+{
+    const size_t Index = MakeSlot(HomeIndex(Element.Key));
+    // 용량을 두 배로 늘린 직후라 거리가 넘칠 수 없음, 넘친다면 해시가 한 값에 몰려 있는 것
+    assert(Index != InvalidIndex);
+    std::construct_at(&Slots[Index], std::move(Element));
+    ++Count;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::Rehash(size_t NewCapacity)
+{
+    ElementType* OldSlots = std::exchange(Slots, nullptr);
+    uint8* OldDistances = std::exchange(Distances, nullptr);
+    const size_t OldCapacity = Capacity;
+
+    Allocate(NewCapacity);
+    for (size_t i = 0; i < OldCapacity; ++i)
+    {
+        if (OldDistances[i] != EmptyDistance)
+        {
+            InsertUnique(std::move(OldSlots[i]));
+            std::destroy_at(&OldSlots[i]);
+        }
+    }
+
+    if (OldSlots)
+    {
+        std::allocator<ElementType>().deallocate(OldSlots, OldCapacity);
+        delete[] OldDistances;
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::Allocate(size_t NewCapacity)
+{
+    assert(Slots == nullptr && NewCapacity >= MinCapacity && (NewCapacity & (NewCapacity - 1)) == 0);
+
+    Slots = std::allocator<ElementType>().allocate(NewCapacity);
+    Distances = new uint8[NewCapacity]();
+    Capacity = NewCapacity;
+    Count = 0;
+
+    Shift = 64;
+    for (size_t Size = NewCapacity; Size > 1; Size >>= 1)
+    {
+        --Shift;
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+void TMap<KeyType, ValueType, Hasher, KeyEqual>::DestroyAndFree()
+{
+    if (Slots == nullptr)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < Capacity; ++i)
+    {
+        if (Distances[i] != EmptyDistance)
+        {
+            std::destroy_at(&Slots[i]);
+        }
+    }
+    std::allocator<ElementType>().deallocate(Slots, Capacity);
+    delete[] Distances;
+
+    Slots = nullptr;
+    Distances = nullptr;
+    Capacity = 0;
+    Count = 0;
+    Shift = 64;
+}
+
+template <typename KeyType, typename ValueType, typename Hasher, typename KeyEqual>
+size_t TMap<KeyType, ValueType, Hasher, KeyEqual>::CapacityFor(size_t Number)
+{
+    // 부하율 7/8 이하가 되는 가장 작은 2의 거듭제곱
+    size_t NewCapacity = MinCapacity;
+    while (NewCapacity - NewCapacity / 8 < Number)
+    {
+        NewCapacity *= 2;
+    }
+    return NewCapacity;
+}
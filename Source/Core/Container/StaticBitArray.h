@@ -0,0 +1,164 @@
+﻿#pragma once
+#include <bit>
+#include <cassert>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 크기가 고정된 비트 배열
+ * 64비트 워드 단위로 저장하므로 집합 연산은 워드 수만큼의 비트 연산이고,
+ * 켜진 비트 순회는 countr_zero로 다음 비트로 바로 건너뛴다.
+ *
+ * @code
+ * for (uint32 Index : Bits) { ... }  // 켜진 비트의 번호를 오름차순으로
+ * @endcode
+ */
+template <uint32 NumBits>
+class TStaticBitArray
+{
+    static_assert(NumBits > 0);
+
+public:
+    static constexpr uint32 NumWords = (NumBits + 63) / 64;
+
+    /** 켜진 비트의 번호를 돌려주는 전진 반복자 */
+    class FSetBitIterator
+    {
+    public:
+        FSetBitIterator(const TStaticBitArray& InArray, uint32 InWordIndex)
+            : Array(&InArray)
+            , WordIndex(InWordIndex)
+            , RemainingBits(InWordIndex < NumWords ? InArray.Words[InWordIndex] : 0)
+        {
+            SkipEmptyWords();
+        }
+
+        uint32 operator*() const { return WordIndex * 64 + static_cast<uint32>(std::countr_zero(RemainingBits)); }
+
+        FSetBitIterator& operator++()
+        {
+            // 가장 낮은 켜진 비트를 끔
+            RemainingBits &= RemainingBits - 1;
+            SkipEmptyWords();
+            return *this;
+        }
+
+        bool operator==(const FSetBitIterator& Other) const { return WordIndex == Other.WordIndex && RemainingBits == Other.RemainingBits; }
+        bool operator!=(const FSetBitIterator& Other) const { return !(*this == Other); }
+
+    private:
+        void SkipEmptyWords()
+        {
+            while (RemainingBits == 0 && WordIndex < NumWords)
+            {
+                ++WordIndex;
+                RemainingBits = WordIndex < NumWords ? Array->Words[WordIndex] : 0;
+            }
+        }
+
+        const TStaticBitArray* Array;
+        uint32 WordIndex;
+        uint64 RemainingBits;
+    };
+
+    constexpr TStaticBitArray() = default;
+
+    bool Test(uint32 Index) const
+    {
+        assert(Index < NumBits);
+        return (Words[Index / 64] >> (Index % 64)) & 1;
+    }
+
+    void Set(uint32 Index, bool bValue = true)
+    {
+        assert(Index < NumBits);
+        const uint64 Bit = uint64(1) << (Index % 64);
+        Words[Index / 64] = bValue ? (Words[Index / 64] | Bit) : (Words[Index / 64] & ~Bit);
+    }
+
+    void Clear(uint32 Index) { Set(Index, false); }
+
+    void Reset()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = 0;
+        }
+    }
+
+    bool Any() const
+    {
+        uint64 Combined = 0;
+        for (uint64 Word : Words)
+        {
+            Combined |= Word;
+        }
+        return Combined != 0;
+    }
+
+    bool None() const { return !Any(); }
+
+    uint32 Count() const
+    {
+        uint32 Total = 0;
+        for (uint64 Word : Words)
+        {
+            Total += static_cast<uint32>(std::popcount(Word));
+        }
+        return Total;
+    }
+
+    /** this에는 켜져 있고 Other에는 꺼진 비트 */
+    TStaticBitArray AndNot(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result;
+        for (uint32 i = 0; i < NumWords; ++i)
+        {
+            Result.Words[i] = Words[i] & ~Other.Words[i];
+        }
+        return Result;
+    }
+
+    TStaticBitArray operator&(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result;
+        for (uint32 i = 0; i < NumWords; ++i)
+        {
+            Result.Words[i] = Words[i] & Other.Words[i];
+        }
+        return Result;
+    }
+
+    TStaticBitArray operator|(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result;
+        for (uint32 i = 0; i < NumWords; ++i)
+        {
+            Result.Words[i] = Words[i] | Other.Words[i];
+        }
+        return Result;
+    }
+
+    bool operator==(const TStaticBitArray& Other) const
+    {
+        for (uint32 i = 0; i < NumWords; ++i)
+        {
+            if (Words[i] != Other.Words[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    FSetBitIterator begin() const { return FSetBitIterator(*this, 0); }
+    FSetBitIterator end() const { return FSetBitIterator(*this, NumWords); }
+
+    static constexpr uint32 Num() { return NumBits; }
+
+    const uint64* GetWords() const { return Words; }
+
+private:
+    uint64 Words[NumWords] = {};
+};
@@ -0,0 +1,200 @@
+﻿#include "Matrix.h"
+
+#include <cmath>
+
+
+FMatrix::FMatrix(const FVector4& Row0, const FVector4& Row1, const FVector4& Row2, const FVector4& Row3)
+    : M{
+        { Row0.X, Row0.Y, Row0.Z, Row0.W },
+        { Row1.X, Row1.Y, Row1.Z, Row1.W },
+        { Row2.X, Row2.Y, Row2.Z, Row2.W },
+        { Row3.X, Row3.Y, Row3.Z, Row3.W }
+    }
+{
+}
+
+FMatrix FMatrix::MakeTranslation(const FVector& Translation)
+{
+    FMatrix Result;
+    Result.M[3][0] = Translation.X;
+    Result.M[3][1] = Translation.Y;
+    Result.M[3][2] = Translation.Z;
+    return Result;
+}
+
+FMatrix FMatrix::MakeScale(const FVector& Scale)
+{
+    FMatrix Result;
+    Result.M[0][0] = Scale.X;
+    Result.M[1][1] = Scale.Y;
+    Result.M[2][2] = Scale.Z;
+    return Result;
+}
+
+FMatrix FMatrix::MakeRotation(const FVector& PitchYawRoll)
+{
+    const float CP = std::cos(PitchYawRoll.X);
+    const float SP = std::sin(PitchYawRoll.X);
+    const float CY = std::cos(PitchYawRoll.Y);
+    const float SY = std::sin(PitchYawRoll.Y);
+    const float CR = std::cos(PitchYawRoll.Z);
+    const float SR = std::sin(PitchYawRoll.Z);
+
+    // RotationZ(Roll) * RotationX(Pitch) * RotationY(Yaw)를 전개한 식
+    return FMatrix(
+        FVector4(CR * CY + SR * SP * SY, SR * CP, SR * SP * CY - CR * SY, 0.0f),
+        FVector4(CR * SP * SY - SR * CY, CR * CP, SR * SY + CR * SP * CY, 0.0f),
+        FVector4(CP * SY, -SP, CP * CY, 0.0f),
+        FVector4(0.0f, 0.0f, 0.0f, 1.0f)
+    );
+}
+
+FMatrix FMatrix::LookAtLH(const FVector& Eye, const FVector& Target, const FVector& Up)
+{
+    return LookToLH(Eye, Target - Eye, Up);
+}
+
+FMatrix FMatrix::LookToLH(const FVector& Eye, const FVector& Direction, const FVector& Up)
+{
+    const FVector Forward = Direction.Normalize();
+    const FVector Right = FVector::CrossProduct(Up, Forward).Normalize();
+    const FVector NewUp = FVector::CrossProduct(Forward, Right);
+
+    // 카메라 축을 열로 두고, 마지막 행은 카메라 위치를 각 축에 투영한 값의 반대
+    return FMatrix(
+        FVector4(Right.X, NewUp.X, Forward.X, 0.0f),
+        FVector4(Right.Y, NewUp.Y, Forward.Y, 0.0f),
+        FVector4(Right.Z, NewUp.Z, Forward.Z, 0.0f),
+        FVector4(-Right.Dot(Eye), -NewUp.Dot(Eye), -Forward.Dot(Eye), 1.0f)
+    );
+}
+
+FMatrix FMatrix::PerspectiveFovLH(float FovY, float AspectRatio, float NearZ, float FarZ)
+{
+    const float Height = std::cos(FovY * 0.5f) / std::sin(FovY * 0.5f);
+    const float Width = Height / AspectRatio;
+    const float Range = FarZ / (FarZ - NearZ);
+
+    return FMatrix(
+        FVector4(Width, 0.0f, 0.0f, 0.0f),
+        FVector4(0.0f, Height, 0.0f, 0.0f),
+        FVector4(0.0f, 0.0f, Range, 1.0f),
+        FVector4(0.0f, 0.0f, -Range * NearZ, 0.0f)
+    );
+}
+
+bool FMatrix::operator==(const FMatrix& Other) const
+{
+    for (int Row = 0; Row < 4; ++Row)
+    {
+        if (GetRow(Row) != Other.GetRow(Row))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FMatrix FMatrix::Transpose() const
+{
+    FMatrix Result;
+    for (int Row = 0; Row < 4; ++Row)
+    {
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            Result.M[Row][Column] = M[Column][Row];
+        }
+    }
+    return Result;
+}
+
+FMatrix FMatrix::Inverse(float* OutDeterminant) const
+{
+    // 2x2 소행렬식을 먼저 구해서 여인수 전개에 재사용
+    const float S0 = M[0][0] * M[1][1] - M[1][0] * M[0][1];
+    const float S1 = M[0][0] * M[1][2] - M[1][0] * M[0][2];
+    const float S2 = M[0][0] * M[1][3] - M[1][0] * M[0][3];
+    const float S3 = M[0][1] * M[1][2] - M[1][1] * M[0][2];
+    const float S4 = M[0][1] * M[1][3] - M[1][1] * M[0][3];
+    const float S5 = M[0][2] * M[1][3] - M[1][2] * M[0][3];
+
+    const float C5 = M[2][2] * M[3][3] - M[3][2] * M[2][3];
+    const float C4 = M[2][1] * M[3][3] - M[3][1] * M[2][3];
+    const float C3 = M[2][1] * M[3][2] - M[3][1] * M[2][2];
+    const float C2 = M[2][0] * M[3][3] - M[3][0] * M[2][3];
+    const float C1 = M[2][0] * M[3][2] - M[3][0] * M[2][2];
+    const float C0 = M[2][0] * M[3][1] - M[3][0] * M[2][1];
+
+    const float Det = S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+    if (OutDeterminant)
+    {
+        *OutDeterminant = Det;
+    }
+
+    const float InvDet = 1.0f / Det;
+
+    FMatrix Result;
+    Result.M[0][0] = ( M[1][1] * C5 - M[1][2] * C4 + M[1][3] * C3) * InvDet;
+    Result.M[0][1] = (-M[0][1] * C5 + M[0][2] * C4 - M[0][3] * C3) * InvDet;
+    Result.M[0][2] = ( M[3][1] * S5 - M[3][2] * S4 + M[3][3] * S3) * InvDet;
+    Result.M[0][3] = (-M[2][1] * S5 + M[2][2] * S4 - M[2][3] * S3) * InvDet;
+
+    Result.M[1][0] = (-M[1][0] * C5 + M[1][2] * C2 - M[1][3] * C1) * InvDet;
+    Result.M[1][1] = ( M[0][0] * C5 - M[0][2] * C2 + M[0][3] * C1) * InvDet;
+    Result.M[1][2] = (-M[3][0] * S5 + M[3][2] * S2 - M[3][3] * S1) * InvDet;
+    Result.M[1][3] = ( M[2][0] * S5 - M[2][2] * S2 + M[2][3] * S1) * InvDet;
+
+    Result.M[2][0] = ( M[1][0] * C4 - M[1][1] * C2 + M[1][3] * C0) * InvDet;
+    Result.M[2][1] = (-M[0][0] * C4 + M[0][1] * C2 - M[0][3] * C0) * InvDet;
+    Result.M[2][2] = ( M[3][0] * S4 - M[3][1] * S2 + M[3][3] * S0) * InvDet;
+    Result.M[2][3] = (-M[2][0] * S4 + M[2][1] * S2 - M[2][3] * S0) * InvDet;
+
+    Result.M[3][0] = (-M[1][0] * C3 + M[1][1] * C1 - M[1][2] * C0) * InvDet;
+    Result.M[3][1] = ( M[0][0] * C3 - M[0][1] * C1 + M[0][2] * C0) * InvDet;
+    Result.M[3][2] = (-M[3][0] * S3 + M[3][1] * S1 - M[3][2] * S0) * InvDet;
+    Result.M[3][3] = ( M[2][0] * S3 - M[2][1] * S1 + M[2][2] * S0) * InvDet;
+
+    return Result;
+}
+
+float FMatrix::Determinant() const
+{
+    const float S0 = M[0][0] * M[1][1] - M[1][0] * M[0][1];
+    const float S1 = M[0][0] * M[1][2] - M[1][0] * M[0][2];
+    const float S2 = M[0][0] * M[1][3] - M[1][0] * M[0][3];
+    const float S3 = M[0][1] * M[1][2] - M[1][1] * M[0][2];
+    const float S4 = M[0][1] * M[1][3] - M[1][1] * M[0][3];
+    const float S5 = M[0][2] * M[1][3] - M[1][2] * M[0][3];
+
+    const float C5 = M[2][2] * M[3][3] - M[3][2] * M[2][3];
+    const float C4 = M[2][1] * M[3][3] - M[3][1] * M[2][3];
+    const float C3 = M[2][1] * M[3][2] - M[3][1] * M[2][2];
+    const float C2 = M[2][0] * M[3][3] - M[3][0] * M[2][3];
+    const float C1 = M[2][0] * M[3][2] - M[3][0] * M[2][2];
+    const float C0 = M[2][0] * M[3][1] - M[3][0] * M[2][1];
+
+    return S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+}
+
+void FMatrix::SetRow(int Index, const FVector4& Row)
+{
+    M[Index][0] = Row.X;
+    M[Index][1] = Row.Y;
+    M[Index][2] = Row.Z;
+    M[Index][3] = Row.W;
+}
+
+bool FMatrix::Equals(const FMatrix& Other, float Tolerance) const
+{
+    for (int Row = 0; Row < 4; ++Row)
+    {
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            if (std::abs(M[Row][Column] - Other.M[Row][Column]) > Tolerance)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,134 @@
+﻿#pragma once
+#include "Core/Math/Vector.h"
+#include "Core/Math/Vector4.h"
+#include "Core/Math/VectorRegister.h"
+
+
+/**
+ * 16바이트 정렬된 4x4 행렬
+ *
+ * DirectXMath의 XMMATRIX와 같은 규칙을 따른다.
+ * - 행 우선(row-major)으로 저장하고, 행 벡터를 오른쪽에서 곱한다 (v * M).
+ * - 따라서 A * B는 A를 먼저 적용하고 B를 나중에 적용한다.
+ * - 왼손 좌표계, 이동 성분은 마지막 행에 있다.
+ * 메모리 배치가 XMMATRIX와 같아서 상수 버퍼에 그대로 복사할 수 있다.
+ */
+struct alignas(16) FMatrix
+{
+    float M[4][4];
+
+    /** 단위 행렬 */
+    FMatrix();
+    FMatrix(const FVector4& Row0, const FVector4& Row1, const FVector4& Row2, const FVector4& Row3);
+
+    static FMatrix Identity() { return FMatrix(); }
+
+    static FMatrix MakeTranslation(const FVector& Translation);
+    static FMatrix MakeScale(const FVector& Scale);
+    static FMatrix MakeScale(float Scale) { return MakeScale(FVector(Scale, Scale, Scale)); }
+
+    /**
+     * 오일러 각(라디안)으로 회전 행렬을 만듭니다. X = Pitch, Y = Yaw, Z = Roll
+     * Roll(Z) → Pitch(X) → Yaw(Y) 순서로 적용되며 XMMatrixRotationRollPitchYawFromVector와 같다.
+     */
+    static FMatrix MakeRotation(const FVector& PitchYawRoll);
+
+    /** 왼손 좌표계 뷰 행렬, XMMatrixLookAtLH와 같음 */
+    static FMatrix LookAtLH(const FVector& Eye, const FVector& Target, const FVector& Up);
+    static FMatrix LookToLH(const FVector& Eye, const FVector& Direction, const FVector& Up);
+
+    /** 왼손 좌표계 원근 투영 행렬 (깊이 0~1), XMMatrixPerspectiveFovLH와 같음 */
+    static FMatrix PerspectiveFovLH(float FovY, float AspectRatio, float NearZ, float FarZ);
+
+    FMatrix operator*(const FMatrix& Other) const;
+    FMatrix& operator*=(const FMatrix& Other);
+
+    bool operator==(const FMatrix& Other) const;
+    bool operator!=(const FMatrix& Other) const { return !(*this == Other); }
+
+    FMatrix Transpose() const;
+
+    /**
+     * 역행렬을 구합니다.
+     * @param OutDeterminant nullptr가 아니면 행렬식을 받음, 0이면 역행렬이 없고 결과는 의미가 없다.
+     */
+    FMatrix Inverse(float* OutDeterminant = nullptr) const;
+    float Determinant() const;
+
+    FVector4 GetRow(int Index) const { return FVector4(M[Index][0], M[Index][1], M[Index][2], M[Index][3]); }
+    void SetRow(int Index, const FVector4& Row);
+
+    /** (X, Y, Z, 1)을 변환하고 W로 나눕니다. XMVector3TransformCoord와 같음 */
+    FVector TransformPosition(const FVector& Position) const;
+
+    /** (X, Y, Z, 0)을 변환, 이동은 무시됨 */
+    FVector TransformVector(const FVector& Vector) const;
+
+    FVector4 TransformVector4(const FVector4& Vector) const;
+
+    /** 모든 성분이 Tolerance 안에서 같은지 */
+    bool Equals(const FMatrix& Other, float Tolerance) const;
+
+    VectorRegister::FRegister GetRowRegister(int Index) const { return VectorRegister::Load(M[Index]); }
+};
+
+static_assert(sizeof(FMatrix) == 64 && alignof(FMatrix) == 16);
+
+inline FMatrix::FMatrix()
+    : M{
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f }
+    }
+{
+}
+
+inline FMatrix FMatrix::operator*(const FMatrix& Other) const
+{
+    using namespace VectorRegister;
+
+    const FRegister B0 = Other.GetRowRegister(0);
+    const FRegister B1 = Other.GetRowRegister(1);
+    const FRegister B2 = Other.GetRowRegister(2);
+    const FRegister B3 = Other.GetRowRegister(3);
+
+    // 결과의 i번째 행 = A[i][0] * B의 0행 + ... + A[i][3] * B의 3행
+    FMatrix Result;
+    for (int Row = 0; Row < 4; ++Row)
+    {
+        FRegister Sum = Multiply(Replicate(M[Row][0]), B0);
+        Sum = MultiplyAdd(Replicate(M[Row][1]), B1, Sum);
+        Sum = MultiplyAdd(Replicate(M[Row][2]), B2, Sum);
+        Sum = MultiplyAdd(Replicate(M[Row][3]), B3, Sum);
+        Store(Result.M[Row], Sum);
+    }
+    return Result;
+}
+
+inline FMatrix& FMatrix::operator*=(const FMatrix& Other)
+{
+    return *this = *this * Other;
+}
+
+inline FVector4 FMatrix::TransformVector4(const FVector4& Vector) const
+{
+    using namespace VectorRegister;
+
+    FRegister Sum = Multiply(Replicate(Vector.X), GetRowRegister(0));
+    Sum = MultiplyAdd(Replicate(Vector.Y), GetRowRegister(1), Sum);
+    Sum = MultiplyAdd(Replicate(Vector.Z), GetRowRegister(2), Sum);
+    Sum = MultiplyAdd(Replicate(Vector.W), GetRowRegister(3), Sum);
+    return FVector4::FromRegister(Sum);
+}
+
+inline FVector FMatrix::TransformPosition(const FVector& Position) const
+{
+    const FVector4 Result = TransformVector4(FVector4(Position, 1.0f));
+    return FVector(Result.X, Result.Y, Result.Z) / Result.W;
+}
+
+inline FVector FMatrix::TransformVector(const FVector& Vector) const
+{
+    return TransformVector4(FVector4(Vector, 0.0f)).ToVector();
+}
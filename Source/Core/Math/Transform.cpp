@@ -0,0 +1,42 @@
+﻿#include "Transform.h"
+
+
+FMatrix FTransform::ToMatrix() const
+{
+    return FMatrix::MakeScale(Scale) * FMatrix::MakeRotation(Rotation) * FMatrix::MakeTranslation(Location);
+}
+
+FVector FTransform::TransformPosition(const FVector& Position) const
+{
+    return ToMatrix().TransformPosition(Position);
+}
+
+FVector FTransform::TransformVector(const FVector& Vector) const
+{
+    return ToMatrix().TransformVector(Vector);
+}
+
+void FTransform::TransformPositions(const FVector* In, FVector* Out, size_t Count) const
+{
+    using namespace VectorRegister;
+
+    // 아핀 변환이라 W로 나눌 필요가 없다
+    const FMatrix Matrix = ToMatrix();
+    const FRegister Row0 = Matrix.GetRowRegister(0);
+    const FRegister Row1 = Matrix.GetRowRegister(1);
+    const FRegister Row2 = Matrix.GetRowRegister(2);
+    const FRegister Row3 = Matrix.GetRowRegister(3);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const FVector Position = In[i];
+
+        FRegister Sum = MultiplyAdd(Replicate(Position.X), Row0, Row3);
+        Sum = MultiplyAdd(Replicate(Position.Y), Row1, Sum);
+        Sum = MultiplyAdd(Replicate(Position.Z), Row2, Sum);
+
+        alignas(16) float Result[4];
+        Store(Result, Sum);
+        Out[i] = FVector(Result[0], Result[1], Result[2]);
+    }
+}
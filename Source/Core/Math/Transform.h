@@ -0,0 +1,39 @@
+﻿#pragma once
+#include <cstddef>
+
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Vector.h"
+
+
+/**
+ * 위치, 회전, 크기로 표현한 변환
+ * Scale → Rotation → Location 순서로 적용된다.
+ */
+struct FTransform
+{
+    FVector Location;
+
+    /** 오일러 각(라디안), X = Pitch, Y = Yaw, Z = Roll */
+    FVector Rotation;
+
+    FVector Scale = FVector(1.0f, 1.0f, 1.0f);
+
+    FTransform() = default;
+    FTransform(const FVector& Location, const FVector& Rotation, const FVector& Scale)
+        : Location(Location), Rotation(Rotation), Scale(Scale)
+    {
+    }
+
+    /** Scale * Rotation * Translation */
+    FMatrix ToMatrix() const;
+
+    FVector TransformPosition(const FVector& Position) const;
+    FVector TransformVector(const FVector& Vector) const;
+
+    /**
+     * 점 Count개를 한 번에 변환합니다.
+     * 행렬은 한 번만 만들고, 각 점은 행 세 개를 곱해 더하는 것으로 끝난다.
+     * In과 Out은 같은 배열이어도 된다.
+     */
+    void TransformPositions(const FVector* In, FVector* Out, size_t Count) const;
+};
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <cmath>
 
 
 struct FVector
@@ -36,3 +37,112 @@ struct FVector
     bool operator==(const FVector& Other) const;
     bool operator!=(const FVector& Other) const;
 };
+
+inline float FVector::DotProduct(const FVector& A, const FVector& B)
+{
+    return A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+}
+
+inline FVector FVector::CrossProduct(const FVector& A, const FVector& B)
+{
+    return {
+        A.Y * B.Z - A.Z * B.Y,
+        A.Z * B.X - A.X * B.Z,
+        A.X * B.Y - A.Y * B.X
+    };
+}
+
+inline float FVector::Length() const
+{
+    return sqrtf(X*X + Y*Y + Z*Z);
+}
+
+inline float FVector::LengthSquared() const
+{
+    return X*X + Y*Y + Z*Z;
+}
+
+inline FVector FVector::Normalize() const
+{
+    const float VecLength = Length();
+    return {X / VecLength, Y / VecLength, Z / VecLength};
+}
+
+inline float FVector::Dot(const FVector& Other) const
+{
+    return DotProduct(*this, Other);
+}
+
+inline FVector FVector::Cross(const FVector& Other) const
+{
+    return CrossProduct(*this, Other);
+}
+
+inline FVector FVector::operator+(const FVector& Other) const
+{
+    return {X + Other.X, Y + Other.Y, Z + Other.Z};
+}
+
+inline FVector& FVector::operator+=(const FVector& Other)
+{
+    X += Other.X; Y += Other.Y; Z += Other.Z;
+    return *this;
+}
+
+inline FVector FVector::operator-(const FVector& Other) const
+{
+    return {X - Other.X, Y - Other.Y, Z - Other.Z};
+}
+
+inline FVector& FVector::operator-=(const FVector& Other)
+{
+    X -= Other.X; Y -= Other.Y; Z -= Other.Z;
+    return *this;
+}
+
+inline FVector FVector::operator*(const FVector& Other) const
+{
+    return {X * Other.X, Y * Other.Y, Z * Other.Z};
+}
+
+inline FVector FVector::operator*(float Scalar) const
+{
+    return {X * Scalar, Y * Scalar, Z * Scalar};
+}
+
+inline FVector& FVector::operator*=(float Scalar)
+{
+    X *= Scalar; Y *= Scalar; Z *= Scalar;
+    return *this;
+}
+
+inline FVector FVector::operator/(const FVector& Other) const
+{
+    return {X / Other.X, Y / Other.Y, Z / Other.Z};
+}
+
+inline FVector FVector::operator/(float Scalar) const
+{
+    return {X / Scalar, Y / Scalar, Z / Scalar};
+}
+
+inline FVector& FVector::operator/=(float Scalar)
+{
+    X /= Scalar; Y /= Scalar; Z /= Scalar;
+    return *this;
+}
+
+inline FVector FVector::operator-() const
+{
+    return {-X, -Y, -Z};
+}
+
+inline bool FVector::operator==(const FVector& Other) const
+{
+    return X == Other.X && Y == Other.Y && Z == Other.Z;
+}
+
+inline bool FVector::operator!=(const FVector& Other) const
+{
+    return X != Other.X || Y != Other.Y || Z != Other.Z;
+}
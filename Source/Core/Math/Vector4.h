@@ -0,0 +1,173 @@
+﻿#pragma once
+#include "Core/Math/Vector.h"
+#include "Core/Math/VectorRegister.h"
+
+
+/**
+ * 16바이트 정렬된 4성분 벡터, 연산은 SIMD 레지스터 하나로 처리한다.
+ * FVector와 같은 함수를 제공하며, Dot/Cross/Length/Normalize는 XYZ만 보고 W는 0으로 돌려준다.
+ * 사칙연산은 W까지 네 성분 모두에 적용된다.
+ */
+struct alignas(16) FVector4
+{
+    float X, Y, Z, W;
+    FVector4() : X(0), Y(0), Z(0), W(0) {}
+    FVector4(float X, float Y, float Z, float W = 0.0f) : X(X), Y(Y), Z(Z), W(W) {}
+    explicit FVector4(const FVector& Vector, float W = 0.0f) : X(Vector.X), Y(Vector.Y), Z(Vector.Z), W(W) {}
+
+    FVector ToVector() const { return { X, Y, Z }; }
+
+    static FVector4 FromRegister(VectorRegister::FRegister Register);
+    VectorRegister::FRegister ToRegister() const { return VectorRegister::Load(&X); }
+
+    static float DotProduct(const FVector4& A, const FVector4& B);
+    static FVector4 CrossProduct(const FVector4& A, const FVector4& B);
+
+    /** W까지 포함한 내적 */
+    static float DotProduct4(const FVector4& A, const FVector4& B);
+
+    float Length() const;
+    float LengthSquared() const;
+    FVector4 Normalize() const;
+
+    float Dot(const FVector4& Other) const;
+    FVector4 Cross(const FVector4& Other) const;
+
+    FVector4 operator+(const FVector4& Other) const;
+    FVector4& operator+=(const FVector4& Other);
+
+    FVector4 operator-(const FVector4& Other) const;
+    FVector4& operator-=(const FVector4& Other);
+
+    FVector4 operator*(const FVector4& Other) const;
+    FVector4 operator*(float Scalar) const;
+    FVector4& operator*=(float Scalar);
+
+    FVector4 operator/(const FVector4& Other) const;
+    FVector4 operator/(float Scalar) const;
+    FVector4& operator/=(float Scalar);
+
+    FVector4 operator-() const;
+
+    bool operator==(const FVector4& Other) const;
+    bool operator!=(const FVector4& Other) const;
+};
+
+static_assert(sizeof(FVector4) == 16 && alignof(FVector4) == 16);
+
+inline FVector4 FVector4::FromRegister(VectorRegister::FRegister Register)
+{
+    FVector4 Result;
+    VectorRegister::Store(&Result.X, Register);
+    return Result;
+}
+
+inline float FVector4::DotProduct(const FVector4& A, const FVector4& B)
+{
+    return VectorRegister::GetX(VectorRegister::Dot3(A.ToRegister(), B.ToRegister()));
+}
+
+inline FVector4 FVector4::CrossProduct(const FVector4& A, const FVector4& B)
+{
+    return FromRegister(VectorRegister::Cross3(A.ToRegister(), B.ToRegister()));
+}
+
+inline float FVector4::DotProduct4(const FVector4& A, const FVector4& B)
+{
+    return VectorRegister::GetX(VectorRegister::Dot4(A.ToRegister(), B.ToRegister()));
+}
+
+inline float FVector4::Length() const
+{
+    return std::sqrt(LengthSquared());
+}
+
+inline float FVector4::LengthSquared() const
+{
+    return DotProduct(*this, *this);
+}
+
+inline FVector4 FVector4::Normalize() const
+{
+    using namespace VectorRegister;
+
+    // FVector::Normalize와 같은 결과가 나오도록 역수 근사 대신 나눗셈을 씀
+    const FRegister Vector = ToRegister();
+    const FRegister VecLength = Sqrt(Dot3(Vector, Vector));
+    return FromRegister(ClearW(Divide(Vector, VecLength)));
+}
+
+inline float FVector4::Dot(const FVector4& Other) const
+{
+    return DotProduct(*this, Other);
+}
+
+inline FVector4 FVector4::Cross(const FVector4& Other) const
+{
+    return CrossProduct(*this, Other);
+}
+
+inline FVector4 FVector4::operator+(const FVector4& Other) const
+{
+    return FromRegister(VectorRegister::Add(ToRegister(), Other.ToRegister()));
+}
+
+inline FVector4& FVector4::operator+=(const FVector4& Other)
+{
+    return *this = *this + Other;
+}
+
+inline FVector4 FVector4::operator-(const FVector4& Other) const
+{
+    return FromRegister(VectorRegister::Subtract(ToRegister(), Other.ToRegister()));
+}
+
+inline FVector4& FVector4::operator-=(const FVector4& Other)
+{
+    return *this = *this - Other;
+}
+
+inline FVector4 FVector4::operator*(const FVector4& Other) const
+{
+    return FromRegister(VectorRegister::Multiply(ToRegister(), Other.ToRegister()));
+}
+
+inline FVector4 FVector4::operator*(float Scalar) const
+{
+    return FromRegister(VectorRegister::Multiply(ToRegister(), VectorRegister::Replicate(Scalar)));
+}
+
+inline FVector4& FVector4::operator*=(float Scalar)
+{
+    return *this = *this * Scalar;
+}
+
+inline FVector4 FVector4::operator/(const FVector4& Other) const
+{
+    return FromRegister(VectorRegister::Divide(ToRegister(), Other.ToRegister()));
+}
+
+inline FVector4 FVector4::operator/(float Scalar) const
+{
+    return FromRegister(VectorRegister::Divide(ToRegister(), VectorRegister::Replicate(Scalar)));
+}
+
+inline FVector4& FVector4::operator/=(float Scalar)
+{
+    return *this = *this / Scalar;
+}
+
+inline FVector4 FVector4::operator-() const
+{
+    return FromRegister(VectorRegister::Negate(ToRegister()));
+}
+
+inline bool FVector4::operator==(const FVector4& Other) const
+{
+    return VectorRegister::Equals(ToRegister(), Other.ToRegister());
+}
+
+inline bool FVector4::operator!=(const FVector4& Other) const
+{
+    return !(*this == Other);
+}
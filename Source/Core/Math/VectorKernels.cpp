@@ -0,0 +1,188 @@
+﻿#include "VectorKernels.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+#include "Core/Math/VectorRegister.h"
+
+#if MATH_USE_SSE
+#include <xmmintrin.h>
+#endif
+
+
+namespace
+{
+    float LengthScalar(float X, float Y, float Z)
+    {
+        return std::sqrt(X * X + Y * Y + Z * Z);
+    }
+
+#if MATH_USE_SSE
+    __m128 LengthSquared4(__m128 X, __m128 Y, __m128 Z)
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z));
+    }
+
+    /** 1 / sqrt(A), 근사값에 뉴턴-랩슨 한 번: y' = y * (1.5 - 0.5 * A * y^2) */
+    __m128 ReciprocalSqrtFast4(__m128 A)
+    {
+        const __m128 Estimate = _mm_rsqrt_ps(A);
+        const __m128 HalfA = _mm_mul_ps(A, _mm_set1_ps(0.5f));
+        const __m128 Correction = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(HalfA, _mm_mul_ps(Estimate, Estimate)));
+        return _mm_mul_ps(Estimate, Correction);
+    }
+#endif
+}
+
+void VectorKernels::DotN(const FConstVectorSpan& A, const FConstVectorSpan& B, std::span<float> Out)
+{
+    const size_t Num = Out.size();
+    assert(A.Num() >= Num && B.Num() >= Num);
+
+    size_t i = 0;
+#if MATH_USE_SSE
+    for (; i + 4 <= Num; i += 4)
+    {
+        const __m128 X = _mm_mul_ps(_mm_loadu_ps(&A.X[i]), _mm_loadu_ps(&B.X[i]));
+        const __m128 Y = _mm_mul_ps(_mm_loadu_ps(&A.Y[i]), _mm_loadu_ps(&B.Y[i]));
+        const __m128 Z = _mm_mul_ps(_mm_loadu_ps(&A.Z[i]), _mm_loadu_ps(&B.Z[i]));
+        _mm_storeu_ps(&Out[i], _mm_add_ps(_mm_add_ps(X, Y), Z));
+    }
+#endif
+    for (; i < Num; ++i)
+    {
+        Out[i] = A.X[i] * B.X[i] + A.Y[i] * B.Y[i] + A.Z[i] * B.Z[i];
+    }
+}
+
+void VectorKernels::DotN(const FConstVectorSpan& A, const FVector& B, std::span<float> Out)
+{
+    const size_t Num = Out.size();
+    assert(A.Num() >= Num);
+
+    size_t i = 0;
+#if MATH_USE_SSE
+    const __m128 BX = _mm_set1_ps(B.X);
+    const __m128 BY = _mm_set1_ps(B.Y);
+    const __m128 BZ = _mm_set1_ps(B.Z);
+    for (; i + 4 <= Num; i += 4)
+    {
+        const __m128 X = _mm_mul_ps(_mm_loadu_ps(&A.X[i]), BX);
+        const __m128 Y = _mm_mul_ps(_mm_loadu_ps(&A.Y[i]), BY);
+        const __m128 Z = _mm_mul_ps(_mm_loadu_ps(&A.Z[i]), BZ);
+        _mm_storeu_ps(&Out[i], _mm_add_ps(_mm_add_ps(X, Y), Z));
+    }
+#endif
+    for (; i < Num; ++i)
+    {
+        Out[i] = A.X[i] * B.X + A.Y[i] * B.Y + A.Z[i] * B.Z;
+    }
+}
+
+void VectorKernels::LengthSquaredN(const FConstVectorSpan& V, std::span<float> Out)
+{
+    DotN(V, V, Out);
+}
+
+void VectorKernels::LengthN(const FConstVectorSpan& V, std::span<float> Out, ESqrtMode Mode)
+{
+    const size_t Num = Out.size();
+    assert(V.Num() >= Num);
+
+    size_t i = 0;
+#if MATH_USE_SSE
+    if (Mode == ESqrtMode::Fast)
+    {
+        // |V| = |V|^2 * (1 / |V|), rsqrt는 비정규 수를 0으로 보고 무한대를 내므로 FLT_MIN 미만은 0으로
+        // 제곱이 무한대로 넘치면 rsqrt가 0이 되어 inf * 0 = NaN이므로, Exact처럼 무한대를 그대로 씀
+        const __m128 MinLengthSq = _mm_set1_ps(FLT_MIN);
+        const __m128 MaxLengthSq = _mm_set1_ps(FLT_MAX);
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 LengthSq = LengthSquared4(_mm_loadu_ps(&V.X[i]), _mm_loadu_ps(&V.Y[i]), _mm_loadu_ps(&V.Z[i]));
+            const __m128 Length = _mm_mul_ps(LengthSq, ReciprocalSqrtFast4(LengthSq));
+            const __m128 InRange = _mm_and_ps(_mm_cmpge_ps(LengthSq, MinLengthSq), _mm_cmple_ps(LengthSq, MaxLengthSq));
+            const __m128 Overflow = _mm_and_ps(LengthSq, _mm_cmpgt_ps(LengthSq, MaxLengthSq));
+            _mm_storeu_ps(&Out[i], _mm_or_ps(_mm_and_ps(Length, InRange), Overflow));
+        }
+    }
+    else
+    {
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 LengthSq = LengthSquared4(_mm_loadu_ps(&V.X[i]), _mm_loadu_ps(&V.Y[i]), _mm_loadu_ps(&V.Z[i]));
+            _mm_storeu_ps(&Out[i], _mm_sqrt_ps(LengthSq));
+        }
+    }
+#else
+    (void)Mode;
+#endif
+    for (; i < Num; ++i)
+    {
+        Out[i] = LengthScalar(V.X[i], V.Y[i], V.Z[i]);
+    }
+}
+
+void VectorKernels::NormalizeN(const FVectorSpan& V, ESqrtMode Mode)
+{
+    const size_t Num = V.Num();
+    assert(V.Y.size() >= Num && V.Z.size() >= Num);
+
+    size_t i = 0;
+#if MATH_USE_SSE
+    if (Mode == ESqrtMode::Fast)
+    {
+        // 제곱이 무한대로 넘치면 Newton-Raphson이 NaN을 내므로 0으로, Exact도 X / inf = 0이라 결과가 같음
+        const __m128 MinLengthSq = _mm_set1_ps(FLT_MIN);
+        const __m128 MaxLengthSq = _mm_set1_ps(FLT_MAX);
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 X = _mm_loadu_ps(&V.X[i]);
+            const __m128 Y = _mm_loadu_ps(&V.Y[i]);
+            const __m128 Z = _mm_loadu_ps(&V.Z[i]);
+            const __m128 LengthSq = LengthSquared4(X, Y, Z);
+            const __m128 InRange = _mm_and_ps(_mm_cmpge_ps(LengthSq, MinLengthSq), _mm_cmple_ps(LengthSq, MaxLengthSq));
+            const __m128 InvLength = _mm_and_ps(ReciprocalSqrtFast4(LengthSq), InRange);
+            _mm_storeu_ps(&V.X[i], _mm_mul_ps(X, InvLength));
+            _mm_storeu_ps(&V.Y[i], _mm_mul_ps(Y, InvLength));
+            _mm_storeu_ps(&V.Z[i], _mm_mul_ps(Z, InvLength));
+        }
+    }
+    else
+    {
+        // 역수를 곱하지 않고 성분마다 나눠야 FVector::Normalize와 같은 값이 나옴
+        const __m128 Zero = _mm_setzero_ps();
+        for (; i + 4 <= Num; i += 4)
+        {
+            const __m128 X = _mm_loadu_ps(&V.X[i]);
+            const __m128 Y = _mm_loadu_ps(&V.Y[i]);
+            const __m128 Z = _mm_loadu_ps(&V.Z[i]);
+            const __m128 LengthSq = LengthSquared4(X, Y, Z);
+            const __m128 Length = _mm_sqrt_ps(LengthSq);
+            const __m128 NonZero = _mm_cmpgt_ps(LengthSq, Zero);
+            _mm_storeu_ps(&V.X[i], _mm_and_ps(_mm_div_ps(X, Length), NonZero));
+            _mm_storeu_ps(&V.Y[i], _mm_and_ps(_mm_div_ps(Y, Length), NonZero));
+            _mm_storeu_ps(&V.Z[i], _mm_and_ps(_mm_div_ps(Z, Length), NonZero));
+        }
+    }
+#else
+    (void)Mode;
+#endif
+    for (; i < Num; ++i)
+    {
+        const float Length = LengthScalar(V.X[i], V.Y[i], V.Z[i]);
+        if (Length > 0.0f)
+        {
+            V.X[i] /= Length;
+            V.Y[i] /= Length;
+            V.Z[i] /= Length;
+        }
+        else
+        {
+            V.X[i] = 0.0f;
+            V.Y[i] = 0.0f;
+            V.Z[i] = 0.0f;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <span>
+
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/Vector.h"
+
+
+/**
+ * X, Y, Z 채널을 각각 연속된 float 배열로 둔 벡터 배열(SoA)에 대한 뷰
+ * 세 채널의 길이는 같아야 한다.
+ */
+struct FVectorSpan
+{
+    std::span<float> X;
+    std::span<float> Y;
+    std::span<float> Z;
+
+    size_t Num() const { return X.size(); }
+};
+
+struct FConstVectorSpan
+{
+    std::span<const float> X;
+    std::span<const float> Y;
+    std::span<const float> Z;
+
+    FConstVectorSpan() = default;
+    FConstVectorSpan(std::span<const float> X, std::span<const float> Y, std::span<const float> Z) : X(X), Y(Y), Z(Z) {}
+    FConstVectorSpan(const FVectorSpan& Span) : X(Span.X), Y(Span.Y), Z(Span.Z) {}
+
+    size_t Num() const { return X.size(); }
+};
+
+/** 제곱근이 들어가는 커널의 정밀도 */
+enum class ESqrtMode : uint8
+{
+    /**
+     * sqrt와 나눗셈을 그대로 씀
+     * 길이가 0이 아니면 FVector::Length, FVector::Normalize와 비트 단위로 같은 결과
+     */
+    Exact,
+
+    /**
+     * 역제곱근 근사(SSE rsqrt)에 뉴턴-랩슨 한 번을 더한 값
+     * 상대 오차는 4e-7 이하 (2^-21 ≈ 4.8e-7보다 조금 작음), 정규화한 벡터의 길이는 1에서 그만큼 벗어날 수 있다.
+     * SIMD를 쓸 수 없으면 Exact와 같다.
+     */
+    Fast,
+};
+
+/**
+ * 벡터 배열을 한 번에 처리하는 함수들
+ * 4개씩 SIMD로 처리하고 남는 원소는 스칼라로 처리한다. 정렬은 요구하지 않는다.
+ * 출력은 입력과 같은 배열이어도 된다.
+ */
+namespace VectorKernels
+{
+    /** Out[i] = A[i] · B[i] */
+    void DotN(const FConstVectorSpan& A, const FConstVectorSpan& B, std::span<float> Out);
+
+    /** Out[i] = A[i] · B, 모든 원소에 같은 벡터를 내적 (행렬의 한 열을 곱할 때) */
+    void DotN(const FConstVectorSpan& A, const FVector& B, std::span<float> Out);
+
+    /** Out[i] = |V[i]|^2 */
+    void LengthSquaredN(const FConstVectorSpan& V, std::span<float> Out);
+
+    /** Out[i] = |V[i]|, 길이의 제곱이 float 범위를 넘으면 두 모드 모두 무한대 */
+    void LengthN(const FConstVectorSpan& V, std::span<float> Out, ESqrtMode Mode = ESqrtMode::Exact);
+
+    /**
+     * V[i]를 제자리에서 정규화합니다.
+     * 길이가 0인 벡터는 NaN 대신 0 벡터가 된다. Fast는 길이의 제곱이 FLT_MIN보다 작은 벡터도 0 벡터로 만든다.
+     * 길이의 제곱이 float 범위를 넘는 벡터는 두 모드 모두 0 벡터가 된다.
+     */
+    void NormalizeN(const FVectorSpan& V, ESqrtMode Mode = ESqrtMode::Exact);
+}
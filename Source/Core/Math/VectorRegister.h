@@ -0,0 +1,169 @@
+﻿#pragma once
+#include <cmath>
+
+/**
+ * 4개짜리 float SIMD 레지스터를 감싼 함수들
+ * x86은 SSE2, ARM은 NEON을 쓰고, 둘 다 없거나 MATH_NO_SIMD가 1이면 일반 float 배열로 계산한다.
+ * 포인터를 받는 Load/Store는 16바이트 정렬된 주소만 받는다.
+ */
+#ifndef MATH_NO_SIMD
+#define MATH_NO_SIMD 0
+#endif
+
+#if !MATH_NO_SIMD && (defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__))
+#include <emmintrin.h>
+#define MATH_USE_SSE 1
+#define MATH_USE_NEON 0
+#elif !MATH_NO_SIMD && (defined(_M_ARM64) || defined(__aarch64__))
+#include <arm_neon.h>
+#define MATH_USE_SSE 0
+#define MATH_USE_NEON 1
+#else
+#define MATH_USE_SSE 0
+#define MATH_USE_NEON 0
+#endif
+
+
+namespace VectorRegister
+{
+#if MATH_USE_SSE
+
+    using FRegister = __m128;
+
+    inline FRegister Load(const float* Ptr) { return _mm_load_ps(Ptr); }
+    inline void Store(float* Ptr, FRegister V) { _mm_store_ps(Ptr, V); }
+    inline FRegister Set(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+    inline FRegister Replicate(float Value) { return _mm_set1_ps(Value); }
+
+    inline FRegister Add(FRegister A, FRegister B) { return _mm_add_ps(A, B); }
+    inline FRegister Subtract(FRegister A, FRegister B) { return _mm_sub_ps(A, B); }
+    inline FRegister Multiply(FRegister A, FRegister B) { return _mm_mul_ps(A, B); }
+    inline FRegister Divide(FRegister A, FRegister B) { return _mm_div_ps(A, B); }
+    inline FRegister Negate(FRegister A) { return _mm_sub_ps(_mm_setzero_ps(), A); }
+
+    /** A * B + C */
+    inline FRegister MultiplyAdd(FRegister A, FRegister B, FRegister C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+
+    /** W 성분을 0으로 */
+    inline FRegister ClearW(FRegister A)
+    {
+        return _mm_and_ps(A, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+    }
+
+    /** XYZ 세 성분의 내적을 모든 성분에 */
+    inline FRegister Dot3(FRegister A, FRegister B)
+    {
+        const __m128 Product = _mm_mul_ps(A, B);
+        const __m128 Y = _mm_shuffle_ps(Product, Product, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 Z = _mm_shuffle_ps(Product, Product, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 Sum = _mm_add_ss(_mm_add_ss(Product, Y), Z);
+        return _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(0, 0, 0, 0));
+    }
+
+    /** 네 성분 모두의 내적을 모든 성분에 */
+    inline FRegister Dot4(FRegister A, FRegister B)
+    {
+        const __m128 Product = _mm_mul_ps(A, B);
+        const __m128 Pair = _mm_add_ps(Product, _mm_shuffle_ps(Product, Product, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(Pair, _mm_shuffle_ps(Pair, Pair, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    /** XYZ 외적, W는 0 */
+    inline FRegister Cross3(FRegister A, FRegister B)
+    {
+        const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 C = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+        return _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    inline FRegister Sqrt(FRegister A) { return _mm_sqrt_ps(A); }
+    inline float GetX(FRegister A) { return _mm_cvtss_f32(A); }
+
+    /** 네 성분이 모두 같은지 */
+    inline bool Equals(FRegister A, FRegister B) { return _mm_movemask_ps(_mm_cmpeq_ps(A, B)) == 0xF; }
+
+#elif MATH_USE_NEON
+
+    using FRegister = float32x4_t;
+
+    inline FRegister Load(const float* Ptr) { return vld1q_f32(Ptr); }
+    inline void Store(float* Ptr, FRegister V) { vst1q_f32(Ptr, V); }
+    inline FRegister Set(float X, float Y, float Z, float W)
+    {
+        alignas(16) const float Values[4] = { X, Y, Z, W };
+        return vld1q_f32(Values);
+    }
+    inline FRegister Replicate(float Value) { return vdupq_n_f32(Value); }
+
+    inline FRegister Add(FRegister A, FRegister B) { return vaddq_f32(A, B); }
+    inline FRegister Subtract(FRegister A, FRegister B) { return vsubq_f32(A, B); }
+    inline FRegister Multiply(FRegister A, FRegister B) { return vmulq_f32(A, B); }
+    inline FRegister Divide(FRegister A, FRegister B) { return vdivq_f32(A, B); }
+    inline FRegister Negate(FRegister A) { return vnegq_f32(A); }
+    inline FRegister MultiplyAdd(FRegister A, FRegister B, FRegister C) { return vmlaq_f32(C, A, B); }
+    inline FRegister ClearW(FRegister A) { return vsetq_lane_f32(0.0f, A, 3); }
+
+    inline FRegister Dot3(FRegister A, FRegister B)
+    {
+        const float32x4_t Product = vmulq_f32(A, B);
+        return vdupq_n_f32(vgetq_lane_f32(Product, 0) + vgetq_lane_f32(Product, 1) + vgetq_lane_f32(Product, 2));
+    }
+
+    inline FRegister Dot4(FRegister A, FRegister B) { return vdupq_n_f32(vaddvq_f32(vmulq_f32(A, B))); }
+
+    inline FRegister Cross3(FRegister A, FRegister B)
+    {
+        // (Y, Z, X, W) 순서로 섞기: [Y Z W X]에서 W와 X 자리를 바꿈
+        const float32x4_t ARotated = vextq_f32(A, A, 1);
+        const float32x4_t BRotated = vextq_f32(B, B, 1);
+        const float32x4_t AYZX = vsetq_lane_f32(vgetq_lane_f32(A, 0), vsetq_lane_f32(vgetq_lane_f32(A, 3), ARotated, 3), 2);
+        const float32x4_t BYZX = vsetq_lane_f32(vgetq_lane_f32(B, 0), vsetq_lane_f32(vgetq_lane_f32(B, 3), BRotated, 3), 2);
+        const float32x4_t C = vsubq_f32(vmulq_f32(A, BYZX), vmulq_f32(AYZX, B));
+        const float32x4_t CRotated = vextq_f32(C, C, 1);
+        return vsetq_lane_f32(0.0f, vsetq_lane_f32(vgetq_lane_f32(C, 0), CRotated, 2), 3);
+    }
+
+    inline FRegister Sqrt(FRegister A) { return vsqrtq_f32(A); }
+    inline float GetX(FRegister A) { return vgetq_lane_f32(A, 0); }
+    inline bool Equals(FRegister A, FRegister B) { return vminvq_u32(vceqq_f32(A, B)) != 0; }
+
+#else
+
+    struct FRegister
+    {
+        float V[4];
+    };
+
+    inline FRegister Load(const float* Ptr) { return { { Ptr[0], Ptr[1], Ptr[2], Ptr[3] } }; }
+    inline void Store(float* Ptr, FRegister A) { Ptr[0] = A.V[0]; Ptr[1] = A.V[1]; Ptr[2] = A.V[2]; Ptr[3] = A.V[3]; }
+    inline FRegister Set(float X, float Y, float Z, float W) { return { { X, Y, Z, W } }; }
+    inline FRegister Replicate(float Value) { return { { Value, Value, Value, Value } }; }
+
+    inline FRegister Add(FRegister A, FRegister B) { return { { A.V[0] + B.V[0], A.V[1] + B.V[1], A.V[2] + B.V[2], A.V[3] + B.V[3] } }; }
+    inline FRegister Subtract(FRegister A, FRegister B) { return { { A.V[0] - B.V[0], A.V[1] - B.V[1], A.V[2] - B.V[2], A.V[3] - B.V[3] } }; }
+    inline FRegister Multiply(FRegister A, FRegister B) { return { { A.V[0] * B.V[0], A.V[1] * B.V[1], A.V[2] * B.V[2], A.V[3] * B.V[3] } }; }
+    inline FRegister Divide(FRegister A, FRegister B) { return { { A.V[0] / B.V[0], A.V[1] / B.V[1], A.V[2] / B.V[2], A.V[3] / B.V[3] } }; }
+    inline FRegister Negate(FRegister A) { return { { -A.V[0], -A.V[1], -A.V[2], -A.V[3] } }; }
+    inline FRegister MultiplyAdd(FRegister A, FRegister B, FRegister C) { return Add(Multiply(A, B), C); }
+    inline FRegister ClearW(FRegister A) { return { { A.V[0], A.V[1], A.V[2], 0.0f } }; }
+
+    inline FRegister Dot3(FRegister A, FRegister B) { return Replicate(A.V[0] * B.V[0] + A.V[1] * B.V[1] + A.V[2] * B.V[2]); }
+    inline FRegister Dot4(FRegister A, FRegister B) { return Replicate(A.V[0] * B.V[0] + A.V[1] * B.V[1] + A.V[2] * B.V[2] + A.V[3] * B.V[3]); }
+
+    inline FRegister Cross3(FRegister A, FRegister B)
+    {
+        return { {
+            A.V[1] * B.V[2] - A.V[2] * B.V[1],
+            A.V[2] * B.V[0] - A.V[0] * B.V[2],
+            A.V[0] * B.V[1] - A.V[1] * B.V[0],
+            0.0f
+        } };
+    }
+
+    inline FRegister Sqrt(FRegister A) { return { { std::sqrt(A.V[0]), std::sqrt(A.V[1]), std::sqrt(A.V[2]), std::sqrt(A.V[3]) } }; }
+    inline float GetX(FRegister A) { return A.V[0]; }
+    inline bool Equals(FRegister A, FRegister B) { return A.V[0] == B.V[0] && A.V[1] == B.V[1] && A.V[2] == B.V[2] && A.V[3] == B.V[3]; }
+
+#endif
+}
@@ -0,0 +1,150 @@
+﻿#include "FrameArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+
+FFrameArena::FFrameArena(size_t InBlockSize)
+    : BlockSize(InBlockSize)
+{
+}
+
+FFrameArena::~FFrameArena()
+{
+    FreeBlocks(First);
+}
+
+FFrameArena& FFrameArena::Get()
+{
+    thread_local FFrameArena Arena;
+    return Arena;
+}
+
+void* FFrameArena::Allocate(size_t Size, size_t Alignment)
+{
+    assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0);
+
+    if (Current)
+    {
+        const uintptr_t Base = reinterpret_cast<uintptr_t>(Current->GetData());
+        const size_t Aligned = ((Base + Offset + Alignment - 1) & ~(Alignment - 1)) - Base;
+        if (Aligned + Size <= Current->Size)
+        {
+            Offset = Aligned + Size;
+            return Current->GetData() + Aligned;
+        }
+    }
+
+    // 블록 시작은 max_align_t 정렬이므로 그보다 큰 정렬만 여유를 더 둠
+    AdvanceBlock(Size + (Alignment > alignof(std::max_align_t) ? Alignment : 0));
+
+    const uintptr_t Base = reinterpret_cast<uintptr_t>(Current->GetData());
+    const size_t Aligned = ((Base + Alignment - 1) & ~(Alignment - 1)) - Base;
+    Offset = Aligned + Size;
+    return Current->GetData() + Aligned;
+}
+
+void FFrameArena::Free(void* Ptr, size_t Size)
+{
+    if (Current && static_cast<std::byte*>(Ptr) + Size == Current->GetData() + Offset)
+    {
+        Offset -= Size;
+    }
+}
+
+void FFrameArena::Reset()
+{
+    const size_t Used = GetBytesUsed();
+    LastFrameBytes = Used;
+    HighWaterMark = std::max(HighWaterMark, Used);
+
+    // 블록이 여러 개였으면 다음 프레임부터는 한 블록에 들어가도록 합침
+    if (First && First->Next)
+    {
+        const size_t Total = GetCapacity();
+        FreeBlocks(First);
+        First = AllocateBlock(Total);
+    }
+
+    Current = First;
+    Offset = 0;
+    UsedInPreviousBlocks = 0;
+}
+
+size_t FFrameArena::GetHighWaterMark() const
+{
+    return std::max(HighWaterMark, GetBytesUsed());
+}
+
+size_t FFrameArena::GetCapacity() const
+{
+    size_t Total = 0;
+    for (const FBlock* Block = First; Block; Block = Block->Next)
+    {
+        Total += Block->Size;
+    }
+    return Total;
+}
+
+void FFrameArena::AdvanceBlock(size_t MinSize)
+{
+    if (Current == nullptr)
+    {
+        if (First == nullptr)
+        {
+            First = AllocateBlock(std::max(BlockSize, MinSize));
+        }
+        Current = First;
+        return;
+    }
+
+    UsedInPreviousBlocks += Offset;
+    Offset = 0;
+
+    // Mark로 되돌아간 경우 이미 이어 둔 블록을 다시 씀
+    if (Current->Next && Current->Next->Size >= MinSize)
+    {
+        Current = Current->Next;
+        return;
+    }
+
+    // 크기가 맞지 않는 뒤쪽 블록은 버리고 새로 이음
+    FreeBlocks(Current->Next);
+    Current->Next = AllocateBlock(std::max(Current->Size * 2, MinSize));
+    Current = Current->Next;
+}
+
+FFrameArena::FBlock* FFrameArena::AllocateBlock(size_t Size)
+{
+    ++NumBlockAllocations;
+    void* Memory = ::operator new(sizeof(FBlock) + Size);
+    return new (Memory) FBlock{ nullptr, Size };
+}
+
+void FFrameArena::FreeBlocks(FBlock* Block)
+{
+    while (Block)
+    {
+        FBlock* Next = Block->Next;
+        ::operator delete(Block);
+        Block = Next;
+    }
+}
+
+FFrameArenaMark::FFrameArenaMark(FFrameArena& InArena)
+    : Arena(InArena)
+    , Block(InArena.Current)
+    , Offset(InArena.Offset)
+    , UsedInPreviousBlocks(InArena.UsedInPreviousBlocks)
+{
+}
+
+FFrameArenaMark::~FFrameArenaMark()
+{
+    // 처음 할당 전에 만든 Mark면 Block이 nullptr, 첫 블록의 처음으로 되돌림
+    Arena.Current = Block ? Block : Arena.First;
+    Arena.Offset = Offset;
+    Arena.UsedInPreviousBlocks = UsedInPreviousBlocks;
+}
@@ -0,0 +1,140 @@
+﻿#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 한 프레임 동안만 쓰는 메모리를 위한 선형(bump) 할당자
+ *
+ * 포인터를 앞으로 밀기만 하고 개별 해제는 하지 않으며, 프레임 시작에 Reset으로 한꺼번에 되돌린다.
+ * 블록이 모자라면 블록을 더 이어 붙이고, 다음 Reset에서 그 프레임에 쓴 만큼을 한 블록으로 합치므로
+ * 사용량이 일정해지면 더 이상 힙 할당이 일어나지 않는다.
+ *
+ * 스레드마다 하나씩 있고(Get), 각 스레드가 자기 프레임 경계에서 Reset한다.
+ * 프레임 경계가 없는 작업 스레드는 FFrameArenaMark로 쓴 만큼을 되돌린다.
+ * Reset 뒤에는 이전 프레임에 받은 메모리를 쓰면 안 된다.
+ */
+class FFrameArena
+{
+public:
+    explicit FFrameArena(size_t InBlockSize = 64 * 1024);
+    ~FFrameArena();
+
+    FFrameArena(const FFrameArena&) = delete;
+    FFrameArena& operator=(const FFrameArena&) = delete;
+
+    /** 호출한 스레드의 아레나 */
+    static FFrameArena& Get();
+
+    /** @param Alignment 2의 거듭제곱 */
+    void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+    /** 가장 최근 할당이면 되돌리고, 아니면 아무것도 하지 않음 */
+    void Free(void* Ptr, size_t Size);
+
+    /** 프레임 시작에 호출, 지금까지 받은 메모리를 모두 되돌림 */
+    void Reset();
+
+    /** 이번 프레임에 쓴 바이트 (정렬로 버려진 바이트 포함) */
+    size_t GetBytesUsed() const { return UsedInPreviousBlocks + Offset; }
+
+    /** 지난 프레임에 쓴 바이트 */
+    size_t GetLastFrameBytes() const { return LastFrameBytes; }
+
+    /** 생성 이후 한 프레임에 쓴 가장 많은 바이트 */
+    size_t GetHighWaterMark() const;
+
+    /** 지금 잡고 있는 블록 크기의 합 */
+    size_t GetCapacity() const;
+
+    /** 블록이 모자라서 새 블록을 할당한 횟수, 안정된 뒤에는 늘지 않아야 함 */
+    uint64 GetNumBlockAllocations() const { return NumBlockAllocations; }
+
+private:
+    friend class FFrameArenaMark;
+
+    struct FBlock
+    {
+        FBlock* Next;
+        size_t Size;
+
+        std::byte* GetData() { return reinterpret_cast<std::byte*>(this + 1); }
+    };
+
+    /** Current 뒤에 Size 이상 들어가는 블록을 이어서 현재 블록으로 만듦 */
+    void AdvanceBlock(size_t MinSize);
+
+    FBlock* AllocateBlock(size_t Size);
+    void FreeBlocks(FBlock* Block);
+
+private:
+    FBlock* First = nullptr;
+    FBlock* Current = nullptr;
+    size_t Offset = 0;                 // Current 안에서 다음 할당 위치
+    size_t UsedInPreviousBlocks = 0;   // 이번 프레임에 Current 앞의 블록들에서 쓴 바이트
+
+    size_t BlockSize;
+    size_t LastFrameBytes = 0;
+    size_t HighWaterMark = 0;
+    uint64 NumBlockAllocations = 0;
+};
+
+/**
+ * 생성 시점의 아레나 위치를 기억했다가 소멸할 때 되돌린다.
+ * 이 범위 안에서 받은 메모리는 범위를 벗어나면 쓰면 안 된다.
+ */
+class FFrameArenaMark
+{
+public:
+    explicit FFrameArenaMark(FFrameArena& InArena = FFrameArena::Get());
+    ~FFrameArenaMark();
+
+    FFrameArenaMark(const FFrameArenaMark&) = delete;
+    FFrameArenaMark& operator=(const FFrameArenaMark&) = delete;
+
+private:
+    FFrameArena& Arena;
+    FFrameArena::FBlock* Block;
+    size_t Offset;
+    size_t UsedInPreviousBlocks;
+};
+
+/**
+ * FFrameArena에서 메모리를 받는 표준 할당자
+ * 기본 생성하면 만든 스레드의 아레나를 쓴다. 해제는 가장 최근 할당일 때만 되돌리므로,
+ * 배열이 자라면서 버려진 버퍼는 Reset까지 남는다. 크기를 알면 Reserve를 먼저 하는 것이 좋다.
+ */
+template <typename T>
+class TFrameAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    TFrameAllocator() : Arena(&FFrameArena::Get()) {}
+    explicit TFrameAllocator(FFrameArena& InArena) : Arena(&InArena) {}
+
+    template <typename U>
+    TFrameAllocator(const TFrameAllocator<U>& Other) : Arena(Other.GetArena()) {}
+
+    T* allocate(size_t Count) { return static_cast<T*>(Arena->Allocate(Count * sizeof(T), alignof(T))); }
+    void deallocate(T* Ptr, size_t Count) { Arena->Free(Ptr, Count * sizeof(T)); }
+
+    FFrameArena* GetArena() const { return Arena; }
+
+    template <typename U>
+    bool operator==(const TFrameAllocator<U>& Other) const { return Arena == Other.GetArena(); }
+
+private:
+    FFrameArena* Arena;
+};
+
+/** 프레임 안에서만 쓰는 임시 배열, 지역 변수로만 쓸 것 */
+template <typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
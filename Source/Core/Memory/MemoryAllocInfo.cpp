@@ -0,0 +1,295 @@
+﻿#include "MemoryAllocInfo.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+
+const char* GetMemoryTagName(EMemoryTag Tag)
+{
+    switch (Tag)
+    {
+    case EMemoryTag::Untagged:   return "Untagged";
+    case EMemoryTag::Simulation: return "Simulation";
+    case EMemoryTag::Renderer:   return "Renderer";
+    case EMemoryTag::Input:      return "Input";
+    case EMemoryTag::ImGui:      return "ImGui";
+    case EMemoryTag::Profiler:   return "Profiler";
+    default:                     return "Unknown";
+    }
+}
+
+#if WITH_MEMORY_TRACKING
+
+namespace
+{
+// 사용자 포인터 바로 앞에 붙는 헤더, 16바이트라 기본 new 정렬이 유지됨
+struct FAllocHeader
+{
+    uint64 Size;
+    uint32 Offset;      // 실제로 malloc한 주소에서 사용자 포인터까지의 거리
+    EMemoryTag Tag;
+    uint8 Padding[3];
+};
+static_assert(sizeof(FAllocHeader) == 16);
+
+constexpr size_t NumTags = static_cast<size_t>(EMemoryTag::Max);
+
+// 스레드마다 자기 슬롯만 쓰므로 원자 RMW 없이 load/store만으로 셈, 읽을 때 모든 슬롯을 더함
+// 다른 스레드가 할당한 메모리를 해제하면 한 슬롯의 LiveBytes는 음수가 될 수 있음
+struct alignas(64) FThreadCounters
+{
+    std::atomic<int64> LiveBytes[NumTags];
+    std::atomic<uint64> NumAllocations[NumTags];
+    std::atomic<uint64> NumFrees[NumTags];
+};
+
+// 슬롯이 모자라면 남은 스레드들은 마지막 슬롯을 함께 쓰며 그때만 원자 RMW를 씀
+constexpr uint32 MaxThreadSlots = 64;
+constexpr uint32 SharedSlot = MaxThreadSlots - 1;
+
+// operator new가 정적 초기화보다 먼저 불릴 수 있으므로 모두 상수 초기화되는 전역만 씀
+constinit FThreadCounters ThreadCounters[MaxThreadSlots] = {};
+constinit std::atomic<uint32> NumThreadSlots = 0;
+constinit std::atomic<uint64> SampledPeakBytes[NumTags + 1] = {};
+
+// BeginFrame을 부르는 스레드만 씀
+uint64 FrameStartAllocations[NumTags + 1] = {};
+uint64 LastFrameAllocations[NumTags + 1] = {};
+
+constinit thread_local EMemoryTag CurrentTag = EMemoryTag::Untagged;
+constinit thread_local uint32 ThreadSlot = MaxThreadSlots;
+
+template <typename T>
+void AddCounter(std::atomic<T>& Counter, T Value, bool bShared)
+{
+    if (bShared)
+    {
+        Counter.fetch_add(Value, std::memory_order_relaxed);
+    }
+    else
+    {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+    }
+}
+
+void CountAllocation(EMemoryTag Tag, int64 Size, bool bAllocate)
+{
+    if (ThreadSlot == MaxThreadSlots)
+    {
+        ThreadSlot = std::min(NumThreadSlots.fetch_add(1, std::memory_order_relaxed), SharedSlot);
+    }
+
+    FThreadCounters& Counters = ThreadCounters[ThreadSlot];
+    const bool bShared = ThreadSlot == SharedSlot;
+    const size_t Index = static_cast<size_t>(Tag);
+    AddCounter(Counters.LiveBytes[Index], bAllocate ? Size : -Size, bShared);
+    AddCounter(bAllocate ? Counters.NumAllocations[Index] : Counters.NumFrees[Index], uint64(1), bShared);
+}
+
+void UpdatePeak(std::atomic<uint64>& Peak, uint64 Live)
+{
+    uint64 Current = Peak.load(std::memory_order_relaxed);
+    while (Live > Current && !Peak.compare_exchange_weak(Current, Live, std::memory_order_relaxed))
+    {
+    }
+}
+
+/** Index가 NumTags면 모든 태그의 합 */
+FMemoryTagStats SumStats(size_t Index)
+{
+    const size_t FirstTag = Index < NumTags ? Index : 0;
+    const size_t LastTag = Index < NumTags ? Index : NumTags - 1;
+    const uint32 NumSlots = std::min(NumThreadSlots.load(std::memory_order_relaxed), MaxThreadSlots);
+
+    int64 LiveBytes = 0;
+    uint64 NumAllocations = 0;
+    uint64 NumFrees = 0;
+    for (uint32 Slot = 0; Slot < NumSlots; ++Slot)
+    {
+        for (size_t Tag = FirstTag; Tag <= LastTag; ++Tag)
+        {
+            LiveBytes += ThreadCounters[Slot].LiveBytes[Tag].load(std::memory_order_relaxed);
+            NumAllocations += ThreadCounters[Slot].NumAllocations[Tag].load(std::memory_order_relaxed);
+            NumFrees += ThreadCounters[Slot].NumFrees[Tag].load(std::memory_order_relaxed);
+        }
+    }
+
+    // 다른 스레드가 세는 중이면 해제가 먼저 보일 수 있음
+    FMemoryTagStats Stats;
+    Stats.LiveBytes = LiveBytes > 0 ? static_cast<uint64>(LiveBytes) : 0;
+    Stats.NumAllocations = NumAllocations;
+    Stats.NumLiveAllocations = NumAllocations > NumFrees ? NumAllocations - NumFrees : 0;
+
+    UpdatePeak(SampledPeakBytes[Index], Stats.LiveBytes);
+    Stats.SampledPeakBytes = SampledPeakBytes[Index].load(std::memory_order_relaxed);
+    Stats.FrameAllocations = LastFrameAllocations[Index];
+    return Stats;
+}
+
+void* TrackedAllocate(size_t Size, size_t Alignment, EMemoryTag Tag)
+{
+    assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0);
+
+    // 기본 정렬이면 헤더만 붙이고, 더 크면 정렬을 맞출 여유를 더 잡음
+    const bool bOverAligned = Alignment > sizeof(FAllocHeader);
+    const size_t Extra = sizeof(FAllocHeader) + (bOverAligned ? Alignment : 0);
+    if (Size > SIZE_MAX - Extra)
+    {
+        return nullptr;
+    }
+
+    std::byte* Base = static_cast<std::byte*>(std::malloc(Size + Extra));
+    if (Base == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::byte* User = Base + sizeof(FAllocHeader);
+    if (bOverAligned)
+    {
+        const uintptr_t Address = reinterpret_cast<uintptr_t>(User);
+        User += ((Address + Alignment - 1) & ~(Alignment - 1)) - Address;
+    }
+
+    FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(User) - 1;
+    Header->Size = Size;
+    Header->Offset = static_cast<uint32>(User - Base);
+    Header->Tag = Tag;
+
+    CountAllocation(Tag, static_cast<int64>(Size), true);
+    return User;
+}
+
+void TrackedFree(void* Ptr)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+
+    const FAllocHeader* Header = static_cast<const FAllocHeader*>(Ptr) - 1;
+    CountAllocation(Header->Tag, static_cast<int64>(Header->Size), false);
+    std::free(static_cast<std::byte*>(Ptr) - Header->Offset);
+}
+
+// operator new 규약대로 new_handler를 불러가며 다시 시도
+void* NewOrThrow(size_t Size, size_t Alignment)
+{
+    for (;;)
+    {
+        if (void* Ptr = TrackedAllocate(Size == 0 ? 1 : Size, Alignment, CurrentTag))
+        {
+            return Ptr;
+        }
+
+        const std::new_handler Handler = std::get_new_handler();
+        if (Handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        Handler();
+    }
+}
+
+void* NewOrNull(size_t Size, size_t Alignment) noexcept
+{
+    try
+    {
+        return NewOrThrow(Size, Alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+}
+
+
+void* FMemoryAllocInfo::Allocate(size_t Size, size_t Alignment, EMemoryTag Tag)
+{
+    return TrackedAllocate(Size, Alignment, Tag);
+}
+
+void FMemoryAllocInfo::Free(void* Ptr)
+{
+    TrackedFree(Ptr);
+}
+
+EMemoryTag FMemoryAllocInfo::GetCurrentTag()
+{
+    return CurrentTag;
+}
+
+void FMemoryAllocInfo::SetCurrentTag(EMemoryTag Tag)
+{
+    CurrentTag = Tag;
+}
+
+FMemoryTagStats FMemoryAllocInfo::GetStats(EMemoryTag Tag)
+{
+    return SumStats(static_cast<size_t>(Tag));
+}
+
+FMemoryTagStats FMemoryAllocInfo::GetTotalStats()
+{
+    return SumStats(NumTags);
+}
+
+void FMemoryAllocInfo::BeginFrame()
+{
+    // 피크도 여기서 함께 갱신됨
+    for (size_t Index = 0; Index <= NumTags; ++Index)
+    {
+        const uint64 Allocations = SumStats(Index).NumAllocations;
+        LastFrameAllocations[Index] = Allocations - FrameStartAllocations[Index];
+        FrameStartAllocations[Index] = Allocations;
+    }
+}
+
+// 전역 operator new/delete 교체, 링크 시점에 기본 구현 대신 쓰임
+void* operator new(size_t Size) { return NewOrThrow(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t Size) { return NewOrThrow(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t Size, const std::nothrow_t&) noexcept { return NewOrNull(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept { return NewOrNull(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t Size, std::align_val_t Alignment) { return NewOrThrow(Size, static_cast<size_t>(Alignment)); }
+void* operator new[](size_t Size, std::align_val_t Alignment) { return NewOrThrow(Size, static_cast<size_t>(Alignment)); }
+void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return NewOrNull(Size, static_cast<size_t>(Alignment)); }
+void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return NewOrNull(Size, static_cast<size_t>(Alignment)); }
+
+void operator delete(void* Ptr) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr) noexcept { TrackedFree(Ptr); }
+void operator delete(void* Ptr, size_t) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr, size_t) noexcept { TrackedFree(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::align_val_t) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { TrackedFree(Ptr); }
+void operator delete(void* Ptr, size_t, std::align_val_t) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr, size_t, std::align_val_t) noexcept { TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(Ptr); }
+
+#else
+
+void* FMemoryAllocInfo::Allocate(size_t Size, [[maybe_unused]] size_t Alignment, EMemoryTag)
+{
+    assert(Alignment <= alignof(std::max_align_t));
+    return std::malloc(Size);
+}
+
+void FMemoryAllocInfo::Free(void* Ptr)
+{
+    std::free(Ptr);
+}
+
+EMemoryTag FMemoryAllocInfo::GetCurrentTag() { return EMemoryTag::Untagged; }
+void FMemoryAllocInfo::SetCurrentTag(EMemoryTag) {}
+FMemoryTagStats FMemoryAllocInfo::GetStats(EMemoryTag) { return {}; }
+FMemoryTagStats FMemoryAllocInfo::GetTotalStats() { return {}; }
+void FMemoryAllocInfo::BeginFrame() {}
+
+#endif
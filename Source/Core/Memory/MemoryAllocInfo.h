@@ -0,0 +1,98 @@
+﻿#pragma once
+#include <cstddef>
+
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 1이면 전역 operator new/delete를 바꿔서 모든 할당을 태그별로 센다.
+ * 할당마다 16바이트 헤더와 스레드별 카운터 갱신이 더해지므로 기본은 꺼 두고,
+ * t0.vcxproj의 Profile 구성처럼 프로젝트에서 WITH_MEMORY_TRACKING=1을 정의해서 켠다.
+ * 0이면 operator new를 바꾸지 않고, MEMORY_TAG_SCOPE는 아무 코드도 만들지 않는다.
+ */
+#ifndef WITH_MEMORY_TRACKING
+#define WITH_MEMORY_TRACKING 0
+#endif
+
+
+/** 할당을 어느 서브시스템이 했는지, 할당 시점의 스레드별 현재 태그가 붙는다. */
+enum class EMemoryTag : uint8
+{
+    Untagged,
+    Simulation,
+    Renderer,
+    Input,
+    ImGui,
+    Profiler,
+    Max,
+};
+
+const char* GetMemoryTagName(EMemoryTag Tag);
+
+struct FMemoryTagStats
+{
+    uint64 LiveBytes = 0;
+    uint64 SampledPeakBytes = 0;    // BeginFrame, GetStats 시점에만 본 LiveBytes의 최대, 그 사이에 잠깐 늘었다 줄어든 양은 빠짐
+    uint64 NumLiveAllocations = 0;
+    uint64 NumAllocations = 0;      // 시작부터 누적
+    uint64 FrameAllocations = 0;    // 마지막으로 끝난 프레임 동안의 할당 수 (BeginFrame 사이)
+};
+
+/**
+ * 전역 할당 추적
+ *
+ * operator new/delete, 그리고 Allocate/Free로 받은 메모리는 앞에 크기와 태그를 담은 헤더가 붙어서
+ * 해제할 때 할당했던 태그에서 빠진다. 다른 스레드에서 해제해도 된다.
+ * 카운터는 스레드마다 따로 세고 읽을 때 더하므로, 할당 경로에 원자 RMW가 없는 대신 읽는 값은 조금 늦을 수 있다.
+ * 같은 이유로 피크(SampledPeakBytes)는 매 할당이 아니라 읽을 때 갱신되어, 프레임 안에서 잠깐 늘었다 줄어든 양은 잡지 못한다.
+ */
+class FMemoryAllocInfo
+{
+public:
+    /** malloc 대신 쓸 수 있는 할당 (ImGui 등), Tag를 그대로 붙임 */
+    static void* Allocate(size_t Size, size_t Alignment, EMemoryTag Tag);
+
+    /** Allocate나 operator new로 받은 메모리만 넣을 것, nullptr은 무시 */
+    static void Free(void* Ptr);
+
+    /** 호출 스레드의 현재 태그 */
+    static EMemoryTag GetCurrentTag();
+    static void SetCurrentTag(EMemoryTag Tag);
+
+    static FMemoryTagStats GetStats(EMemoryTag Tag);
+    static FMemoryTagStats GetTotalStats();
+
+    /** 프레임 시작에 한 스레드에서만 호출, 직전 프레임의 FrameAllocations를 확정 */
+    static void BeginFrame();
+
+    static constexpr bool IsEnabled() { return WITH_MEMORY_TRACKING != 0; }
+};
+
+/** 생성부터 소멸까지 호출 스레드의 태그를 바꿈 */
+class FMemoryTagScope
+{
+public:
+    explicit FMemoryTagScope(EMemoryTag Tag)
+        : PreviousTag(FMemoryAllocInfo::GetCurrentTag())
+    {
+        FMemoryAllocInfo::SetCurrentTag(Tag);
+    }
+
+    ~FMemoryTagScope()
+    {
+        FMemoryAllocInfo::SetCurrentTag(PreviousTag);
+    }
+
+    FMemoryTagScope(const FMemoryTagScope&) = delete;
+    FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+    EMemoryTag PreviousTag;
+};
+
+#if WITH_MEMORY_TRACKING
+#define MEMORY_TAG_CONCAT_INNER(A, B) A##B
+#define MEMORY_TAG_CONCAT(A, B) MEMORY_TAG_CONCAT_INNER(A, B)
+#define MEMORY_TAG_SCOPE(Tag) FMemoryTagScope MEMORY_TAG_CONCAT(MemoryTagScope_, __LINE__)(EMemoryTag::Tag)
+#else
+#define MEMORY_TAG_SCOPE(Tag) ((void)0)
+#endif
@@ -0,0 +1,173 @@
+﻿#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+
+FProfilerThreadBuffer::FProfilerThreadBuffer(uint32 InThreadIndex)
+    : ThreadIndex(InThreadIndex)
+    , Slots(std::make_unique<FSlot[]>(Capacity))
+{
+}
+
+void FProfilerThreadBuffer::Read(uint64 SinceTicks, std::vector<FProfileEvent>& OutEvents) const
+{
+    const size_t FirstOut = OutEvents.size();
+    ReadFrom(0, OutEvents);
+
+    auto Kept = std::remove_if(OutEvents.begin() + static_cast<std::ptrdiff_t>(FirstOut), OutEvents.end(), [SinceTicks](const FProfileEvent& Event)
+    {
+        return Event.StartTicks < SinceTicks;
+    });
+    OutEvents.erase(Kept, OutEvents.end());
+}
+
+uint64 FProfilerThreadBuffer::ReadFrom(uint64 FirstIndex, std::vector<FProfileEvent>& OutEvents) const
+{
+    const uint64 End = WriteCount.load(std::memory_order_acquire);
+    const uint64 Begin = std::max(FirstIndex, End > Capacity ? End - Capacity : 0);
+    if (Begin >= End)
+    {
+        return End;
+    }
+
+    const size_t FirstOut = OutEvents.size();
+    OutEvents.reserve(FirstOut + static_cast<size_t>(End - Begin));
+    for (uint64 Index = Begin; Index < End; ++Index)
+    {
+        const FSlot& Slot = Slots[Index & (Capacity - 1)];
+
+        FProfileEvent Event;
+        Event.Name = Slot.Name.load(std::memory_order_relaxed);
+        Event.StartTicks = Slot.StartTicks.load(std::memory_order_relaxed);
+        Event.EndTicks = Slot.EndTicks.load(std::memory_order_relaxed);
+        Event.Depth = Slot.Depth.load(std::memory_order_relaxed);
+        Event.ThreadIndex = ThreadIndex;
+        OutEvents.push_back(Event);
+    }
+
+    // 읽는 동안 덮어써졌을 수 있는 앞부분은 버림 (Reserved - 1번까지 예약됐으면 Reserved - Capacity 앞까지 덮어써졌을 수 있음)
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64 Reserved = ReserveCount.load(std::memory_order_relaxed);
+    const uint64 FirstValid = std::max(Begin, Reserved > Capacity ? Reserved - Capacity : 0);
+    const size_t NumInvalid = static_cast<size_t>(std::min(FirstValid - Begin, End - Begin));
+    OutEvents.erase(OutEvents.begin() + static_cast<std::ptrdiff_t>(FirstOut), OutEvents.begin() + static_cast<std::ptrdiff_t>(FirstOut + NumInvalid));
+
+    return End;
+}
+
+FProfiler::FProfiler()
+{
+#if PROFILER_USE_RDTSC
+    // rdtsc 주파수를 steady_clock 기준으로 측정
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point ClockStart = Clock::now();
+    const uint64 TicksStart = ReadTicks();
+    while (Clock::now() - ClockStart < std::chrono::milliseconds(10))
+    {
+    }
+    const std::chrono::duration<double> Elapsed = Clock::now() - ClockStart;
+    const uint64 TicksEnd = ReadTicks();
+    SecondsPerTick = Elapsed.count() / static_cast<double>(TicksEnd - TicksStart);
+#else
+    using Period = std::chrono::steady_clock::period;
+    SecondsPerTick = static_cast<double>(Period::num) / static_cast<double>(Period::den);
+#endif
+
+    BaseTicks = ReadTicks();
+}
+
+FProfilerThreadBuffer& FProfiler::RegisterThread()
+{
+    std::lock_guard Lock(ThreadsMutex);
+    const uint32 ThreadIndex = static_cast<uint32>(ThreadBuffers.size());
+    ThreadBuffers.push_back(std::make_unique<FProfilerThreadBuffer>(ThreadIndex));
+    ThreadNames.push_back("Thread " + std::to_string(ThreadIndex));
+    return *ThreadBuffers.back();
+}
+
+void FProfiler::SetThreadName(const char* Name)
+{
+    const uint32 ThreadIndex = GetThreadBuffer().GetThreadIndex();
+
+    std::lock_guard Lock(ThreadsMutex);
+    ThreadNames[ThreadIndex] = Name;
+}
+
+void FProfiler::CollectEvents(uint64 SinceTicks, std::vector<FProfileEvent>& OutEvents) const
+{
+    std::lock_guard Lock(ThreadsMutex);
+    for (const std::unique_ptr<FProfilerThreadBuffer>& Buffer : ThreadBuffers)
+    {
+        Buffer->Read(SinceTicks, OutEvents);
+    }
+}
+
+void FProfiler::CollectNewEvents(FProfileCursor& Cursor, std::vector<FProfileEvent>& OutEvents) const
+{
+    std::lock_guard Lock(ThreadsMutex);
+    Cursor.NextIndices.resize(ThreadBuffers.size(), 0);
+    for (size_t i = 0; i < ThreadBuffers.size(); ++i)
+    {
+        Cursor.NextIndices[i] = ThreadBuffers[i]->ReadFrom(Cursor.NextIndices[i], OutEvents);
+    }
+}
+
+bool FProfiler::ExportChromeTrace(const std::string& Path) const
+{
+    std::vector<FProfileEvent> Events;
+    CollectEvents(0, Events);
+
+    std::vector<std::string> Names;
+    {
+        std::lock_guard Lock(ThreadsMutex);
+        Names = ThreadNames;
+    }
+
+    std::ofstream File(Path, std::ios::binary);
+    if (!File)
+    {
+        return false;
+    }
+
+    auto WriteEscaped = [&File](const char* String)
+    {
+        for (const char* Char = String; *Char; ++Char)
+        {
+            if (*Char == '"' || *Char == '\\')
+            {
+                File << '\\';
+            }
+            File << *Char;
+        }
+    };
+
+    File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool bFirst = true;
+    for (uint32 ThreadIndex = 0; ThreadIndex < Names.size(); ++ThreadIndex)
+    {
+        File << (bFirst ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ThreadIndex << ",\"args\":{\"name\":\"";
+        WriteEscaped(Names[ThreadIndex].c_str());
+        File << "\"}}";
+        bFirst = false;
+    }
+
+    const double MicrosecondsPerTick = SecondsPerTick * 1.0e6;
+    File.precision(3);
+    File << std::fixed;
+    for (const FProfileEvent& Event : Events)
+    {
+        const double Start = static_cast<double>(static_cast<int64>(Event.StartTicks - BaseTicks)) * MicrosecondsPerTick;
+        const double Duration = static_cast<double>(Event.EndTicks - Event.StartTicks) * MicrosecondsPerTick;
+
+        File << (bFirst ? "" : ",\n") << "{\"name\":\"";
+        WriteEscaped(Event.Name);
+        File << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << Event.ThreadIndex << ",\"ts\":" << Start << ",\"dur\":" << Duration << "}";
+        bFirst = false;
+    }
+
+    File << "\n]}\n";
+    return static_cast<bool>(File);
+}
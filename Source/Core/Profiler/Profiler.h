@@ -0,0 +1,224 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/HAL/PlatformType.h"
+
+/** 0이면 PROFILE_SCOPE가 아무 코드도 만들지 않음 */
+#ifndef WITH_PROFILER
+#define WITH_PROFILER 1
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define PROFILER_USE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_USE_RDTSC 1
+#else
+#include <chrono>
+#define PROFILER_USE_RDTSC 0
+#endif
+
+
+/**
+ * 스코프 하나의 측정 결과
+ */
+struct FProfileEvent
+{
+    const char* Name = nullptr;  // 문자열 리터럴처럼 프로그램이 끝날 때까지 유효해야 함
+    uint64 StartTicks = 0;
+    uint64 EndTicks = 0;
+    uint32 ThreadIndex = 0;
+    uint32 Depth = 0;            // 같은 스레드 안에서의 중첩 깊이, 가장 바깥이 0
+};
+
+/**
+ * 스레드 하나가 기록하는 고정 크기 링 버퍼
+ * 쓰기는 소유 스레드만 하고, 읽기는 아무 스레드에서나 할 수 있다 (시퀀스 락 방식).
+ */
+class FProfilerThreadBuffer
+{
+public:
+    static constexpr uint32 Capacity = 1 << 16;
+
+    explicit FProfilerThreadBuffer(uint32 InThreadIndex);
+
+    /** 소유 스레드 전용 */
+    void Push(const char* Name, uint64 StartTicks, uint64 EndTicks, uint32 Depth)
+    {
+        const uint64 Index = WriteCount.load(std::memory_order_relaxed);
+
+        // 읽는 쪽이 덮어쓰는 중인 슬롯을 걸러낼 수 있도록 먼저 예약 번호를 올림
+        ReserveCount.store(Index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        FSlot& Slot = Slots[Index & (Capacity - 1)];
+        Slot.Name.store(Name, std::memory_order_relaxed);
+        Slot.StartTicks.store(StartTicks, std::memory_order_relaxed);
+        Slot.EndTicks.store(EndTicks, std::memory_order_relaxed);
+        Slot.Depth.store(Depth, std::memory_order_relaxed);
+
+        WriteCount.store(Index + 1, std::memory_order_release);
+    }
+
+    /** StartTicks가 SinceTicks 이상인 이벤트를 OutEvents 뒤에 붙입니다. */
+    void Read(uint64 SinceTicks, std::vector<FProfileEvent>& OutEvents) const;
+
+    /**
+     * FirstIndex번째로 기록된 이벤트부터 지금까지 기록된 이벤트를 OutEvents 뒤에 붙입니다.
+     * 이미 덮어써진 이벤트는 건너뜀
+     * @return 다음에 읽을 FirstIndex
+     */
+    uint64 ReadFrom(uint64 FirstIndex, std::vector<FProfileEvent>& OutEvents) const;
+
+    uint32 GetThreadIndex() const { return ThreadIndex; }
+
+    /** 소유 스레드에서 PROFILE_SCOPE가 중첩된 깊이 */
+    uint32 Depth = 0;
+
+private:
+    struct FSlot
+    {
+        std::atomic<const char*> Name;
+        std::atomic<uint64> StartTicks;
+        std::atomic<uint64> EndTicks;
+        std::atomic<uint32> Depth;
+    };
+
+    uint32 ThreadIndex;
+    std::unique_ptr<FSlot[]> Slots;
+    std::atomic<uint64> WriteCount = 0;
+    std::atomic<uint64> ReserveCount = 0;
+};
+
+/**
+ * 스레드별로 어디까지 읽었는지 기억해서, 같은 이벤트를 두 번 받지 않도록 함
+ */
+struct FProfileCursor
+{
+    std::vector<uint64> NextIndices;
+};
+
+/**
+ * CPU 프로파일러
+ * PROFILE_SCOPE로 측정한 구간을 스레드별 링 버퍼에 쌓아두고, 필요할 때 모아서 보거나 Chrome Trace로 내보낸다.
+ * @note 워커 스레드가 생기기 전에 메인 스레드에서 Get()을 한 번 호출해 둘 것
+ */
+class FProfiler : public TSingleton<FProfiler>
+{
+    friend class TSingleton<FProfiler>;
+
+public:
+    /** 현재 시각 (틱), rdtsc를 쓸 수 있으면 rdtsc */
+    static uint64 ReadTicks()
+    {
+#if PROFILER_USE_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /** 호출 스레드의 링 버퍼, 처음 호출될 때 등록됨 */
+    static FProfilerThreadBuffer& GetThreadBuffer()
+    {
+        thread_local FProfilerThreadBuffer* Buffer = nullptr;
+        if (Buffer == nullptr)
+        {
+            Buffer = &Get().RegisterThread();
+        }
+        return *Buffer;
+    }
+
+    /** 스코프마다 읽히므로 Get()을 거치지 않도록 static으로 둠 */
+    static void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+    static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+
+    /** 호출 스레드의 이름을 지정합니다. Trace에 표시됨 */
+    void SetThreadName(const char* Name);
+
+    /** 모든 스레드에서 StartTicks가 SinceTicks 이상인 이벤트를 모읍니다. 순서는 정해져 있지 않음 */
+    void CollectEvents(uint64 SinceTicks, std::vector<FProfileEvent>& OutEvents) const;
+
+    /** Cursor 이후에 새로 기록된 이벤트를 모으고 Cursor를 옮깁니다. */
+    void CollectNewEvents(FProfileCursor& Cursor, std::vector<FProfileEvent>& OutEvents) const;
+
+    /**
+     * 링 버퍼에 남아있는 모든 이벤트를 Chrome Trace Event 형식으로 저장합니다.
+     * chrome://tracing 이나 https://ui.perfetto.dev 에서 열 수 있음
+     */
+    bool ExportChromeTrace(const std::string& Path) const;
+
+    double TicksToSeconds(uint64 Ticks) const { return static_cast<double>(Ticks) * SecondsPerTick; }
+    double GetSecondsPerTick() const { return SecondsPerTick; }
+    uint64 GetBaseTicks() const { return BaseTicks; }
+
+private:
+    FProfiler();
+
+    FProfilerThreadBuffer& RegisterThread();
+
+private:
+    static inline std::atomic<bool> bEnabled = true;
+
+    uint64 BaseTicks = 0;
+    double SecondsPerTick = 0.0;
+
+    mutable std::mutex ThreadsMutex;
+    std::vector<std::unique_ptr<FProfilerThreadBuffer>> ThreadBuffers;
+    std::vector<std::string> ThreadNames;
+};
+
+/**
+ * 생성부터 소멸까지를 하나의 이벤트로 기록
+ */
+class FProfileScope
+{
+public:
+    explicit FProfileScope(const char* InName)
+        : Name(InName)
+    {
+        if (FProfiler::IsEnabled())
+        {
+            Buffer = &FProfiler::GetThreadBuffer();
+            Depth = Buffer->Depth++;
+            StartTicks = FProfiler::ReadTicks();
+        }
+    }
+
+    ~FProfileScope()
+    {
+        if (Buffer)
+        {
+            const uint64 EndTicks = FProfiler::ReadTicks();
+            Buffer->Depth = Depth;
+            Buffer->Push(Name, StartTicks, EndTicks, Depth);
+        }
+    }
+
+    FProfileScope(const FProfileScope&) = delete;
+    FProfileScope& operator=(const FProfileScope&) = delete;
+
+private:
+    const char* Name;
+    FProfilerThreadBuffer* Buffer = nullptr;
+    uint64 StartTicks = 0;
+    uint32 Depth = 0;
+};
+
+#if WITH_PROFILER
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+#define PROFILE_SCOPE(Name) FProfileScope PROFILE_CONCAT(ProfileScope_, __LINE__)(Name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_THREAD_NAME(Name) FProfiler::Get().SetThreadName(Name)
+#else
+#define PROFILE_SCOPE(Name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_THREAD_NAME(Name) ((void)0)
+#endif
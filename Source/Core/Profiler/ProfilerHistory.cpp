@@ -0,0 +1,274 @@
+﻿#include "ProfilerHistory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <span>
+
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/MemoryAllocInfo.h"
+
+
+namespace
+{
+    /** 프레임 스코프가 오랫동안 안 들어올 때 무한히 쌓이지 않도록 하는 상한 */
+    constexpr size_t MaxPendingEvents = 1 << 18;
+
+    void AddScopeTime(std::vector<FProfileScopeTime>& ScopeTimes, const char* Name, double Milliseconds)
+    {
+        for (FProfileScopeTime& ScopeTime : ScopeTimes)
+        {
+            if (ScopeTime.Name == Name || std::strcmp(ScopeTime.Name, Name) == 0)
+            {
+                ScopeTime.Milliseconds += Milliseconds;
+                ++ScopeTime.NumCalls;
+                return;
+            }
+        }
+        ScopeTimes.push_back({ Name, Milliseconds, 1 });
+    }
+}
+
+FProfilerHistory::FProfilerHistory(double InSecondsPerTick, uint32 InMaxFrames, const char* InFrameScopeName)
+    : SecondsPerTick(InSecondsPerTick)
+    , MaxFrames(std::max(InMaxFrames, 1u))
+    , FrameScopeName(InFrameScopeName)
+{
+}
+
+void FProfilerHistory::Update(const FProfiler& Profiler)
+{
+    MEMORY_TAG_SCOPE(Profiler);
+
+    NewEvents.clear();
+    Profiler.CollectNewEvents(Cursor, NewEvents);
+    AddEvents(NewEvents);
+}
+
+void FProfilerHistory::AddEvents(const std::vector<FProfileEvent>& Events)
+{
+    if (bFrozen)
+    {
+        return;
+    }
+
+    for (const FProfileEvent& Event : Events)
+    {
+        if (IsFrameEvent(Event))
+        {
+            PendingFrames.push_back(Event);
+        }
+        else
+        {
+            PendingEvents.push_back(Event);
+        }
+    }
+
+    std::sort(PendingFrames.begin(), PendingFrames.end(), [](const FProfileEvent& A, const FProfileEvent& B)
+    {
+        return A.StartTicks < B.StartTicks;
+    });
+
+    // 다음 프레임이 시작됐으면 이전 프레임에 속할 이벤트는 모두 기록이 끝났다고 봄
+    bool bFinalized = false;
+    while (PendingFrames.size() >= 2)
+    {
+        FinalizeFrame(PendingFrames.front());
+        PendingFrames.erase(PendingFrames.begin());
+        bFinalized = true;
+    }
+
+    if (PendingFrames.empty() && PendingEvents.size() > MaxPendingEvents)
+    {
+        PendingEvents.clear();
+    }
+
+    if (bFinalized)
+    {
+        UpdateScopeStats();
+    }
+}
+
+void FProfilerHistory::SetFrozen(bool bInFrozen)
+{
+    if (bFrozen == bInFrozen)
+    {
+        return;
+    }
+
+    bFrozen = bInFrozen;
+
+    // 멈춘 동안 놓친 이벤트로 반쪽짜리 프레임이 생기지 않도록 대기 중인 것도 버림
+    PendingEvents.clear();
+    PendingFrames.clear();
+}
+
+void FProfilerHistory::SetMaxFrames(uint32 InMaxFrames)
+{
+    MaxFrames = std::max(InMaxFrames, 1u);
+    LinearizeFrames();
+    if (Frames.size() > MaxFrames)
+    {
+        Frames.erase(Frames.begin(), Frames.end() - MaxFrames);
+    }
+    UpdateScopeStats();
+}
+
+void FProfilerHistory::Clear()
+{
+    PendingEvents.clear();
+    PendingFrames.clear();
+    Frames.clear();
+    OldestFrame = 0;
+    ScopeStats.clear();
+}
+
+void FProfilerHistory::LinearizeFrames()
+{
+    std::rotate(Frames.begin(), Frames.begin() + OldestFrame, Frames.end());
+    OldestFrame = 0;
+}
+
+bool FProfilerHistory::IsFrameEvent(const FProfileEvent& Event) const
+{
+    return Event.Depth == 0 && Event.Name && FrameScopeName == Event.Name;
+}
+
+void FProfilerHistory::FinalizeFrame(const FProfileEvent& FrameEvent)
+{
+    // 히스토리가 찼으면 가장 오래된 프레임 자리를 배열 용량째로 재사용
+    if (Frames.size() < MaxFrames)
+    {
+        LinearizeFrames();
+        Frames.emplace_back();
+    }
+    else
+    {
+        OldestFrame = (OldestFrame + 1) % static_cast<uint32>(Frames.size());
+    }
+    FProfileFrame& Frame = Frames[(OldestFrame + Frames.size() - 1) % Frames.size()];
+    Frame.Events.clear();
+    Frame.Breakdown.clear();
+    Frame.Totals.clear();
+
+    Frame.StartTicks = FrameEvent.StartTicks;
+    Frame.EndTicks = FrameEvent.EndTicks;
+    Frame.Milliseconds = TicksToMilliseconds(FrameEvent.EndTicks - FrameEvent.StartTicks);
+    Frame.ThreadIndex = FrameEvent.ThreadIndex;
+    Frame.Events.push_back(FrameEvent);
+
+    // 프레임 안에서 시작한 이벤트는 프레임으로 옮기고, 프레임보다 앞선 이벤트는 버림
+    auto Remaining = std::remove_if(PendingEvents.begin(), PendingEvents.end(), [&Frame](const FProfileEvent& Event)
+    {
+        if (Event.StartTicks >= Frame.EndTicks)
+        {
+            return false;
+        }
+        if (Event.StartTicks >= Frame.StartTicks)
+        {
+            Frame.Events.push_back(Event);
+        }
+        return true;
+    });
+    PendingEvents.erase(Remaining, PendingEvents.end());
+
+    std::sort(Frame.Events.begin(), Frame.Events.end(), [](const FProfileEvent& A, const FProfileEvent& B)
+    {
+        if (A.ThreadIndex != B.ThreadIndex)
+        {
+            return A.ThreadIndex < B.ThreadIndex;
+        }
+        if (A.StartTicks != B.StartTicks)
+        {
+            return A.StartTicks < B.StartTicks;
+        }
+        return A.Depth < B.Depth;
+    });
+
+    for (const FProfileEvent& Event : Frame.Events)
+    {
+        const double Milliseconds = TicksToMilliseconds(Event.EndTicks - Event.StartTicks);
+        AddScopeTime(Frame.Totals, Event.Name, Milliseconds);
+
+        if (Event.ThreadIndex == FrameEvent.ThreadIndex && Event.Depth == FrameEvent.Depth + 1)
+        {
+            AddScopeTime(Frame.Breakdown, Event.Name, Milliseconds);
+        }
+    }
+}
+
+void FProfilerHistory::UpdateScopeStats()
+{
+    // 임시 배열은 모두 프레임 아레나에서 받고 함수가 끝나면 되돌림
+    FFrameArenaMark Mark;
+
+    // 스코프 이름 목록, 주소가 달라도 내용이 같으면 같은 스코프
+    TFrameArray<const char*> Names;
+    const auto FindName = [&Names](const char* Name)
+    {
+        for (size_t i = 0; i < Names.Num(); ++i)
+        {
+            if (Names[i] == Name || std::strcmp(Names[i], Name) == 0)
+            {
+                return static_cast<int32>(i);
+            }
+        }
+        return -1;
+    };
+    for (uint32 FrameIndex = 0; FrameIndex < NumFrames(); ++FrameIndex)
+    {
+        for (const FProfileScopeTime& ScopeTime : GetFrame(FrameIndex).Totals)
+        {
+            if (FindName(ScopeTime.Name) == -1)
+            {
+                Names.Add(ScopeTime.Name);
+            }
+        }
+    }
+
+    // 이름마다 프레임별 시간을 한 줄씩, 없던 프레임은 0
+    const size_t NumSamples = Frames.size();
+    TFrameArray<double> Samples;
+    Samples.Init(0.0, Names.Num() * NumSamples);
+    for (uint32 FrameIndex = 0; FrameIndex < NumFrames(); ++FrameIndex)
+    {
+        for (const FProfileScopeTime& ScopeTime : GetFrame(FrameIndex).Totals)
+        {
+            Samples[FindName(ScopeTime.Name) * NumSamples + FrameIndex] = ScopeTime.Milliseconds;
+        }
+    }
+
+    ScopeStats.clear();
+    ScopeStats.reserve(Names.Num());
+    for (size_t NameIndex = 0; NameIndex < Names.Num(); ++NameIndex)
+    {
+        const std::span<double> Values(Samples.GetData() + NameIndex * NumSamples, NumSamples);
+
+        FProfileScopeStats Stats;
+        Stats.Name = Names[NameIndex];
+        Stats.Last = Values.back();
+
+        double Sum = 0.0;
+        for (const double Value : Values)
+        {
+            Sum += Value;
+        }
+        Stats.Average = Sum / static_cast<double>(Values.size());
+
+        const auto [MinIt, MaxIt] = std::minmax_element(Values.begin(), Values.end());
+        Stats.Min = *MinIt;
+        Stats.Max = *MaxIt;
+
+        // 값의 99%가 이 값 이하 (nearest-rank)
+        const size_t Rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(Values.size())));
+        std::nth_element(Values.begin(), Values.begin() + (Rank - 1), Values.end());
+        Stats.P99 = Values[Rank - 1];
+
+        ScopeStats.push_back(Stats);
+    }
+
+    std::sort(ScopeStats.begin(), ScopeStats.end(), [](const FProfileScopeStats& A, const FProfileScopeStats& B)
+    {
+        return A.Average > B.Average;
+    });
+}
@@ -0,0 +1,113 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+
+#include "Profiler.h"
+
+
+/**
+ * 한 프레임 동안 같은 이름의 스코프들이 쓴 시간의 합
+ */
+struct FProfileScopeTime
+{
+    const char* Name = nullptr;
+    double Milliseconds = 0.0;
+    uint32 NumCalls = 0;
+};
+
+/**
+ * 프레임 하나에 속한 이벤트와 요약
+ */
+struct FProfileFrame
+{
+    uint64 StartTicks = 0;
+    uint64 EndTicks = 0;
+    double Milliseconds = 0.0;
+
+    /** 프레임 스코프가 기록된 스레드 */
+    uint32 ThreadIndex = 0;
+
+    /** 프레임 구간에 시작한 모든 스레드의 이벤트, (스레드, 시작 시각) 순으로 정렬 */
+    std::vector<FProfileEvent> Events;
+
+    /** 프레임 스코프 바로 아래 스코프들 (처음 나온 순서) */
+    std::vector<FProfileScopeTime> Breakdown;
+
+    /** 모든 스레드에서 이름별로 합친 시간 */
+    std::vector<FProfileScopeTime> Totals;
+};
+
+/**
+ * 여러 프레임에 걸친 스코프 이름별 통계 (ms)
+ * 스코프가 없었던 프레임은 0으로 계산
+ */
+struct FProfileScopeStats
+{
+    const char* Name = nullptr;
+    double Min = 0.0;
+    double Average = 0.0;
+    double P99 = 0.0;
+    double Max = 0.0;
+    double Last = 0.0;
+};
+
+/**
+ * 프로파일러 이벤트를 프레임 단위로 묶어 최근 N 프레임을 보관하고 통계를 낸다.
+ * UI와 무관하게 동작하므로 이벤트 배열만 넣어서 따로 돌려볼 수 있다.
+ *
+ * 프레임 경계는 FrameScopeName 이름을 가진 가장 바깥(Depth 0) 스코프로 정한다.
+ * 다른 스레드의 이벤트가 늦게 들어올 수 있어서, 다음 프레임 스코프가 들어온 뒤에 프레임을 확정한다.
+ * 프레임은 링 버퍼에 담고 가장 오래된 프레임의 배열을 재사용하므로, 히스토리가 찬 뒤에는 매 프레임 힙 할당을 하지 않는다.
+ */
+class FProfilerHistory
+{
+public:
+    FProfilerHistory(double InSecondsPerTick, uint32 InMaxFrames = 240, const char* InFrameScopeName = "Frame");
+
+    /** Profiler에 새로 기록된 이벤트를 가져와서 AddEvents 합니다. */
+    void Update(const FProfiler& Profiler);
+
+    /** 이벤트를 추가합니다. 순서는 상관 없고, 같은 이벤트를 두 번 넣으면 안 됨 */
+    void AddEvents(const std::vector<FProfileEvent>& Events);
+
+    /** 멈춘 동안에는 새 프레임을 버리고 히스토리와 통계를 그대로 유지 */
+    void SetFrozen(bool bInFrozen);
+    bool IsFrozen() const { return bFrozen; }
+
+    void SetMaxFrames(uint32 InMaxFrames);
+    uint32 GetMaxFrames() const { return MaxFrames; }
+
+    /** 0이 가장 오래된 프레임 */
+    uint32 NumFrames() const { return static_cast<uint32>(Frames.size()); }
+    const FProfileFrame& GetFrame(uint32 Index) const { return Frames[(OldestFrame + Index) % Frames.size()]; }
+
+    /** 평균 시간이 큰 순서 */
+    const std::vector<FProfileScopeStats>& GetScopeStats() const { return ScopeStats; }
+
+    double TicksToMilliseconds(uint64 Ticks) const { return static_cast<double>(Ticks) * SecondsPerTick * 1000.0; }
+
+    void Clear();
+
+private:
+    bool IsFrameEvent(const FProfileEvent& Event) const;
+    void FinalizeFrame(const FProfileEvent& FrameEvent);
+    void UpdateScopeStats();
+
+    /** 가장 오래된 프레임이 0번에 오도록 링 버퍼를 펼침 */
+    void LinearizeFrames();
+
+private:
+    double SecondsPerTick;
+    uint32 MaxFrames;
+    std::string FrameScopeName;
+    bool bFrozen = false;
+
+    FProfileCursor Cursor;
+    std::vector<FProfileEvent> NewEvents;       // Update에서 재사용
+    std::vector<FProfileEvent> PendingEvents;
+    std::vector<FProfileEvent> PendingFrames;
+
+    std::vector<FProfileFrame> Frames;          // 최대 MaxFrames개의 링 버퍼
+    uint32 OldestFrame = 0;
+    std::vector<FProfileScopeStats> ScopeStats;
+};
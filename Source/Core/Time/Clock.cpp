@@ -0,0 +1,113 @@
+﻿#include "Clock.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm")
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <chrono>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#endif
+
+
+#ifdef _WIN32
+
+FPlatformClock::FPlatformClock()
+{
+    LARGE_INTEGER Frequency;
+    QueryPerformanceFrequency(&Frequency);
+    SecondsPerCount = 1.0 / static_cast<double>(Frequency.QuadPart);
+
+    LARGE_INTEGER Counter;
+    QueryPerformanceCounter(&Counter);
+    Origin = Counter.QuadPart;
+
+    // Windows 10 1803 이상은 1ms 미만으로도 잘 수 있는 고해상도 타이머를 지원
+    SleepTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!SleepTimer)
+    {
+        // 기본 타이머 해상도(15.6ms)로는 Sleep(1)도 한 틱을 통째로 잘 수 있음
+        timeBeginPeriod(1);
+    }
+}
+
+FPlatformClock::~FPlatformClock()
+{
+    if (SleepTimer)
+    {
+        CloseHandle(SleepTimer);
+    }
+    else
+    {
+        timeEndPeriod(1);
+    }
+}
+
+double FPlatformClock::GetSeconds() const
+{
+    LARGE_INTEGER Counter;
+    QueryPerformanceCounter(&Counter);
+    return static_cast<double>(Counter.QuadPart - Origin) * SecondsPerCount;
+}
+
+void FPlatformClock::SleepFor(double Seconds)
+{
+    if (SleepTimer)
+    {
+        // 100ns 단위, 음수는 상대 시간
+        LARGE_INTEGER DueTime;
+        DueTime.QuadPart = -static_cast<LONGLONG>(Seconds * 1.0e7);
+        if (SetWaitableTimerEx(SleepTimer, &DueTime, 0, nullptr, nullptr, nullptr, 0))
+        {
+            WaitForSingleObject(SleepTimer, INFINITE);
+            return;
+        }
+    }
+
+    ::Sleep(static_cast<DWORD>(Seconds * 1000.0));
+}
+
+void FPlatformClock::Pause()
+{
+    YieldProcessor();
+}
+
+#else
+
+FPlatformClock::FPlatformClock()
+{
+    using Clock = std::chrono::steady_clock;
+    SecondsPerCount = static_cast<double>(Clock::period::num) / static_cast<double>(Clock::period::den);
+    Origin = Clock::now().time_since_epoch().count();
+}
+
+FPlatformClock::~FPlatformClock() = default;
+
+double FPlatformClock::GetSeconds() const
+{
+    const int64 Counter = std::chrono::steady_clock::now().time_since_epoch().count();
+    return static_cast<double>(Counter - Origin) * SecondsPerCount;
+}
+
+void FPlatformClock::SleepFor(double Seconds)
+{
+    std::this_thread::sleep_for(std::chrono::duration<double>(Seconds));
+}
+
+void FPlatformClock::Pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+#endif
@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 시간 공급원
+ * 실제 시계 대신 FFakeClock을 넣어서 시간 관련 로직을 결정적으로 돌릴 수 있다.
+ */
+class IClock
+{
+public:
+    virtual ~IClock() = default;
+
+    /** 임의의 기준 시점부터 흐른 시간 (초), 단조 증가 */
+    virtual double GetSeconds() const = 0;
+
+    /** 호출 스레드를 최소 Seconds 동안 재웁니다. OS 스케줄러 때문에 더 오래 잘 수 있음 */
+    virtual void SleepFor(double Seconds) = 0;
+
+    /** 바쁜 대기 루프 한 바퀴에 호출, 하이퍼스레드 형제에게 실행 자원을 양보 */
+    virtual void Pause() = 0;
+};
+
+/**
+ * 플랫폼 고해상도 시계 (Windows는 QueryPerformanceCounter, 그 외에는 steady_clock)
+ * Windows에서는 가능하면 고해상도 대기 타이머로 자고, 없으면 타이머 해상도를 1ms로 올린 Sleep을 쓴다.
+ */
+class FPlatformClock : public IClock
+{
+public:
+    FPlatformClock();
+    ~FPlatformClock() override;
+
+    FPlatformClock(const FPlatformClock&) = delete;
+    FPlatformClock& operator=(const FPlatformClock&) = delete;
+
+    double GetSeconds() const override;
+    void SleepFor(double Seconds) override;
+    void Pause() override;
+
+private:
+    int64 Origin = 0;
+    double SecondsPerCount = 0.0;
+    void* SleepTimer = nullptr;  // Windows 대기 타이머 HANDLE
+};
+
+/**
+ * 직접 시간을 설정하는 시계, 테스트나 재현용
+ * SleepFor와 Pause는 실제로 기다리지 않고 시간만 앞으로 보낸다.
+ */
+class FFakeClock : public IClock
+{
+public:
+    double GetSeconds() const override { return Seconds; }
+    void SleepFor(double InSeconds) override { Seconds += InSeconds + OversleepTime; TotalSleepTime += InSeconds + OversleepTime; }
+    void Pause() override { Seconds += PauseTime; TotalPauseTime += PauseTime; }
+
+    void SetSeconds(double InSeconds) { Seconds = InSeconds; }
+    void Advance(double DeltaSeconds) { Seconds += DeltaSeconds; }
+
+    /** SleepFor마다 추가로 더 자는 시간, OS 스케줄러 지연 흉내 */
+    void SetOversleepTime(double InSeconds) { OversleepTime = InSeconds; }
+
+    /** Pause 한 번에 흐르는 시간 */
+    void SetPauseTime(double InSeconds) { PauseTime = InSeconds; }
+
+    double GetTotalSleepTime() const { return TotalSleepTime; }
+    double GetTotalPauseTime() const { return TotalPauseTime; }
+
+private:
+    double Seconds = 0.0;
+    double OversleepTime = 0.0;
+    double PauseTime = 1.0e-6;
+    double TotalSleepTime = 0.0;
+    double TotalPauseTime = 0.0;
+};
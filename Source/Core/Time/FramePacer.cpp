@@ -0,0 +1,119 @@
+﻿#include "FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Clock.h"
+
+
+namespace
+{
+    /** 한 번에 요청하는 최대 수면 시간 (초), 짧게 나눠 자야 늦게 깨어나는 오차가 작음 */
+    constexpr double SleepChunk = 0.001;
+
+    /** 이보다 짧게 잘 거면 바로 바쁜 대기로 넘어감 (초) */
+    constexpr double MinSleepTime = 0.0001;
+
+    /** 수면 오차 추정은 최근 샘플 위주로 따라가도록 이 개수마다 다시 시작 */
+    constexpr uint32 MaxSleepSamples = 256;
+}
+
+FFramePacer::FFramePacer(IClock& InClock, double InTargetFrameTime)
+    : Clock(InClock)
+    , TargetFrameTime(InTargetFrameTime)
+    , SleepEstimate(SleepChunk)
+{
+    Stats.SleepEstimate = SleepEstimate;
+    Reset();
+}
+
+void FFramePacer::Reset()
+{
+    FrameStartTime = Clock.GetSeconds();
+}
+
+double FFramePacer::WaitForNextFrame()
+{
+    const double Deadline = FrameStartTime + TargetFrameTime;
+    SleepUntil(Deadline);
+
+    const double Now = Clock.GetSeconds();
+    const double FrameTime = Now - FrameStartTime;
+    AddFrameSample(FrameTime);
+
+    // 조금 늦은 정도면 목표 시각을 기준으로 이어가서 오차가 쌓이지 않게 하고,
+    // 한 프레임 넘게 밀렸으면 따라잡지 않고 지금부터 다시 시작
+    FrameStartTime = Now - Deadline < TargetFrameTime ? Deadline : Now;
+    return FrameTime;
+}
+
+void FFramePacer::ResetStats()
+{
+    Stats = FFramePacerStats();
+    Stats.SleepEstimate = SleepEstimate;
+    FrameM2 = 0.0;
+}
+
+void FFramePacer::SleepUntil(double Deadline)
+{
+    // 요청보다 늦게 깨어나는 만큼(SleepEstimate)은 남겨두고 잠
+    const double SleepStart = Clock.GetSeconds();
+    double Now = SleepStart;
+    while (true)
+    {
+        const double SleepTime = std::min(SleepChunk, Deadline - Now - SleepEstimate);
+        if (SleepTime < MinSleepTime)
+        {
+            break;
+        }
+
+        Clock.SleepFor(SleepTime);
+
+        const double AfterSleep = Clock.GetSeconds();
+        AddSleepSample(AfterSleep - Now - SleepTime);
+        Now = AfterSleep;
+    }
+
+    Stats.LastSleepTime = Now - SleepStart;
+
+    // 나머지는 바쁜 대기
+    const double SpinStart = Now;
+    while (Now < Deadline)
+    {
+        Clock.Pause();
+        Now = Clock.GetSeconds();
+    }
+    Stats.LastSpinTime = Now - SpinStart;
+}
+
+void FFramePacer::AddSleepSample(double Oversleep)
+{
+    if (NumSleepSamples >= MaxSleepSamples)
+    {
+        // 평균은 남겨두고 분산만 다시 모음
+        NumSleepSamples = 1;
+        SleepM2 = 0.0;
+    }
+
+    ++NumSleepSamples;
+    const double Delta = Oversleep - SleepMean;
+    SleepMean += Delta / NumSleepSamples;
+    SleepM2 += Delta * (Oversleep - SleepMean);
+
+    const double StdDev = NumSleepSamples > 1 ? std::sqrt(SleepM2 / (NumSleepSamples - 1)) : 0.0;
+    SleepEstimate = std::max(SleepMean + StdDev * 2.0, 0.0);
+    Stats.SleepEstimate = SleepEstimate;
+}
+
+void FFramePacer::AddFrameSample(double FrameTime)
+{
+    ++Stats.NumFrames;
+    Stats.LastFrameTime = FrameTime;
+
+    const double Delta = FrameTime - Stats.MeanFrameTime;
+    Stats.MeanFrameTime += Delta / static_cast<double>(Stats.NumFrames);
+    FrameM2 += Delta * (FrameTime - Stats.MeanFrameTime);
+    Stats.FrameTimeJitter = Stats.NumFrames > 1 ? std::sqrt(FrameM2 / static_cast<double>(Stats.NumFrames - 1)) : 0.0;
+
+    Stats.MaxFrameTimeError = std::max(Stats.MaxFrameTimeError, std::abs(FrameTime - TargetFrameTime));
+}
@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "Core/HAL/PlatformType.h"
+
+class IClock;
+
+
+struct FFramePacerStats
+{
+    uint64 NumFrames = 0;
+
+    /** 실제 프레임 길이 (초) */
+    double LastFrameTime = 0.0;
+    double MeanFrameTime = 0.0;
+
+    /** 프레임 길이의 표준편차 (초) */
+    double FrameTimeJitter = 0.0;
+
+    /** 목표 프레임 길이와의 최대 오차 (초) */
+    double MaxFrameTimeError = 0.0;
+
+    /** 마지막 프레임에서 재운 시간과 바쁜 대기로 보낸 시간 (초) */
+    double LastSleepTime = 0.0;
+    double LastSpinTime = 0.0;
+
+    /** 요청한 시간보다 늦게 깨어나는 정도의 추정값 (초), 남은 시간이 이 근처면 바쁜 대기로 전환 */
+    double SleepEstimate = 0.0;
+};
+
+/**
+ * 프레임 속도 제한기
+ *
+ * 남은 시간이 충분하면 짧게 여러 번 자고, 마지막 구간만 바쁜 대기로 맞춘다.
+ * 잘 때마다 요청보다 얼마나 늦게 깨어나는지를 측정해서(평균 + 표준편차 2배)
+ * 바쁜 대기 구간을 OS 스케줄러 오차만큼만 남긴다.
+ */
+class FFramePacer
+{
+public:
+    FFramePacer(IClock& InClock, double InTargetFrameTime);
+
+    void SetTargetFrameTime(double InTargetFrameTime) { TargetFrameTime = InTargetFrameTime; }
+    double GetTargetFrameTime() const { return TargetFrameTime; }
+
+    /** 현재 시각을 프레임 시작으로 잡습니다. */
+    void Reset();
+
+    /**
+     * 이번 프레임이 목표 길이가 될 때까지 기다리고 다음 프레임을 시작합니다.
+     * @return 이번 프레임의 실제 길이 (초)
+     */
+    double WaitForNextFrame();
+
+    const FFramePacerStats& GetStats() const { return Stats; }
+    void ResetStats();
+
+private:
+    void SleepUntil(double Deadline);
+    void AddSleepSample(double Seconds);
+    void AddFrameSample(double FrameTime);
+
+private:
+    IClock& Clock;
+    double TargetFrameTime;
+    double FrameStartTime = 0.0;
+
+    // 요청보다 늦게 깨어난 시간 (Welford 누적)
+    uint32 NumSleepSamples = 0;
+    double SleepMean = 0.0;
+    double SleepM2 = 0.0;
+    double SleepEstimate;
+
+    // 프레임 길이 (Welford 누적)
+    double FrameM2 = 0.0;
+
+    FFramePacerStats Stats;
+};
@@ -0,0 +1,130 @@
+﻿#include "TimeManager.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Clock.h"
+
+
+FTimeManager::FTimeManager(const IClock* InClock)
+    : Clock(InClock)
+    , CurrentTimeStep(Settings.FixedTimeStep)
+{
+    Stats.CurrentTimeStep = CurrentTimeStep;
+}
+
+void FTimeManager::SetSettings(const FTimeStepSettings& InSettings)
+{
+    Settings = InSettings;
+    Settings.FixedTimeStep = std::max(Settings.FixedTimeStep, 1.0e-4f);
+    Settings.MaxSubSteps = std::max(Settings.MaxSubSteps, 1u);
+    Settings.MaxAccumulatedTime = std::max(Settings.MaxAccumulatedTime, Settings.FixedTimeStep);
+    Settings.MaxTimeStep = std::max(Settings.MaxTimeStep, Settings.FixedTimeStep);
+
+    // 적응형이 아니면 바로 반영, 적응형이면 다음 Advance에서 다시 계산
+    if (!Settings.bAdaptiveTimeStep)
+    {
+        CurrentTimeStep = Settings.FixedTimeStep;
+    }
+}
+
+float FTimeManager::Tick()
+{
+    float DeltaTime = 0.0f;
+    if (Clock)
+    {
+        const double Now = Clock->GetSeconds();
+        if (bHasLastClockTime)
+        {
+            DeltaTime = static_cast<float>(Now - LastClockTime);
+        }
+        LastClockTime = Now;
+        bHasLastClockTime = true;
+    }
+
+    Advance(DeltaTime);
+    return DeltaTime;
+}
+
+void FTimeManager::Advance(float DeltaTime)
+{
+    ++Stats.NumFrames;
+    Stats.FrameSteps = 0;
+    Stats.FrameDroppedTime = 0.0f;
+    bThrottledThisFrame = false;
+
+    Accumulator += std::max(DeltaTime, 0.0f);
+    if (Accumulator > Settings.MaxAccumulatedTime)
+    {
+        DropTime(Accumulator - Settings.MaxAccumulatedTime);
+        Accumulator = Settings.MaxAccumulatedTime;
+    }
+
+    CurrentTimeStep = Settings.FixedTimeStep;
+    if (Settings.bAdaptiveTimeStep)
+    {
+        // 스텝 예산 안에 쌓인 시간을 다 소화할 수 있는 크기까지만 늘림
+        const float RequiredTimeStep = Accumulator / static_cast<float>(Settings.MaxSubSteps);
+        CurrentTimeStep = std::clamp(RequiredTimeStep, Settings.FixedTimeStep, Settings.MaxTimeStep);
+    }
+    Stats.CurrentTimeStep = CurrentTimeStep;
+}
+
+bool FTimeManager::ConsumeStep(float& OutTimeStep)
+{
+    // 적응형 스텝은 누적 시간을 나눠서 만들기 때문에 float 오차로 마지막 스텝이 빠지지 않도록 여유를 둠
+    constexpr float StepTolerance = 1.0e-4f;
+    if (Accumulator < CurrentTimeStep * (1.0f - StepTolerance))
+    {
+        return false;
+    }
+
+    if (Stats.FrameSteps >= Settings.MaxSubSteps)
+    {
+        // 예산을 다 썼으면 한 스텝 미만의 나머지만 남기고 버림
+        const float Remainder = std::fmod(Accumulator, CurrentTimeStep);
+        DropTime(Accumulator - Remainder);
+        Accumulator = Remainder;
+        return false;
+    }
+
+    Accumulator = std::max(Accumulator - CurrentTimeStep, 0.0f);
+    ++Stats.FrameSteps;
+    ++Stats.NumSteps;
+
+    OutTimeStep = CurrentTimeStep;
+    return true;
+}
+
+float FTimeManager::GetAlpha() const
+{
+    return std::clamp(Accumulator / CurrentTimeStep, 0.0f, 1.0f);
+}
+
+void FTimeManager::ResetStats()
+{
+    Stats = FTimeStats();
+    Stats.CurrentTimeStep = CurrentTimeStep;
+}
+
+void FTimeManager::Reset()
+{
+    Accumulator = 0.0f;
+    bHasLastClockTime = false;
+}
+
+void FTimeManager::DropTime(float Seconds)
+{
+    if (Seconds <= 0.0f)
+    {
+        return;
+    }
+
+    if (!bThrottledThisFrame)
+    {
+        bThrottledThisFrame = true;
+        ++Stats.NumThrottledFrames;
+    }
+    Stats.DroppedTime += Seconds;
+    Stats.FrameDroppedTime += Seconds;
+}
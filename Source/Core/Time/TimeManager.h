@@ -0,0 +1,102 @@
+﻿#pragma once
+
+#include "Core/HAL/PlatformType.h"
+
+class IClock;
+
+
+struct FTimeStepSettings
+{
+    float FixedTimeStep = 1.0f / 60.0f;
+
+    /** 한 프레임에 돌릴 수 있는 최대 스텝 수, 넘치는 시간은 버림 */
+    uint32 MaxSubSteps = 8;
+
+    /** 누적 시간 상한 (초), 긴 멈춤 뒤에 한꺼번에 따라잡지 않도록 함 */
+    float MaxAccumulatedTime = 0.25f;
+
+    /** 부하가 걸리면 스텝 수 대신 스텝 크기를 MaxTimeStep까지 늘림 */
+    bool bAdaptiveTimeStep = false;
+    float MaxTimeStep = 1.0f / 15.0f;
+};
+
+struct FTimeStats
+{
+    uint64 NumFrames = 0;
+    uint64 NumSteps = 0;
+
+    /** 스텝 예산이나 누적 상한 때문에 시간을 버린 프레임 수 */
+    uint64 NumThrottledFrames = 0;
+
+    /** 지금까지 버린 시뮬레이션 시간 (초) */
+    double DroppedTime = 0.0;
+
+    /** 마지막 프레임 기준 값 */
+    uint32 FrameSteps = 0;
+    float FrameDroppedTime = 0.0f;
+    float CurrentTimeStep = 0.0f;
+};
+
+/**
+ * 고정 스텝 시뮬레이션용 시간 관리자
+ *
+ * 매 프레임 Advance(또는 Tick)로 흐른 시간을 쌓고, ConsumeStep이 false를 돌려줄 때까지 스텝을 돌린다.
+ *     Time.Advance(DeltaTime);
+ *     float TimeStep;
+ *     while (Time.ConsumeStep(TimeStep)) { Simulate(TimeStep); }
+ *
+ * 한 프레임의 스텝 수와 누적 시간에 상한이 있어서, 느린 프레임이 다음 프레임을 더 느리게 만드는
+ * 악순환(spiral of death)에 빠지지 않는다. 상한을 넘은 시간은 버리고 FTimeStats에 기록한다.
+ */
+class FTimeManager
+{
+public:
+    /** @param InClock Tick에서 사용할 시계, Advance만 쓸 거면 nullptr */
+    explicit FTimeManager(const IClock* InClock = nullptr);
+
+    void SetSettings(const FTimeStepSettings& InSettings);
+    const FTimeStepSettings& GetSettings() const { return Settings; }
+
+    /**
+     * 시계를 읽어서 지난 Tick 이후 흐른 시간만큼 Advance합니다.
+     * @return 이번 프레임의 DeltaTime (초), 첫 호출은 0
+     */
+    float Tick();
+
+    /** DeltaTime만큼 시간을 쌓습니다. 프레임마다 한 번 호출 */
+    void Advance(float DeltaTime);
+
+    /**
+     * 쌓인 시간에서 스텝 하나를 꺼냅니다.
+     * @param OutTimeStep 이번 스텝의 길이 (적응형 스텝이면 FixedTimeStep보다 클 수 있음)
+     * @return 스텝을 돌려야 하면 true
+     */
+    bool ConsumeStep(float& OutTimeStep);
+
+    /** 남은 누적 시간 / 현재 스텝 크기 [0, 1], 렌더링 보간용 */
+    float GetAlpha() const;
+
+    float GetAccumulator() const { return Accumulator; }
+    float GetCurrentTimeStep() const { return CurrentTimeStep; }
+
+    const FTimeStats& GetStats() const { return Stats; }
+    void ResetStats();
+
+    /** 누적 시간과 시계 기준점을 초기화합니다. 통계는 유지 */
+    void Reset();
+
+private:
+    void DropTime(float Seconds);
+
+private:
+    const IClock* Clock;
+    double LastClockTime = 0.0;
+    bool bHasLastClockTime = false;
+
+    FTimeStepSettings Settings;
+    float Accumulator = 0.0f;
+    float CurrentTimeStep;
+    bool bThrottledThisFrame = false;
+
+    FTimeStats Stats;
+};
@@ -0,0 +1,274 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/ArraySearch.h"
+
+
+namespace
+{
+    template <typename ArrayType>
+    void FillSequence(ArrayType& Array, int32 Count)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Array.Add(i);
+        }
+    }
+
+    /** 순서와 상관없이 같은 원소를 가졌는지 */
+    template <typename ArrayType>
+    bool HasSameElements(const ArrayType& Array, std::vector<int32> Expected)
+    {
+        std::vector<int32> Actual(Array.begin(), Array.end());
+        std::sort(Actual.begin(), Actual.end());
+        std::sort(Expected.begin(), Expected.end());
+        return Actual == Expected;
+    }
+
+    /** ArraySearch::FindBitwise, TArray::Find가 std::find와 같은 위치를 돌려주는지, 다르면 기록하고 false */
+    template <typename T>
+    bool CheckFind(const std::vector<T>& Data, const T& Item, const char* TypeName)
+    {
+        const size_t Expected = static_cast<size_t>(std::find(Data.begin(), Data.end(), Item) - Data.begin());
+        const size_t Actual = ArraySearch::FindBitwise(Data.data(), Data.size(), Item);
+
+        TArray<T> Array;
+        for (const T& Value : Data)
+        {
+            Array.Add(Value);
+        }
+        const int32 ArrayIndex = Array.Find(Item);
+        const int32 ExpectedArrayIndex = Expected == Data.size() ? -1 : static_cast<int32>(Expected);
+
+        if (Actual != Expected || ArrayIndex != ExpectedArrayIndex || Array.Contains(Item) != (ExpectedArrayIndex != -1))
+        {
+            ReportTestFailure(__FILE__, __LINE__, std::string(TypeName) + " Num " + std::to_string(Data.size())
+                + ": FindBitwise " + std::to_string(Actual) + ", TArray::Find " + std::to_string(ArrayIndex) + ", std::find " + std::to_string(Expected));
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * 64바이트 블록 두 개와 16바이트 한 번, 원소 몇 개가 남을 때까지 모든 크기와 모든 일치 위치를 비교
+     * 블록 안의 네 레지스터, 16바이트 루프, 나머지 원소 루프에서 모두 한 번씩 찾게 됨
+     */
+    template <typename T>
+    bool CheckFindAllPositions(const char* TypeName)
+    {
+        constexpr size_t Lanes = 16 / sizeof(T);
+        constexpr size_t BlockLanes = Lanes * 4;
+        constexpr size_t MaxNum = BlockLanes * 2 + Lanes + Lanes - 1;
+
+        // 채우는 값은 1 ~ 7, 찾는 값은 어느 바이트도 그와 겹치지 않음
+        const T Item = static_cast<T>(0x5A5A5A5A5A5A5A5Aull);
+
+        for (size_t Num = 0; Num <= MaxNum; ++Num)
+        {
+            std::vector<T> Data(Num);
+            for (size_t i = 0; i < Num; ++i)
+            {
+                Data[i] = static_cast<T>(i % 7 + 1);
+            }
+
+            // 못 찾으면 Num
+            if (!CheckFind(Data, Item, TypeName))
+            {
+                return false;
+            }
+
+            for (size_t Position = 0; Position < Num; ++Position)
+            {
+                // 뒤에 하나 더 있어도 첫 번째 위치
+                Data[Position] = Item;
+                Data[Num - 1] = Item;
+                const bool bMatched = CheckFind(Data, Item, TypeName);
+                Data[Position] = static_cast<T>(Position % 7 + 1);
+                Data[Num - 1] = static_cast<T>((Num - 1) % 7 + 1);
+                if (!bMatched)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+void RegisterArrayTests(FTestRunner& Runner)
+{
+    Runner.Register("Array.RemoveAtSwap", []
+    {
+        TArray<int32> Array;
+        FillSequence(Array, 10);
+
+        // 마지막 원소가 빈자리로 옴
+        Array.RemoveAtSwap(2);
+        TEST_CHECK(Array.Num() == 9);
+        TEST_CHECK(Array[2] == 9);
+        TEST_CHECK(Array[8] == 8);
+
+        // 마지막 원소는 그냥 빠짐
+        Array.RemoveAtSwap(8);
+        TEST_CHECK(Array.Num() == 8);
+        TEST_CHECK(HasSameElements(Array, { 0, 1, 9, 3, 4, 5, 6, 7 }));
+
+        // 범위 밖은 무시
+        Array.RemoveAtSwap(-1);
+        Array.RemoveAtSwap(8);
+        TEST_CHECK(Array.Num() == 8);
+
+        TArray<std::string> Strings;
+        Strings.Add("a");
+        Strings.Add("b");
+        Strings.Add("c");
+        Strings.RemoveAtSwap(0);
+        TEST_CHECK(Strings.Num() == 2);
+        TEST_CHECK(Strings[0] == "c");
+        TEST_CHECK(Strings[1] == "b");
+        Strings.RemoveAtSwap(1);
+        Strings.RemoveAtSwap(0);
+        TEST_CHECK(Strings.Num() == 0);
+    });
+
+    Runner.Register("Array.RemoveAllSwap", []
+    {
+        TArray<int32> Array;
+        FillSequence(Array, 20);
+
+        const int32 NumRemoved = Array.RemoveAllSwap([](int32 Value) { return Value % 2 == 0; });
+        TEST_CHECK(NumRemoved == 10);
+        TEST_CHECK(Array.Num() == 10);
+        TEST_CHECK(HasSameElements(Array, { 1, 3, 5, 7, 9, 11, 13, 15, 17, 19 }));
+
+        // 끝에서 옮겨온 원소도 조건에 맞으면 지워져야 함
+        TArray<int32> Tail;
+        for (const int32 Value : { 1, 2, 3, 4, 4, 4 })
+        {
+            Tail.Add(Value);
+        }
+        TEST_CHECK(Tail.RemoveAllSwap([](int32 Value) { return Value >= 2; }) == 5);
+        TEST_CHECK(Tail.Num() == 1);
+        TEST_CHECK(Tail[0] == 1);
+
+        TEST_CHECK(Array.RemoveAllSwap([](int32) { return false; }) == 0);
+        TEST_CHECK(Array.Num() == 10);
+        TEST_CHECK(Array.RemoveAllSwap([](int32) { return true; }) == 10);
+        TEST_CHECK(Array.Num() == 0);
+
+        TArray<std::string> Strings;
+        for (const char* Value : { "keep0", "drop", "keep1", "drop", "drop", "keep2" })
+        {
+            Strings.Add(Value);
+        }
+        TEST_CHECK(Strings.RemoveAllSwap([](const std::string& Value) { return Value == "drop"; }) == 3);
+        TEST_CHECK(Strings.Num() == 3);
+        TEST_CHECK(std::all_of(Strings.begin(), Strings.end(), [](const std::string& Value) { return Value.rfind("keep", 0) == 0; }));
+    });
+
+    Runner.Register("Array.MoveAppend", []
+    {
+        // 빈 배열에 붙이면 버퍼를 그대로 가져옴
+        TArray<int32> Empty;
+        TArray<int32> Source;
+        FillSequence(Source, 5);
+        const int32* SourceData = Source.GetData();
+
+        Empty.Append(std::move(Source));
+        TEST_CHECK(Empty.Num() == 5);
+        TEST_CHECK(Empty.GetData() == SourceData);
+        TEST_CHECK(Source.Num() == 0);
+        for (int32 i = 0; i < 5; ++i)
+        {
+            TEST_CHECK(Empty[i] == i);
+        }
+
+        // 비어 있지 않으면 뒤에 순서대로 붙음
+        TArray<int32> Tail;
+        FillSequence(Tail, 3);
+        Empty.Append(std::move(Tail));
+        TEST_CHECK(Empty.Num() == 8);
+        TEST_CHECK(Tail.Num() == 0);
+        const int32 Expected[] = { 0, 1, 2, 3, 4, 0, 1, 2 };
+        TEST_CHECK(std::equal(Empty.begin(), Empty.end(), std::begin(Expected), std::end(Expected)));
+
+        // 빈 배열을 붙이면 그대로
+        TArray<int32> Nothing;
+        Empty.Append(std::move(Nothing));
+        TEST_CHECK(Empty.Num() == 8);
+
+        TArray<std::string> Strings;
+        Strings.Add("a");
+        TArray<std::string> MoreStrings;
+        MoreStrings.Add("b");
+        MoreStrings.Add("c");
+        Strings.Append(std::move(MoreStrings));
+        TEST_CHECK(Strings.Num() == 3);
+        TEST_CHECK(Strings[2] == "c");
+        TEST_CHECK(MoreStrings.Num() == 0);
+
+        const int32 Copied[] = { 7, 8 };
+        Empty.Append(Copied);
+        TEST_CHECK(Empty.Num() == 10);
+        TEST_CHECK(Empty[9] == 8);
+    });
+
+    Runner.Register("Array.FindMatchesStdFind", []
+    {
+        TEST_CHECK(CheckFindAllPositions<uint8>("uint8"));
+        TEST_CHECK(CheckFindAllPositions<uint16>("uint16"));
+        TEST_CHECK(CheckFindAllPositions<uint32>("uint32"));
+        TEST_CHECK(CheckFindAllPositions<uint64>("uint64"));
+        TEST_CHECK(CheckFindAllPositions<int32>("int32"));
+    });
+
+    Runner.Register("Array.FindWideValueHalves", []
+    {
+        // SSE2에는 64비트 비교가 없어서 32비트 두 칸을 합쳐 보므로, 한쪽 절반만 같은 원소를 찾으면 안 됨
+        constexpr uint64 Item = 0x1111111122222222ull;
+        constexpr uint64 LowOnly = 0xAAAAAAAA22222222ull;
+        constexpr uint64 HighOnly = 0x11111111BBBBBBBBull;
+
+        // 원소 경계를 걸쳐서 읽으면 Item이 되는 배치 (앞 원소의 위쪽 절반 = Item의 아래쪽, 뒤 원소의 아래쪽 절반 = Item의 위쪽)
+        constexpr uint64 StraddleFirst = 0x22222222CCCCCCCCull;
+        constexpr uint64 StraddleSecond = 0xDDDDDDDD11111111ull;
+
+        for (size_t Num = 1; Num <= 2 * 8 + 2 + 1; ++Num)
+        {
+            std::vector<uint64> Data(Num);
+            for (size_t i = 0; i < Num; ++i)
+            {
+                Data[i] = i % 2 == 0 ? LowOnly : HighOnly;
+            }
+            if (!TEST_CHECK(CheckFind(Data, Item, "uint64 halves")))
+            {
+                return;
+            }
+
+            for (size_t i = 0; i < Num; ++i)
+            {
+                Data[i] = i % 2 == 0 ? StraddleFirst : StraddleSecond;
+            }
+            if (!TEST_CHECK(CheckFind(Data, Item, "uint64 straddle")))
+            {
+                return;
+            }
+
+            // 진짜 값은 어디에 있든 찾음
+            for (size_t Position = 0; Position < Num; ++Position)
+            {
+                std::vector<uint64> WithItem = Data;
+                WithItem[Position] = Item;
+                if (!TEST_CHECK(CheckFind(WithItem, Item, "uint64 halves")))
+                {
+                    return;
+                }
+            }
+        }
+    });
+}
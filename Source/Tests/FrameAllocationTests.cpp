@@ -0,0 +1,191 @@
+﻿#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "InputSystem.h"
+#include "USimulation.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Profiler/Profiler.h"
+#include "Core/Profiler/ProfilerHistory.h"
+#include "Core/Time/Clock.h"
+#include "Core/Time/TimeManager.h"
+
+/**
+ * 전역 operator new를 바꿔서 모든 힙 할당을 세야 하므로 다른 테스트와 나눈 실행 파일
+ * EngineCore가 WITH_MEMORY_TRACKING=1로 빌드되면 operator new가 겹치므로 기본값(0)에서만 빌드한다.
+ */
+
+namespace
+{
+    std::atomic<uint64> NumHeapAllocations = 0;
+
+    void* CountedAllocate(size_t Size, size_t Alignment)
+    {
+        NumHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        void* Ptr = nullptr;
+        if (Alignment <= alignof(std::max_align_t))
+        {
+            Ptr = std::malloc(Size != 0 ? Size : 1);
+        }
+        else
+        {
+#if defined(_MSC_VER)
+            Ptr = _aligned_malloc(Size != 0 ? Size : 1, Alignment);
+#else
+            Ptr = std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+#endif
+        }
+
+        if (!Ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return Ptr;
+    }
+
+    void CountedFree(void* Ptr, size_t Alignment)
+    {
+#if defined(_MSC_VER)
+        if (Alignment > alignof(std::max_align_t))
+        {
+            _aligned_free(Ptr);
+            return;
+        }
+#endif
+        (void)Alignment;
+        std::free(Ptr);
+    }
+}
+
+void* operator new(size_t Size) { return CountedAllocate(Size, alignof(std::max_align_t)); }
+void* operator new[](size_t Size) { return CountedAllocate(Size, alignof(std::max_align_t)); }
+void* operator new(size_t Size, std::align_val_t Alignment) { return CountedAllocate(Size, static_cast<size_t>(Alignment)); }
+void* operator new[](size_t Size, std::align_val_t Alignment) { return CountedAllocate(Size, static_cast<size_t>(Alignment)); }
+
+void operator delete(void* Ptr) noexcept { CountedFree(Ptr, alignof(std::max_align_t)); }
+void operator delete[](void* Ptr) noexcept { CountedFree(Ptr, alignof(std::max_align_t)); }
+void operator delete(void* Ptr, size_t) noexcept { CountedFree(Ptr, alignof(std::max_align_t)); }
+void operator delete[](void* Ptr, size_t) noexcept { CountedFree(Ptr, alignof(std::max_align_t)); }
+void operator delete(void* Ptr, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<size_t>(Alignment)); }
+void operator delete[](void* Ptr, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<size_t>(Alignment)); }
+void operator delete(void* Ptr, size_t, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<size_t>(Alignment)); }
+void operator delete[](void* Ptr, size_t, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<size_t>(Alignment)); }
+
+namespace
+{
+    /** main.cpp의 메인 루프에서 창, 렌더러, ImGui를 뺀 부분 */
+    class FHeadlessFrameLoop
+    {
+    public:
+        FHeadlessFrameLoop()
+            : ProfilerHistory(FProfiler::Get().GetSecondsPerTick())
+            , FixedTime(&Clock)
+        {
+            FProfiler::Get().SetEnabled(true);
+            InputSystem::Get().SetClock(&Clock);
+
+            FSimulationSettings Settings = Simulation.GetSettings();
+            Settings.NumBalls = 300;
+            Settings.bApplyGravity = true;
+            Settings.bBallCollision = true;
+            Simulation.SetSettings(Settings);
+            Simulation.Reset(1);
+        }
+
+        void RunFrame()
+        {
+            PROFILE_SCOPE("Frame");
+
+            FFrameArena::Get().Reset();
+            ProfilerHistory.Update(FProfiler::Get());
+
+            Clock.Advance(1.0 / 60.0);
+            const float DeltaTime = FixedTime.Tick();
+
+            {
+                PROFILE_SCOPE("Input");
+
+                // 카메라 조작처럼 키를 누르고 떼면서 마우스를 움직임
+                const EKeyCode Key = (FrameIndex / 10) % 2 == 0 ? EKeyCode::W : EKeyCode::A;
+                if (FrameIndex % 10 == 0)
+                {
+                    InputSystem::Get().KeyDown(Key);
+                    InputSystem::Get().MouseKeyDown(FVector(100, 100, 0), FVector(1024, 1024, 0), true);
+                }
+                else if (FrameIndex % 10 == 9)
+                {
+                    InputSystem::Get().KeyUp(Key);
+                    InputSystem::Get().MouseKeyUp(FVector(100, 100, 0), FVector(1024, 1024, 0), true);
+                }
+                InputSystem::Get().MouseMove(FVector(static_cast<float>(FrameIndex % 200), 50, 0));
+                InputSystem::Get().ProcessEvents();
+            }
+
+            {
+                PROFILE_SCOPE("Simulation");
+                Simulation.Tick(DeltaTime);
+            }
+
+            {
+                PROFILE_SCOPE("Interpolate");
+                const FSimulationSnapshot& Snapshot = Simulation.ConsumeSnapshot();
+                Snapshot.Interpolate(Simulation.GetInterpolationAlpha(Snapshot), RenderStates);
+            }
+
+            ++FrameIndex;
+        }
+
+        const FProfilerHistory& GetProfilerHistory() const { return ProfilerHistory; }
+        const std::vector<FObjectRenderState>& GetRenderStates() const { return RenderStates; }
+
+    private:
+        FProfilerHistory ProfilerHistory;
+        FFakeClock Clock;
+        FTimeManager FixedTime;
+        USimulation Simulation;
+        std::vector<FObjectRenderState> RenderStates;
+        uint32 FrameIndex = 0;
+    };
+}
+
+int main(int Argc, char** Argv)
+{
+    FTestRunner Runner;
+
+    Runner.Register("FrameAllocation.SteadyStateFrameLoop", []
+    {
+        FHeadlessFrameLoop Loop;
+
+        // 프로파일러 스레드 버퍼, 히스토리 링, 스냅샷 버퍼 등이 자리를 잡을 때까지
+        // (히스토리가 가득 차서 오래된 프레임을 재사용하기 시작한 뒤까지 돌림)
+        constexpr uint32 NumWarmFrames = 300;
+        for (uint32 i = 0; i < NumWarmFrames; ++i)
+        {
+            Loop.RunFrame();
+        }
+        TEST_CHECK(Loop.GetRenderStates().size() == 300);
+#if WITH_PROFILER
+        TEST_CHECK(Loop.GetProfilerHistory().NumFrames() > 0);
+#endif
+
+        const uint64 BlockAllocationsBefore = FFrameArena::Get().GetNumBlockAllocations();
+        const uint64 HeapAllocationsBefore = NumHeapAllocations.load();
+
+        constexpr uint32 NumMeasuredFrames = 300;
+        for (uint32 i = 0; i < NumMeasuredFrames; ++i)
+        {
+            Loop.RunFrame();
+        }
+
+        const uint64 HeapAllocations = NumHeapAllocations.load() - HeapAllocationsBefore;
+        TEST_CHECK_NEAR(static_cast<double>(HeapAllocations), 0.0, 0.0);
+        TEST_CHECK(FFrameArena::Get().GetNumBlockAllocations() == BlockAllocationsBefore);
+    });
+
+    const std::vector<std::string> Args(Argv + 1, Argv + Argc);
+    return RunTestMain(Runner, Args);
+}
@@ -0,0 +1,138 @@
+﻿#include "TestCases.h"
+
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "Test.h"
+#include "Core/Time/Clock.h"
+#include "Core/Time/FramePacer.h"
+
+
+namespace
+{
+    /** 호출 스레드가 사용자 모드에서 쓴 CPU 시간 (초) */
+    double GetThreadUserTime()
+    {
+#if defined(_WIN32)
+        FILETIME CreationTime, ExitTime, KernelTime, UserTime;
+        GetThreadTimes(GetCurrentThread(), &CreationTime, &ExitTime, &KernelTime, &UserTime);
+        const uint64 Ticks = (static_cast<uint64>(UserTime.dwHighDateTime) << 32) | UserTime.dwLowDateTime;
+        return static_cast<double>(Ticks) * 1.0e-7;
+#else
+        rusage Usage;
+#if defined(RUSAGE_THREAD)
+        getrusage(RUSAGE_THREAD, &Usage);
+#else
+        getrusage(RUSAGE_SELF, &Usage);
+#endif
+        return static_cast<double>(Usage.ru_utime.tv_sec) + static_cast<double>(Usage.ru_utime.tv_usec) * 1.0e-6;
+#endif
+    }
+}
+
+void RegisterFramePacerTests(FTestRunner& Runner)
+{
+    // 실제 시계로 60Hz 120프레임, 2초 정도 걸림
+    // 바쁜 대기로만 맞추면 CPU를 프레임 시간만큼 다 쓰므로, 사용자 CPU 시간으로 재우기가 제대로 되는지 봄
+    Runner.Register("FramePacer.PlatformClockJitterAndCpuTime", []
+    {
+        constexpr double TargetFrameTime = 1.0 / 60.0;
+        constexpr uint32 NumWarmFrames = 10;
+        constexpr uint32 NumFrames = 120;
+
+        FPlatformClock Clock;
+        FFramePacer Pacer(Clock, TargetFrameTime);
+
+        // 처음 몇 프레임은 수면 오차를 추정하는 중
+        for (uint32 i = 0; i < NumWarmFrames; ++i)
+        {
+            Pacer.WaitForNextFrame();
+        }
+        Pacer.ResetStats();
+
+        const double UserTimeBefore = GetThreadUserTime();
+        for (uint32 i = 0; i < NumFrames; ++i)
+        {
+            Pacer.WaitForNextFrame();
+        }
+        const double UserTimePerFrame = (GetThreadUserTime() - UserTimeBefore) / NumFrames;
+
+        const FFramePacerStats& Stats = Pacer.GetStats();
+        std::printf("  mean %.3f ms, jitter %.3f ms, max error %.3f ms, sleep estimate %.3f ms, user CPU %.3f ms/frame\n",
+            Stats.MeanFrameTime * 1000.0, Stats.FrameTimeJitter * 1000.0, Stats.MaxFrameTimeError * 1000.0,
+            Stats.SleepEstimate * 1000.0, UserTimePerFrame * 1000.0);
+
+        // 공유 CI 기기에서도 통과하도록 여유를 둔 기준, 바쁜 대기만 하면 사용자 CPU가 16ms 가까이 나옴
+        TEST_CHECK(Stats.NumFrames == NumFrames);
+        TEST_CHECK_NEAR(Stats.MeanFrameTime, TargetFrameTime, 0.0005);
+        TEST_CHECK(Stats.FrameTimeJitter < 0.002);
+        TEST_CHECK(UserTimePerFrame < TargetFrameTime * 0.25);
+    });
+
+    // 잘 때마다 0.5ms 늦게 깨어나는 시계: 추정값이 0.5ms로 수렴하고, 그만큼만 바쁜 대기로 남아야 함
+    Runner.Register("FramePacer.FakeClockSleepSpinSplit", []
+    {
+        constexpr double TargetFrameTime = 1.0 / 60.0;
+        constexpr double Oversleep = 0.0005;
+        constexpr double PauseTime = 1.0e-6;
+
+        FFakeClock Clock;
+        Clock.SetOversleepTime(Oversleep);
+        Clock.SetPauseTime(PauseTime);
+        FFramePacer Pacer(Clock, TargetFrameTime);
+
+        // 첫 프레임은 초기 추정값(1ms)만큼 바쁜 대기
+        Pacer.WaitForNextFrame();
+        TEST_CHECK(Pacer.GetStats().LastSpinTime > 0.0);
+
+        for (uint32 i = 0; i < 10; ++i)
+        {
+            Pacer.WaitForNextFrame();
+        }
+        Pacer.ResetStats();
+
+        for (uint32 Frame = 0; Frame < 60; ++Frame)
+        {
+            // 프레임마다 일하는 시간을 다르게 둠
+            const double WorkTime = 0.001 * (Frame % 8);
+            Clock.Advance(WorkTime);
+            const double FrameTime = Pacer.WaitForNextFrame();
+
+            const FFramePacerStats& Stats = Pacer.GetStats();
+            TEST_CHECK_NEAR(FrameTime, TargetFrameTime, PauseTime);
+            TEST_CHECK_NEAR(Stats.SleepEstimate, Oversleep, 1.0e-9);
+
+            // 남은 시간은 거의 다 자고, 바쁜 대기는 추정값과 건너뛴 짧은 수면(0.1ms 미만)을 넘지 않음
+            TEST_CHECK(Stats.LastSpinTime >= 0.0);
+            TEST_CHECK(Stats.LastSpinTime <= Oversleep + 0.0001 + PauseTime);
+            TEST_CHECK_NEAR(WorkTime + Stats.LastSleepTime + Stats.LastSpinTime, TargetFrameTime, PauseTime);
+        }
+
+        const FFramePacerStats& Stats = Pacer.GetStats();
+        TEST_CHECK(Stats.MaxFrameTimeError <= PauseTime);
+        TEST_CHECK(Stats.FrameTimeJitter < PauseTime);
+    });
+
+    // 한 프레임 넘게 밀리면 기다리지 않고, 밀린 만큼을 따라잡으려 하지도 않음
+    Runner.Register("FramePacer.FakeClockLongFrameDoesNotCatchUp", []
+    {
+        constexpr double TargetFrameTime = 1.0 / 60.0;
+
+        FFakeClock Clock;
+        FFramePacer Pacer(Clock, TargetFrameTime);
+
+        Clock.Advance(TargetFrameTime * 2.5);
+        const double LongFrameTime = Pacer.WaitForNextFrame();
+        TEST_CHECK_NEAR(LongFrameTime, TargetFrameTime * 2.5, 1.0e-12);
+        TEST_CHECK(Pacer.GetStats().LastSleepTime == 0.0);
+        TEST_CHECK(Pacer.GetStats().LastSpinTime == 0.0);
+
+        const double NextFrameTime = Pacer.WaitForNextFrame();
+        TEST_CHECK_NEAR(NextFrameTime, TargetFrameTime, 1.0e-5);
+    });
+}
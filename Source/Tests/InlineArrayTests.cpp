@@ -0,0 +1,89 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Container/InlineArray.h"
+
+
+namespace
+{
+    template <typename ArrayType>
+    void FillSequence(ArrayType& Array, int32 Count)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Array.Add(i);
+        }
+    }
+
+    /** 순서와 상관없이 같은 원소를 가졌는지 */
+    template <typename ArrayType>
+    bool HasSameElements(const ArrayType& Array, std::vector<int32> Expected)
+    {
+        std::vector<int32> Actual(Array.begin(), Array.end());
+        std::sort(Actual.begin(), Actual.end());
+        std::sort(Expected.begin(), Expected.end());
+        return Actual == Expected;
+    }
+}
+
+void RegisterInlineArrayTests(FTestRunner& Runner)
+{
+    Runner.Register("InlineArray.InlineToHeapTransitions", []
+    {
+        TInlineArray<int32, 4> Array;
+        TEST_CHECK(Array.IsInline());
+        TEST_CHECK(Array.Len() >= 4);
+
+        FillSequence(Array, 4);
+        TEST_CHECK(Array.IsInline());
+
+        // N개를 넘으면 힙으로 옮겨 가고 원소는 그대로
+        Array.Add(4);
+        TEST_CHECK(!Array.IsInline());
+        TEST_CHECK(Array.Num() == 5);
+        for (int32 i = 0; i < 5; ++i)
+        {
+            TEST_CHECK(Array[i] == i);
+        }
+
+        // 힙에 있던 배열도 N개 이하면 복사/이동한 쪽은 자기 버퍼를 씀
+        Array.RemoveAtSwap(0);
+        TEST_CHECK(Array.Num() == 4);
+        TInlineArray<int32, 4> Copy(Array);
+        TEST_CHECK(Copy.IsInline());
+        TEST_CHECK(HasSameElements(Copy, { 1, 2, 3, 4 }));
+
+        TInlineArray<int32, 4> Moved(std::move(Copy));
+        TEST_CHECK(Moved.IsInline());
+        TEST_CHECK(Moved.Num() == 4);
+        TEST_CHECK(Copy.Num() == 0);
+        TEST_CHECK(Copy.IsInline());
+
+        // 넘치는 배열을 복사하면 복사본도 힙으로
+        Array.Add(5);
+        TInlineArray<int32, 4> Big(Array);
+        TEST_CHECK(!Big.IsInline());
+        TEST_CHECK(Big.Num() == 5);
+
+        // 원소 단위로 옮기므로 빈 인라인 배열에 붙여도 자기 버퍼에 남음
+        TInlineArray<int32, 4> Target;
+        TInlineArray<int32, 4> Small;
+        FillSequence(Small, 3);
+        Target.Append(std::move(Small));
+        TEST_CHECK(Target.IsInline());
+        TEST_CHECK(Target.Num() == 3);
+        TEST_CHECK(Small.Num() == 0);
+        TEST_CHECK(Small.IsInline());
+
+        // 대입도 원소 단위
+        Target = Big;
+        TEST_CHECK(Target.Num() == 5);
+        TEST_CHECK(!Target.IsInline());
+        Target = Moved;
+        TEST_CHECK(Target.Num() == 4);
+        TEST_CHECK(HasSameElements(Target, { 1, 2, 3, 4 }));
+    });
+}
@@ -0,0 +1,292 @@
+﻿#include "TestCases.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "Test.h"
+#include "InputRecording.h"
+#include "InputSystem.h"
+#include "USimulation.h"
+#include "Core/Time/Clock.h"
+
+
+namespace
+{
+    constexpr uint32 NumRecordedFrames = 300;
+    constexpr uint32 RecordingSeed = 42;
+
+    std::filesystem::path GetTempPath(const char* Name)
+    {
+        return std::filesystem::temp_directory_path() / Name;
+    }
+
+    std::vector<char> ReadFile(const std::filesystem::path& Path)
+    {
+        std::ifstream File(Path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>() };
+    }
+
+    void WriteFile(const std::filesystem::path& Path, const std::vector<char>& Bytes, size_t Size)
+    {
+        std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+        File.write(Bytes.data(), static_cast<std::streamsize>(Size));
+    }
+
+    bool IsSameSnapshot(const FInputSnapshot& A, const FInputSnapshot& B)
+    {
+        return A.Keys == B.Keys && A.PreviousKeys == B.PreviousKeys
+            && A.MouseButtons == B.MouseButtons && A.MouseClicked == B.MouseClicked
+            && A.MousePos == B.MousePos && A.MousePrePos == B.MousePrePos
+            && A.NumEvents == B.NumEvents;
+    }
+
+    /**
+     * 임의 입력을 InputSystem으로 흘려서 녹화하고, 프레임마다의 스냅샷을 돌려줌
+     * 시뮬레이션 설정은 main.cpp처럼 UserData에 담음
+     */
+    std::vector<FInputSnapshot> RecordRandomInput(FInputRecording& Recording, const FSimulationSettings& Settings)
+    {
+        FFakeClock Clock;
+        InputSystem& Input = InputSystem::Get();
+        Input.SetClock(&Clock);
+        Input.StartReplay(nullptr);
+        Input.ProcessEvents();
+
+        Recording.Reset(1.0f / 60.0f, RecordingSeed);
+        Recording.SetUserData({ reinterpret_cast<const uint8*>(&Settings), sizeof(FSimulationSettings) });
+        Input.StartRecording(&Recording);
+
+        std::mt19937 Random(7);
+        std::vector<FInputSnapshot> Snapshots;
+        for (uint32 Frame = 0; Frame < NumRecordedFrames; ++Frame)
+        {
+            Clock.Advance(1.0 / 60.0);
+            const uint32 NumEvents = Random() % 5;
+            for (uint32 i = 0; i < NumEvents; ++i)
+            {
+                const FVector Position(static_cast<float>(Random() % 1024), static_cast<float>(Random() % 768), 0.0f);
+                const FVector ViewSize(1024.0f, 768.0f, 0.0f);
+                switch (Random() % 5)
+                {
+                case 0: Input.KeyDown(static_cast<EKeyCode>(Random() % 256)); break;
+                case 1: Input.KeyUp(static_cast<EKeyCode>(Random() % 256)); break;
+                case 2: Input.MouseKeyDown(Position, ViewSize, Random() % 2); break;
+                case 3: Input.MouseKeyUp(Position, ViewSize, Random() % 2); break;
+                default: Input.MouseMove(Position - FVector(300.0f, 300.0f, 0.0f)); break;
+                }
+            }
+            Input.ProcessEvents();
+            Snapshots.push_back(Input.GetSnapshot());
+        }
+
+        Input.StartRecording(nullptr);
+        Input.SetClock(nullptr);
+        return Snapshots;
+    }
+
+    /** main.cpp의 재생 루프처럼 녹화의 시드와 설정으로 Reset하고, 프레임마다 입력을 적용하고 Tick */
+    uint64 ReplayWithSimulation(const FInputRecording& Recording)
+    {
+        FSimulationSettings Settings;
+        const std::span<const uint8> RecordedSettings = Recording.GetUserData();
+        if (RecordedSettings.size() == sizeof(FSimulationSettings))
+        {
+            std::memcpy(&Settings, RecordedSettings.data(), sizeof(FSimulationSettings));
+        }
+
+        USimulation Simulation;
+        Simulation.SetSettings(Settings);
+        Simulation.Reset(Recording.GetRandomSeed());
+
+        InputSystem& Input = InputSystem::Get();
+        Input.StartReplay(&Recording);
+        while (!Input.IsReplayFinished())
+        {
+            Input.ProcessEvents();
+            Simulation.Tick(Recording.GetFrameTime());
+        }
+        Input.StartReplay(nullptr);
+
+        return Simulation.GetStateHash();
+    }
+
+    FSimulationSettings MakeRecordedSettings()
+    {
+        FSimulationSettings Settings;
+        Settings.NumBalls = 100;
+        Settings.bApplyGravity = true;
+        Settings.bBallCollision = true;
+        return Settings;
+    }
+}
+
+void RegisterInputRecordingTests(FTestRunner& Runner)
+{
+    Runner.Register("InputRecording.SaveLoadRoundTrip", []
+    {
+        FInputRecording Recording;
+        RecordRandomInput(Recording, MakeRecordedSettings());
+        TEST_CHECK(Recording.NumFrames() == NumRecordedFrames);
+        TEST_CHECK(Recording.NumEvents() > 0);
+
+        const std::filesystem::path Path = GetTempPath("InputRecordingTests.inrc");
+        TEST_CHECK(Recording.Save(Path));
+
+        FInputRecording Loaded;
+        TEST_CHECK(Loaded.Load(Path));
+        std::filesystem::remove(Path);
+
+        TEST_CHECK(Loaded.NumFrames() == Recording.NumFrames());
+        TEST_CHECK(Loaded.NumEvents() == Recording.NumEvents());
+        TEST_CHECK(Loaded.GetFrameTime() == Recording.GetFrameTime());
+        TEST_CHECK(Loaded.GetRandomSeed() == RecordingSeed);
+        TEST_CHECK(Loaded.GetUserData().size() == sizeof(FSimulationSettings));
+        TEST_CHECK(std::equal(Loaded.GetUserData().begin(), Loaded.GetUserData().end(), Recording.GetUserData().begin()));
+
+        uint32 NumMismatched = 0;
+        for (uint32 Frame = 0; Frame < Recording.NumFrames(); ++Frame)
+        {
+            const std::span<const FInputEvent> Expected = Recording.GetFrameEvents(Frame);
+            const std::span<const FInputEvent> Actual = Loaded.GetFrameEvents(Frame);
+            if (Expected.size() != Actual.size())
+            {
+                ++NumMismatched;
+                continue;
+            }
+
+            for (size_t i = 0; i < Expected.size(); ++i)
+            {
+                const FInputEvent& A = Expected[i];
+                const FInputEvent& B = Actual[i];
+
+                // 시각은 마이크로초 단위로 저장됨
+                const bool bSame = A.Type == B.Type && A.Code == B.Code && A.X == B.X && A.Y == B.Y
+                    && A.ViewWidth == B.ViewWidth && A.ViewHeight == B.ViewHeight
+                    && std::llround(A.Timestamp * 1.0e6) == std::llround(B.Timestamp * 1.0e6);
+                NumMismatched += bSame ? 0 : 1;
+            }
+        }
+        TEST_CHECK(NumMismatched == 0);
+    });
+
+    // 재생하는 동안은 라이브 입력을 무시하고, 녹화할 때와 같은 스냅샷이 나옴
+    Runner.Register("InputRecording.ReplayMatchesLiveInput", []
+    {
+        FInputRecording Recording;
+        const std::vector<FInputSnapshot> LiveSnapshots = RecordRandomInput(Recording, MakeRecordedSettings());
+
+        InputSystem& Input = InputSystem::Get();
+        Input.StartReplay(&Recording);
+        uint32 NumMismatched = 0;
+        for (uint32 Frame = 0; Frame < NumRecordedFrames; ++Frame)
+        {
+            TEST_CHECK(!Input.IsReplayFinished());
+            Input.KeyDown(EKeyCode::Q);
+            Input.MouseMove(FVector(5.0f, 5.0f, 0.0f));
+            Input.ProcessEvents();
+            NumMismatched += IsSameSnapshot(Input.GetSnapshot(), LiveSnapshots[Frame]) ? 0 : 1;
+        }
+        TEST_CHECK(NumMismatched == 0);
+        TEST_CHECK(Input.IsReplayFinished());
+        TEST_CHECK(Input.GetReplayFrame() == NumRecordedFrames);
+        Input.StartReplay(nullptr);
+    });
+
+    Runner.Register("InputRecording.RejectsTruncatedOrCorruptFile", []
+    {
+        FInputRecording Recording;
+        RecordRandomInput(Recording, MakeRecordedSettings());
+
+        const std::filesystem::path Path = GetTempPath("InputRecordingTests.inrc");
+        const std::filesystem::path BadPath = GetTempPath("InputRecordingTests.bad.inrc");
+        TEST_CHECK(Recording.Save(Path));
+        const std::vector<char> Bytes = ReadFile(Path);
+        std::filesystem::remove(Path);
+        TEST_CHECK(Bytes.size() > 32);
+
+        // 실패하면 내용이 비어 있어야 함
+        const auto ExpectRejected = [&BadPath](const std::vector<char>& FileBytes, size_t Size)
+        {
+            WriteFile(BadPath, FileBytes, Size);
+            FInputRecording Loaded;
+            const bool bLoaded = Loaded.Load(BadPath);
+            return !bLoaded && Loaded.NumFrames() == 0 && Loaded.NumEvents() == 0 && Loaded.GetUserData().empty();
+        };
+
+        // 헤더 중간, 헤더 끝, 이벤트 중간, 마지막 한 바이트가 잘린 파일
+        for (const size_t Size : { size_t(0), size_t(3), size_t(10), size_t(27), Bytes.size() / 2, Bytes.size() - 1 })
+        {
+            TEST_CHECK(ExpectRejected(Bytes, Size));
+        }
+
+        // 매직, 버전
+        std::vector<char> Corrupt = Bytes;
+        Corrupt[0] = 'X';
+        TEST_CHECK(ExpectRejected(Corrupt, Corrupt.size()));
+        Corrupt = Bytes;
+        Corrupt[4] = 2;
+        TEST_CHECK(ExpectRejected(Corrupt, Corrupt.size()));
+
+        // 헤더의 이벤트 수가 실제와 다름 (Magic, Version, FrameTime, Seed, NumFrames 뒤)
+        Corrupt = Bytes;
+        Corrupt[20] = static_cast<char>(Corrupt[20] + 1);
+        TEST_CHECK(ExpectRejected(Corrupt, Corrupt.size()));
+
+        // 뒤에 남는 바이트
+        Corrupt = Bytes;
+        Corrupt.push_back(0);
+        TEST_CHECK(ExpectRejected(Corrupt, Corrupt.size()));
+
+        // 임의 비트를 뒤집어도 읽다가 죽지 않고, 거부되면 비어 있음
+        std::mt19937 Random(1);
+        uint32 NumBadRejects = 0;
+        for (uint32 Iteration = 0; Iteration < 500; ++Iteration)
+        {
+            Corrupt = Bytes;
+            for (uint32 i = 0; i < 3; ++i)
+            {
+                Corrupt[4 + Random() % (Corrupt.size() - 4)] ^= static_cast<char>(1 << (Random() % 8));
+            }
+            WriteFile(BadPath, Corrupt, Corrupt.size());
+
+            FInputRecording Loaded;
+            if (!Loaded.Load(BadPath))
+            {
+                NumBadRejects += Loaded.NumFrames() == 0 && Loaded.NumEvents() == 0 ? 0 : 1;
+            }
+        }
+        TEST_CHECK(NumBadRejects == 0);
+
+        std::filesystem::remove(BadPath);
+        TEST_CHECK(!FInputRecording().Load(GetTempPath("InputRecordingTests.missing.inrc")));
+    });
+
+    // 같은 녹화를 두 번 재생하면 시뮬레이션 상태가 같음, 파일에서 읽은 녹화도 마찬가지
+    Runner.Register("InputRecording.ReplayIsDeterministic", []
+    {
+        FInputRecording Recording;
+        RecordRandomInput(Recording, MakeRecordedSettings());
+
+        const uint64 FirstHash = ReplayWithSimulation(Recording);
+
+        // Reset이 시드를 다시 넣으므로 그 전의 rand() 상태와는 무관해야 함
+        for (int32 i = 0; i < 17; ++i)
+        {
+            std::rand();
+        }
+
+        const std::filesystem::path Path = GetTempPath("InputRecordingTests.inrc");
+        TEST_CHECK(Recording.Save(Path));
+        FInputRecording Loaded;
+        TEST_CHECK(Loaded.Load(Path));
+        std::filesystem::remove(Path);
+
+        TEST_CHECK(ReplayWithSimulation(Loaded) == FirstHash);
+        TEST_CHECK(ReplayWithSimulation(Recording) == FirstHash);
+    });
+}
@@ -0,0 +1,234 @@
+﻿#include "TestCases.h"
+
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "InputRecording.h"
+#include "InputSystem.h"
+#include "Core/Async/MpscQueue.h"
+#include "Core/Time/Clock.h"
+
+
+namespace
+{
+    /** InputSystem은 싱글턴이라 케이스마다 큐를 비우고 눌린 상태를 지우고 시작 */
+    InputSystem& ResetInput()
+    {
+        InputSystem& Input = InputSystem::Get();
+        Input.StartReplay(nullptr);
+        Input.ProcessEvents();
+
+        // 녹화를 시작하면 스냅샷이 비워짐
+        FInputRecording Scratch;
+        Input.StartRecording(&Scratch);
+        Input.StartRecording(nullptr);
+        return Input;
+    }
+
+    struct FSequencedItem
+    {
+        uint32 Producer;
+        uint32 Sequence;
+    };
+}
+
+void RegisterInputTests(FTestRunner& Runner)
+{
+    Runner.Register("Input.ClickReleasedInSameFrame", []
+    {
+        InputSystem& Input = ResetInput();
+        const FVector ViewSize(200.0f, 100.0f, 0.0f);
+
+        Input.MouseKeyDown(FVector(100.0f, 50.0f, 0.0f), ViewSize, 0);
+        Input.MouseKeyUp(FVector(100.0f, 50.0f, 0.0f), ViewSize, 0);
+        Input.MouseMove(FVector(10.0f, 20.0f, 0.0f));
+
+        // ProcessEvents 전에는 상태가 바뀌지 않음
+        TEST_CHECK(!Input.GetMouseDown(false));
+
+        Input.ProcessEvents();
+        TEST_CHECK(Input.GetSnapshot().NumEvents == 3);
+        TEST_CHECK(Input.GetMouseDown(false));
+        TEST_CHECK(!Input.GetMouseDown(true));
+        TEST_CHECK(!Input.IsPressedMouse(false));
+        TEST_CHECK(Input.GetMouseDownNDCPos(false).X == 0.0f);
+        TEST_CHECK(Input.GetMouseDownNDCPos(false).Y == 0.0f);
+        TEST_CHECK(Input.GetMousePos().X == 10.0f);
+        TEST_CHECK(Input.GetMousePos().Y == 20.0f);
+
+        // 클릭은 그 프레임에만 남음
+        Input.ProcessEvents();
+        TEST_CHECK(!Input.GetMouseDown(false));
+        TEST_CHECK(Input.GetMousePrePos().X == 10.0f);
+    });
+
+    Runner.Register("Input.KeyEdges", []
+    {
+        InputSystem& Input = ResetInput();
+
+        Input.KeyDown(EKeyCode::W);
+        Input.ProcessEvents();
+        TEST_CHECK(Input.IsPressedKey(EKeyCode::W));
+        TEST_CHECK(Input.WasKeyJustPressed(EKeyCode::W));
+        TEST_CHECK(!Input.WasKeyJustReleased(EKeyCode::W));
+        TEST_CHECK(Input.GetJustPressedKeys().Count() == 1);
+        TEST_CHECK(Input.GetJustPressedKeys().Test(static_cast<uint8>(EKeyCode::W)));
+
+        // 누르고 있는 동안은 눌림 판정이 다시 나지 않음
+        Input.ProcessEvents();
+        TEST_CHECK(Input.IsPressedKey(EKeyCode::W));
+        TEST_CHECK(!Input.WasKeyJustPressed(EKeyCode::W));
+        TEST_CHECK(Input.GetJustPressedKeys().None());
+
+        Input.KeyDown(EKeyCode::A);
+        Input.KeyUp(EKeyCode::W);
+        Input.ProcessEvents();
+        TEST_CHECK(!Input.IsPressedKey(EKeyCode::W));
+        TEST_CHECK(Input.WasKeyJustReleased(EKeyCode::W));
+        TEST_CHECK(Input.WasKeyJustPressed(EKeyCode::A));
+        TEST_CHECK(Input.GetJustReleasedKeys().Count() == 1);
+
+        Input.KeyUp(EKeyCode::A);
+        Input.ProcessEvents();
+        Input.ProcessEvents();
+        TEST_CHECK(!Input.WasKeyJustReleased(EKeyCode::W));
+        TEST_CHECK(!Input.WasKeyJustReleased(EKeyCode::A));
+        TEST_CHECK(Input.GetPressedKeys().None());
+    });
+
+    Runner.Register("Input.QueueOverflowCountsDroppedEvents", []
+    {
+        InputSystem& Input = ResetInput();
+        const uint64 DroppedBefore = Input.GetNumDroppedEvents();
+
+        constexpr uint32 QueueCapacity = 1024;
+        constexpr uint32 NumEvents = QueueCapacity + 76;
+        uint32 NumAccepted = 0;
+        for (uint32 i = 0; i < NumEvents; ++i)
+        {
+            FInputEvent Event;
+            Event.Type = EInputEventType::KeyDown;
+            Event.Code = static_cast<uint8>(EKeyCode::A);
+            NumAccepted += Input.PushEvent(Event) ? 1 : 0;
+        }
+
+        TEST_CHECK(NumAccepted == QueueCapacity);
+        TEST_CHECK(Input.GetNumDroppedEvents() - DroppedBefore == NumEvents - QueueCapacity);
+
+        Input.ProcessEvents();
+        TEST_CHECK(Input.GetSnapshot().NumEvents == QueueCapacity);
+        TEST_CHECK(Input.IsPressedKey(EKeyCode::A));
+
+        // 비운 뒤에는 다시 들어감
+        Input.KeyUp(EKeyCode::A);
+        TEST_CHECK(Input.GetNumDroppedEvents() - DroppedBefore == NumEvents - QueueCapacity);
+        Input.ProcessEvents();
+        TEST_CHECK(!Input.IsPressedKey(EKeyCode::A));
+    });
+
+    // 생산자마다 넣은 순서대로 나오고, 빠지거나 겹치는 항목이 없어야 함
+    Runner.Register("Input.MpscQueueMultiProducerOrder", []
+    {
+        constexpr uint32 NumProducers = 4;
+        constexpr uint32 NumItemsPerProducer = 100000;
+
+        // 작은 큐로 가득 참과 되감기를 자주 겪게 함
+        static TMpscQueue<FSequencedItem, 64> Queue;
+
+        std::vector<std::thread> Producers;
+        for (uint32 Producer = 0; Producer < NumProducers; ++Producer)
+        {
+            Producers.emplace_back([Producer]
+            {
+                for (uint32 i = 0; i < NumItemsPerProducer; ++i)
+                {
+                    while (!Queue.Push({ Producer, i }))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        uint32 NextSequence[NumProducers] = {};
+        uint32 NumOutOfOrder = 0;
+        uint32 NumPopped = 0;
+        while (NumPopped < NumProducers * NumItemsPerProducer)
+        {
+            FSequencedItem Item;
+            if (!Queue.Pop(Item))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (Item.Producer >= NumProducers || Item.Sequence != NextSequence[Item.Producer])
+            {
+                ++NumOutOfOrder;
+            }
+            else
+            {
+                ++NextSequence[Item.Producer];
+            }
+            ++NumPopped;
+        }
+
+        for (std::thread& Thread : Producers)
+        {
+            Thread.join();
+        }
+
+        FSequencedItem Item;
+        TEST_CHECK(!Queue.Pop(Item));
+        TEST_CHECK(NumOutOfOrder == 0);
+        for (uint32 Producer = 0; Producer < NumProducers; ++Producer)
+        {
+            TEST_CHECK(NextSequence[Producer] == NumItemsPerProducer);
+        }
+    });
+
+    // 여러 스레드가 InputSystem에 넣은 이벤트가 모두 한 번씩 적용됨
+    Runner.Register("Input.MultiProducerEvents", []
+    {
+        InputSystem& Input = ResetInput();
+
+        constexpr uint32 NumProducers = 4;
+        constexpr uint32 NumEventsPerProducer = 20000;
+
+        std::vector<std::thread> Producers;
+        for (uint32 Producer = 0; Producer < NumProducers; ++Producer)
+        {
+            Producers.emplace_back([&Input, Producer]
+            {
+                FInputEvent Event;
+                Event.Type = EInputEventType::MouseMove;
+                Event.X = static_cast<int32>(Producer);
+                for (uint32 i = 0; i < NumEventsPerProducer; ++i)
+                {
+                    Event.Y = static_cast<int32>(i);
+                    while (!Input.PushEvent(Event))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        uint64 NumProcessed = 0;
+        while (NumProcessed < NumProducers * NumEventsPerProducer)
+        {
+            Input.ProcessEvents();
+            NumProcessed += Input.GetSnapshot().NumEvents;
+        }
+
+        for (std::thread& Thread : Producers)
+        {
+            Thread.join();
+        }
+
+        Input.ProcessEvents();
+        TEST_CHECK(NumProcessed == NumProducers * NumEventsPerProducer);
+        TEST_CHECK(Input.GetSnapshot().NumEvents == 0);
+    });
+}
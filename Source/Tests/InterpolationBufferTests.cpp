@@ -0,0 +1,168 @@
+﻿#include "TestCases.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "InterpolationBuffer.h"
+#include "UObject.h"
+
+
+namespace
+{
+    /** 256개씩 자르는 블록을 두 번 넘고, 4의 배수도 아닌 수 */
+    constexpr uint32 NumObjects = 256 * 2 + 37;
+
+    struct FStatePair
+    {
+        std::vector<FVector> PreviousLocations;
+        std::vector<FVector> PreviousRotations;
+        std::vector<FVector> CurrentLocations;
+        std::vector<FVector> CurrentRotations;
+    };
+
+    FVector RandomVector(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float> Distribution(-100.0f, 100.0f);
+        return FVector(Distribution(Random), Distribution(Random), Distribution(Random));
+    }
+
+    FStatePair MakeStates(FInterpolationBuffer& Buffer, uint32 Num)
+    {
+        std::mt19937 Random(Num);
+        FStatePair States;
+        Buffer.Resize(Num);
+        for (uint32 i = 0; i < Num; ++i)
+        {
+            States.PreviousLocations.push_back(RandomVector(Random));
+            States.PreviousRotations.push_back(RandomVector(Random));
+            States.CurrentLocations.push_back(RandomVector(Random));
+            States.CurrentRotations.push_back(RandomVector(Random));
+            Buffer.SetPrevious(i, States.PreviousLocations[i], States.PreviousRotations[i]);
+            Buffer.SetCurrent(i, States.CurrentLocations[i], States.CurrentRotations[i]);
+        }
+        return States;
+    }
+
+    /** 보간이 건드리지 않아야 하는 값으로 채움, 하나 더 만들어서 배열 끝을 넘어 쓰는지도 봄 */
+    std::vector<FObjectRenderState> MakeOutStates(uint32 Num)
+    {
+        std::vector<FObjectRenderState> OutStates(Num + 1);
+        for (uint32 i = 0; i <= Num; ++i)
+        {
+            OutStates[i].Location = FVector(-1.0f, -2.0f, -3.0f);
+            OutStates[i].Rotation = FVector(-4.0f, -5.0f, -6.0f);
+            OutStates[i].Radius = 0.5f + static_cast<float>(i);
+            OutStates[i].UUID = 1000 + i;
+            OutStates[i].PrimitiveType = static_cast<EPrimitiveType>(i % static_cast<uint32>(EPrimitiveType::EPT_Max));
+        }
+        return OutStates;
+    }
+
+    /** 두 float의 정확한 중간값 (범위가 좁아서 double 합은 반올림 없음) */
+    float Midpoint(float A, float B)
+    {
+        return static_cast<float>((static_cast<double>(A) + static_cast<double>(B)) * 0.5);
+    }
+
+    FVector Midpoint(const FVector& A, const FVector& B)
+    {
+        return FVector(Midpoint(A.X, B.X), Midpoint(A.Y, B.Y), Midpoint(A.Z, B.Z));
+    }
+
+    /** 다르면 처음 한 번만 기록하고 false */
+    bool CheckStates(const std::vector<FObjectRenderState>& OutStates, const std::vector<FVector>& Locations, const std::vector<FVector>& Rotations, float Alpha)
+    {
+        const uint32 Num = static_cast<uint32>(Locations.size());
+        for (uint32 i = 0; i <= Num; ++i)
+        {
+            const FObjectRenderState& State = OutStates[i];
+            const bool bExtraUntouched = i < Num || (State.Location == FVector(-1.0f, -2.0f, -3.0f) && State.Rotation == FVector(-4.0f, -5.0f, -6.0f));
+            const bool bOthersUntouched = State.Radius == 0.5f + static_cast<float>(i) && State.UUID == 1000 + i
+                && State.PrimitiveType == static_cast<EPrimitiveType>(i % static_cast<uint32>(EPrimitiveType::EPT_Max));
+            const bool bInterpolated = i == Num || (State.Location == Locations[i] && State.Rotation == Rotations[i]);
+            if (!bExtraUntouched || !bOthersUntouched || !bInterpolated)
+            {
+                ReportTestFailure(__FILE__, __LINE__, "Alpha " + std::to_string(Alpha) + ", Num " + std::to_string(Num) + ": object " + std::to_string(i) + " is wrong");
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+void RegisterInterpolationBufferTests(FTestRunner& Runner)
+{
+    Runner.Register("InterpolationBuffer.EndpointsAndMidpoint", []
+    {
+        for (const uint32 Num : { 0u, 1u, 3u, 255u, 257u, NumObjects })
+        {
+            FInterpolationBuffer Buffer;
+            const FStatePair States = MakeStates(Buffer, Num);
+            TEST_CHECK(Buffer.Num() == Num);
+
+            // 0과 1에서는 저장한 값이 그대로 나와야 함
+            std::vector<FObjectRenderState> OutStates = MakeOutStates(Num);
+            Buffer.Interpolate(0.0f, OutStates.data());
+            if (!TEST_CHECK(CheckStates(OutStates, States.PreviousLocations, States.PreviousRotations, 0.0f)))
+            {
+                return;
+            }
+
+            OutStates = MakeOutStates(Num);
+            Buffer.Interpolate(1.0f, OutStates.data());
+            if (!TEST_CHECK(CheckStates(OutStates, States.CurrentLocations, States.CurrentRotations, 1.0f)))
+            {
+                return;
+            }
+
+            std::vector<FVector> MidLocations;
+            std::vector<FVector> MidRotations;
+            for (uint32 i = 0; i < Num; ++i)
+            {
+                MidLocations.push_back(Midpoint(States.PreviousLocations[i], States.CurrentLocations[i]));
+                MidRotations.push_back(Midpoint(States.PreviousRotations[i], States.CurrentRotations[i]));
+            }
+            OutStates = MakeOutStates(Num);
+            Buffer.Interpolate(0.5f, OutStates.data());
+            if (!TEST_CHECK(CheckStates(OutStates, MidLocations, MidRotations, 0.5f)))
+            {
+                return;
+            }
+        }
+    });
+
+    Runner.Register("InterpolationBuffer.LerpMatchesScalar", []
+    {
+        // SIMD 4개 묶음과 남는 원소가 같은 식을 쓰는지
+        std::mt19937 Random(7);
+        std::uniform_real_distribution<float> Distribution(-100.0f, 100.0f);
+        for (uint32 Num = 0; Num <= 13; ++Num)
+        {
+            std::vector<float> A(Num);
+            std::vector<float> B(Num);
+            for (uint32 i = 0; i < Num; ++i)
+            {
+                A[i] = Distribution(Random);
+                B[i] = Distribution(Random);
+            }
+
+            for (const float Alpha : { 0.0f, 0.25f, 0.7f, 1.0f })
+            {
+                std::vector<float> Out(Num + 1, -1.0f);
+                FInterpolationBuffer::Lerp(A.data(), B.data(), Alpha, Out.data(), Num);
+                bool bMatches = Out[Num] == -1.0f;
+                for (uint32 i = 0; i < Num; ++i)
+                {
+                    bMatches = bMatches && Out[i] == A[i] * (1.0f - Alpha) + B[i] * Alpha;
+                }
+                if (!bMatches)
+                {
+                    ReportTestFailure(__FILE__, __LINE__, "Num " + std::to_string(Num) + ", Alpha " + std::to_string(Alpha));
+                    return;
+                }
+            }
+        }
+    });
+}
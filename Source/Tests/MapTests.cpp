@@ -0,0 +1,332 @@
+﻿#include "TestCases.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Container/Map.h"
+
+
+namespace
+{
+    /** TMap이 홈 슬롯을 고를 때 곱하는 수의 곱셈 역원, 해시 값으로 홈 슬롯을 정할 수 있게 함 */
+    constexpr uint64 InverseGolden = []
+    {
+        constexpr uint64 Golden = 0x9E3779B97F4A7C15ull;
+        uint64 Inverse = Golden;
+        for (int32 i = 0; i < 5; ++i)
+        {
+            Inverse *= 2 - Golden * Inverse;
+        }
+        return Inverse;
+    }();
+
+    /**
+     * 홈 슬롯을 직접 고를 수 있는 키
+     * Product의 위쪽 log2(Capacity) 비트가 곧 홈 슬롯, 같은 Product에 Id만 다른 키끼리 충돌한다.
+     */
+    struct FProbeKey
+    {
+        uint64 Product = 0;
+        int32 Id = 0;
+
+        bool operator==(const FProbeKey&) const = default;
+    };
+
+    struct FProbeHash
+    {
+        size_t operator()(const FProbeKey& Key) const { return static_cast<size_t>(Key.Product * InverseGolden); }
+    };
+
+    /** 용량 8 (MinCapacity)에서 Home 슬롯에 들어가는 키 */
+    FProbeKey HomeKey(uint64 Home, int32 Id)
+    {
+        return { Home << 61, Id };
+    }
+
+    /** 살아있는 인스턴스 수를 세는 값, 원소를 옮기면서 새거나 두 번 지우지 않는지 확인 */
+    struct FCounted
+    {
+        static inline int32 NumAlive = 0;
+
+        int32 Value = 0;
+
+        FCounted() { ++NumAlive; }
+        FCounted(int32 InValue) : Value(InValue) { ++NumAlive; }
+        FCounted(const FCounted& Other) : Value(Other.Value) { ++NumAlive; }
+        FCounted(FCounted&& Other) noexcept : Value(Other.Value) { ++NumAlive; }
+        FCounted& operator=(const FCounted&) = default;
+        FCounted& operator=(FCounted&&) noexcept = default;
+        ~FCounted() { --NumAlive; }
+    };
+
+    using FProbeMap = TMap<FProbeKey, FCounted, FProbeHash>;
+
+    /** 반복 순서 = 슬롯 순서대로 Id를 모음 */
+    std::vector<int32> IdsInSlotOrder(const FProbeMap& Map)
+    {
+        std::vector<int32> Ids;
+        for (const auto& Pair : Map)
+        {
+            Ids.push_back(Pair.Key.Id);
+        }
+        return Ids;
+    }
+}
+
+void RegisterMapTests(FTestRunner& Runner)
+{
+    Runner.Register("Map.BackwardShiftAcrossWrap", []
+    {
+        FCounted::NumAlive = 0;
+        {
+            FProbeMap Map;
+            const FProbeKey A = HomeKey(6, 0);
+            const FProbeKey B = HomeKey(6, 1);
+            const FProbeKey C = HomeKey(6, 2);
+            const FProbeKey D = HomeKey(7, 3);
+            const FProbeKey E = HomeKey(0, 4);
+
+            // A, B는 6, 7번 슬롯, C는 0번으로 넘어가고 D, E는 그 뒤로 밀림
+            Map.Add(A, FCounted(0));
+            Map.Add(B, FCounted(1));
+            Map.Add(C, FCounted(2));
+            Map.Add(D, FCounted(3));
+            Map.Add(E, FCounted(4));
+            TEST_CHECK(Map.Len() == 8);
+            TEST_CHECK((IdsInSlotOrder(Map) == std::vector<int32>{ 2, 3, 4, 0, 1 }));
+
+            // A를 지우면 B, C가 7 -> 6, 0 -> 7로, D, E가 1 -> 0, 2 -> 1로 당겨짐
+            TEST_CHECK(Map.Remove(A) == 1);
+            TEST_CHECK((IdsInSlotOrder(Map) == std::vector<int32>{ 3, 4, 1, 2 }));
+            TEST_CHECK(!Map.Contains(A));
+            for (const FProbeKey& Key : { B, C, D, E })
+            {
+                const FCounted* Value = Map.Find(Key);
+                TEST_CHECK(Value && Value->Value == Key.Id);
+            }
+
+            // 0번 슬롯의 D를 지우면 자기 홈이 아닌 E만 당겨짐
+            TEST_CHECK(Map.Remove(D) == 1);
+            TEST_CHECK((IdsInSlotOrder(Map) == std::vector<int32>{ 4, 1, 2 }));
+
+            // 홈이 7인 새 키는 7번에서 밀려나 홈에 있는 E의 자리를 차지함
+            const FProbeKey F = HomeKey(7, 5);
+            Map.Add(F, FCounted(5));
+            TEST_CHECK((IdsInSlotOrder(Map) == std::vector<int32>{ 5, 4, 1, 2 }));
+
+            TEST_CHECK(Map.Remove(D) == 0);
+            TEST_CHECK(Map.Num() == 4);
+            TEST_CHECK(FCounted::NumAlive == 4);
+        }
+        TEST_CHECK(FCounted::NumAlive == 0);
+    });
+
+    Runner.Register("Map.MaxDistanceOverflowRehashes", []
+    {
+        FCounted::NumAlive = 0;
+        {
+            // 부하율로는 늘어나지 않을 만큼 잡아 둠 (2048 슬롯)
+            FProbeMap Map;
+            Map.Reserve(1000);
+            TEST_CHECK(Map.Len() == 2048);
+
+            // 2048 슬롯에서는 모두 0번이 홈, 4096 슬롯에서는 Id의 홀짝에 따라 0번과 1번으로 나뉨
+            auto MakeKey = [](int32 Id) { return FProbeKey{ static_cast<uint64>(Id & 1) << 52, Id }; };
+
+            // 탐사 거리 255까지는 그대로 들어감
+            for (int32 Id = 0; Id < 255; ++Id)
+            {
+                Map.Add(MakeKey(Id), FCounted(Id));
+            }
+            TEST_CHECK(Map.Len() == 2048);
+
+            // 256번째는 거리가 넘치므로 용량을 늘려서 다시 배치
+            Map.Add(MakeKey(255), FCounted(255));
+            TEST_CHECK(Map.Len() == 4096);
+            TEST_CHECK(Map.Num() == 256);
+
+            bool bAllFound = true;
+            for (int32 Id = 0; Id < 256; ++Id)
+            {
+                const FCounted* Value = Map.Find(MakeKey(Id));
+                bAllFound = bAllFound && Value && Value->Value == Id;
+            }
+            TEST_CHECK(bAllFound);
+            TEST_CHECK(FCounted::NumAlive == 256);
+        }
+        TEST_CHECK(FCounted::NumAlive == 0);
+    });
+
+    Runner.Register("Map.GrowsAtSevenEighthsLoad", []
+    {
+        TMap<int32, int32> Map;
+        TEST_CHECK(Map.Len() == 0);
+
+        // 용량 C에는 C - C / 8개까지 들어감
+        size_t ExpectedCapacity = 8;
+        for (int32 Key = 0; Key < 1000; ++Key)
+        {
+            if (static_cast<size_t>(Key) + 1 > ExpectedCapacity - ExpectedCapacity / 8)
+            {
+                ExpectedCapacity *= 2;
+            }
+            Map.Add(Key, Key * 2);
+            if (Map.Len() != ExpectedCapacity)
+            {
+                ReportTestFailure(__FILE__, __LINE__, "Num " + std::to_string(Map.Num()) + ": Len " + std::to_string(Map.Len()) + ", expected " + std::to_string(ExpectedCapacity));
+                break;
+            }
+        }
+
+        TEST_CHECK(Map.Num() == 1000);
+        bool bAllFound = true;
+        for (int32 Key = 0; Key < 1000; ++Key)
+        {
+            const int32* Value = Map.Find(Key);
+            bAllFound = bAllFound && Value && *Value == Key * 2;
+        }
+        TEST_CHECK(bAllFound);
+    });
+
+    Runner.Register("Map.CopyAndMoveAssignment", []
+    {
+        TMap<int32, std::string> Source;
+        for (int32 Key = 0; Key < 20; ++Key)
+        {
+            Source.Add(Key, "Value " + std::to_string(Key));
+        }
+
+        // 원소가 있던 맵에 복사해도 이전 원소는 남지 않음
+        TMap<int32, std::string> Copy;
+        Copy.Add(100, "Old");
+        Copy = Source;
+        TEST_CHECK(Copy.Num() == 20);
+        TEST_CHECK(!Copy.Contains(100));
+        TEST_CHECK(Copy.Find(7) && *Copy.Find(7) == "Value 7");
+
+        // 복사본은 따로 바뀜
+        Copy.Add(7, "Changed");
+        Copy.Remove(3);
+        TEST_CHECK(*Source.Find(7) == "Value 7");
+        TEST_CHECK(Source.Contains(3));
+
+        const TMap<int32, std::string>& SameMap = Copy;
+        Copy = SameMap;
+        TEST_CHECK(Copy.Num() == 19);
+        TEST_CHECK(*Copy.Find(7) == "Changed");
+
+        // 옮긴 뒤의 원본은 비어 있고 다시 쓸 수 있음
+        TMap<int32, std::string> Moved;
+        Moved.Add(200, "Old");
+        Moved = std::move(Copy);
+        TEST_CHECK(Moved.Num() == 19);
+        TEST_CHECK(!Moved.Contains(200));
+        TEST_CHECK(*Moved.Find(7) == "Changed");
+        TEST_CHECK(Copy.IsEmpty() && Copy.Len() == 0);
+        TEST_CHECK(Copy.Find(7) == nullptr);
+
+        Copy.Add(1, "Reused");
+        TEST_CHECK(Copy.Num() == 1 && *Copy.Find(1) == "Reused");
+
+        // 빈 맵을 복사하면 빈 맵
+        TMap<int32, std::string> Empty;
+        Moved = Empty;
+        TEST_CHECK(Moved.IsEmpty());
+    });
+
+    Runner.Register("Map.AddOverwritesExistingKey", []
+    {
+        TMap<std::string, int32> Map;
+        int32& First = Map.Add("Key", 1);
+        TEST_CHECK(First == 1);
+
+        int32& Second = Map.Add("Key", 2);
+        TEST_CHECK(Map.Num() == 1);
+        TEST_CHECK(Second == 2);
+        TEST_CHECK(*Map.Find("Key") == 2);
+
+        // 돌려준 참조가 저장된 값을 가리킴
+        Second = 3;
+        TEST_CHECK(*Map.Find("Key") == 3);
+
+        Map.Emplace(std::string("Key"), 4);
+        TEST_CHECK(Map.Num() == 1 && *Map.Find("Key") == 4);
+
+        // FindOrAdd는 있는 값을 그대로 두고, 없으면 기본값으로 추가
+        TEST_CHECK(Map.FindOrAdd("Key") == 4);
+        TEST_CHECK(Map.FindOrAdd("Other") == 0);
+        TEST_CHECK(Map.Num() == 2);
+    });
+
+    Runner.Register("Map.IteratorSkipsEmptySlots", []
+    {
+        TMap<int32, int32> Empty;
+        TEST_CHECK(Empty.begin() == Empty.end());
+
+        // 마지막 슬롯 하나만 찬 맵
+        FProbeMap Last;
+        Last.Add(HomeKey(7, 1), FCounted(1));
+        TEST_CHECK((IdsInSlotOrder(Last) == std::vector<int32>{ 1 }));
+
+        // 지운 원소는 빼고, 남은 원소는 한 번씩만 나옴
+        TMap<int32, int32> Map;
+        for (int32 Key = 0; Key < 100; ++Key)
+        {
+            Map.Add(Key, Key);
+        }
+        for (int32 Key = 0; Key < 100; Key += 3)
+        {
+            Map.Remove(Key);
+        }
+
+        std::vector<int32> Seen(100, 0);
+        for (const auto& Pair : Map)
+        {
+            TEST_CHECK(Pair.Key == Pair.Value);
+            ++Seen[Pair.Key];
+        }
+        bool bEachOnce = true;
+        for (int32 Key = 0; Key < 100; ++Key)
+        {
+            bEachOnce = bEachOnce && Seen[Key] == (Key % 3 == 0 ? 0 : 1);
+        }
+        TEST_CHECK(bEachOnce);
+
+        // 반복자로 값을 바꿀 수 있음
+        for (auto& Pair : Map)
+        {
+            Pair.Value = -Pair.Value;
+        }
+        TEST_CHECK(*Map.Find(1) == -1);
+    });
+
+    Runner.Register("Map.TransparentStringLookup", []
+    {
+        TMap<std::string, int32> Map;
+        Map.Add("Alpha", 1);
+        Map.Add("Beta", 2);
+        Map.Add("Gamma", 3);
+
+        const std::string Buffer = "xxBetaxx";
+        const std::string_view View = std::string_view(Buffer).substr(2, 4);
+        const char* Literal = "Gamma";
+
+        TEST_CHECK(Map.Find(View) && *Map.Find(View) == 2);
+        TEST_CHECK(Map.Find(Literal) && *Map.Find(Literal) == 3);
+        TEST_CHECK(Map.Contains(std::string_view("Alpha")));
+        TEST_CHECK(Map.Contains("Alpha"));
+        TEST_CHECK(!Map.Contains(std::string_view("Alph")));
+        TEST_CHECK(!Map.Contains("Delta"));
+
+        const TMap<std::string, int32>& ConstMap = Map;
+        TEST_CHECK(ConstMap.Find(View) && *ConstMap.Find(View) == 2);
+
+        TEST_CHECK(Map.Remove(View) == 1);
+        TEST_CHECK(Map.Remove(Literal) == 1);
+        TEST_CHECK(Map.Remove("Gamma") == 0);
+        TEST_CHECK(Map.Num() == 1);
+        TEST_CHECK(Map.Contains(std::string("Alpha")));
+    });
+}
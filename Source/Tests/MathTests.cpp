@@ -0,0 +1,138 @@
+﻿#include "TestCases.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Transform.h"
+
+
+namespace
+{
+    constexpr float Pi = 3.14159265358979f;
+
+    void CheckMatrixNear(const FMatrix& Actual, const float (&Expected)[4][4], float Tolerance, const char* File, int Line)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            for (int Column = 0; Column < 4; ++Column)
+            {
+                const std::string Element = "M[" + std::to_string(Row) + "][" + std::to_string(Column) + "]";
+                CheckNear(Actual.M[Row][Column], Expected[Row][Column], Tolerance, File, Line, Element.c_str());
+            }
+        }
+    }
+
+    constexpr float IdentityValues[4][4] = {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f },
+    };
+
+    FVector RandomVector(std::mt19937& Random, float Min, float Max)
+    {
+        std::uniform_real_distribution<float> Distribution(Min, Max);
+        return FVector(Distribution(Random), Distribution(Random), Distribution(Random));
+    }
+}
+
+void RegisterMathTests(FTestRunner& Runner)
+{
+    // 기대값은 XMMatrixRotationRollPitchYaw(0.3f, -1.2f, 2.0f)의 결과
+    Runner.Register("Math.MakeRotationMatchesXMMatrix", []
+    {
+        constexpr float Expected[4][4] = {
+            { -0.4012476f, 0.8686850f, -0.2904939f, 0.0000000f },
+            { -0.2148690f, -0.3975603f, -0.8920634f, 0.0000000f },
+            { -0.8904109f, -0.2955202f, 0.3461736f, 0.0000000f },
+            { 0.0000000f, 0.0000000f, 0.0000000f, 1.0000000f },
+        };
+        CheckMatrixNear(FMatrix::MakeRotation(FVector(0.3f, -1.2f, 2.0f)), Expected, 1.0e-6f, __FILE__, __LINE__);
+    });
+
+    // XMMatrixLookAtLH(Eye(1, 2, -5), Target(0.5, -1, 3), Up(0, 1, 0))
+    Runner.Register("Math.LookAtLHMatchesXMMatrix", []
+    {
+        constexpr float Expected[4][4] = {
+            { 0.9980526f, -0.0218651f, -0.0584206f, 0.0000000f },
+            { 0.0000000f, 0.9365538f, -0.3505237f, 0.0000000f },
+            { 0.0623783f, 0.3498411f, 0.9347300f, 0.0000000f },
+            { -0.6861611f, -0.1020370f, 5.4331180f, 1.0000000f },
+        };
+        const FMatrix View = FMatrix::LookAtLH(FVector(1.0f, 2.0f, -5.0f), FVector(0.5f, -1.0f, 3.0f), FVector(0.0f, 1.0f, 0.0f));
+        CheckMatrixNear(View, Expected, 2.0e-6f, __FILE__, __LINE__);
+    });
+
+    // XMMatrixPerspectiveFovLH(60도, 16 / 9, 0.1, 100)
+    Runner.Register("Math.PerspectiveFovLHMatchesXMMatrix", []
+    {
+        constexpr float Expected[4][4] = {
+            { 0.9742786f, 0.0000000f, 0.0000000f, 0.0000000f },
+            { 0.0000000f, 1.7320508f, 0.0000000f, 0.0000000f },
+            { 0.0000000f, 0.0000000f, 1.0010010f, 1.0000000f },
+            { 0.0000000f, 0.0000000f, -0.1001001f, 0.0000000f },
+        };
+        CheckMatrixNear(FMatrix::PerspectiveFovLH(Pi / 3.0f, 16.0f / 9.0f, 0.1f, 100.0f), Expected, 1.0e-6f, __FILE__, __LINE__);
+    });
+
+    // 이동 행의 오차는 이동량에 비례하므로 씬 크기(벽 ±20) 안쪽의 이동만 씀
+    Runner.Register("Math.InverseTimesMatrixIsIdentity", []
+    {
+        std::mt19937 Random(1);
+        for (int i = 0; i < 200; ++i)
+        {
+            const FTransform Transform(RandomVector(Random, -10.0f, 10.0f), RandomVector(Random, -Pi, Pi), RandomVector(Random, 0.2f, 5.0f));
+            const FMatrix Matrix = Transform.ToMatrix();
+
+            float Determinant = 0.0f;
+            const FMatrix Inverse = Matrix.Inverse(&Determinant);
+            TEST_CHECK(Determinant != 0.0f);
+            CheckMatrixNear(Matrix * Inverse, IdentityValues, 1.0e-5f, __FILE__, __LINE__);
+            CheckMatrixNear(Inverse * Matrix, IdentityValues, 1.0e-5f, __FILE__, __LINE__);
+        }
+
+        // 뷰 * 투영도 역행렬이 있음 (화면 좌표를 월드로 되돌릴 때 씀), Far / Near가 커서 오차도 더 큼
+        const FMatrix ViewProjection = FMatrix::LookAtLH(FVector(3.0f, 4.0f, -10.0f), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f))
+            * FMatrix::PerspectiveFovLH(Pi / 4.0f, 1.0f, 0.1f, 100.0f);
+        CheckMatrixNear(ViewProjection * ViewProjection.Inverse(), IdentityValues, 1.0e-4f, __FILE__, __LINE__);
+
+        float Determinant = 1.0f;
+        FMatrix::MakeScale(FVector(1.0f, 0.0f, 1.0f)).Inverse(&Determinant);
+        TEST_CHECK(Determinant == 0.0f);
+    });
+
+    Runner.Register("Math.TransformPositionsMatchesTransformPosition", []
+    {
+        std::mt19937 Random(2);
+        for (const size_t Count : { size_t(0), size_t(1), size_t(3), size_t(4), size_t(1003) })
+        {
+            const FTransform Transform(RandomVector(Random, -10.0f, 10.0f), RandomVector(Random, -Pi, Pi), RandomVector(Random, 0.5f, 2.0f));
+
+            std::vector<FVector> Positions(Count);
+            for (FVector& Position : Positions)
+            {
+                Position = RandomVector(Random, -20.0f, 20.0f);
+            }
+
+            std::vector<FVector> Transformed(Count);
+            Transform.TransformPositions(Positions.data(), Transformed.data(), Count);
+
+            // 같은 배열에 덮어써도 결과가 같아야 함
+            std::vector<FVector> InPlace = Positions;
+            Transform.TransformPositions(InPlace.data(), InPlace.data(), Count);
+
+            for (size_t i = 0; i < Count; ++i)
+            {
+                const FVector Expected = Transform.TransformPosition(Positions[i]);
+                TEST_CHECK_NEAR(Transformed[i].X, Expected.X, 1.0e-4);
+                TEST_CHECK_NEAR(Transformed[i].Y, Expected.Y, 1.0e-4);
+                TEST_CHECK_NEAR(Transformed[i].Z, Expected.Z, 1.0e-4);
+                TEST_CHECK(InPlace[i] == Transformed[i]);
+            }
+        }
+    });
+}
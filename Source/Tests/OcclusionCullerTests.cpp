@@ -0,0 +1,147 @@
+﻿#include "TestCases.h"
+
+#include <cmath>
+#include <random>
+
+#include "Test.h"
+#include "OcclusionCuller.h"
+
+
+namespace
+{
+    /**
+     * 카메라에서 볼 때 Occludee가 Occluder의 실루엣 원뿔 안에 완전히 들어가고 뒤에 있는지
+     * 원뿔 사이 각도 + Occludee 반각 <= Occluder 반각
+     */
+    bool IsHiddenAnalytic(const FOcclusionSphere& Occluder, const FOcclusionSphere& Occludee)
+    {
+        const float DistA = std::sqrt(Occluder.X * Occluder.X + Occluder.Y * Occluder.Y + Occluder.Z * Occluder.Z);
+        const float DistB = std::sqrt(Occludee.X * Occludee.X + Occludee.Y * Occludee.Y + Occludee.Z * Occludee.Z);
+        if (DistB - Occludee.Radius < DistA + Occluder.OccluderRadius)
+        {
+            return false;
+        }
+
+        const float CosAngle = (Occluder.X * Occludee.X + Occluder.Y * Occludee.Y + Occluder.Z * Occludee.Z) / (DistA * DistB);
+        const float Angle = std::acos(std::min(CosAngle, 1.0f));
+        return Angle + std::asin(Occludee.Radius / DistB) <= std::asin(Occluder.OccluderRadius / DistA);
+    }
+
+    FOcclusionSphere MakeSphere(float X, float Y, float Z, float Radius, float OccluderRadius = 0.0f)
+    {
+        return { X, Y, Z, Radius, OccluderRadius };
+    }
+}
+
+void RegisterOcclusionCullerTests(FTestRunner& Runner)
+{
+    Runner.Register("OcclusionCuller.HidesSmallerSphereBehind", []
+    {
+        FOcclusionCuller Culler;
+        const FOcclusionSphere Spheres[] =
+        {
+            MakeSphere(0.0f, 0.0f, 10.0f, 3.0f, 3.0f),
+            MakeSphere(0.0f, 0.0f, 30.0f, 1.0f),
+            MakeSphere(2.0f, -1.0f, 50.0f, 2.0f),
+        };
+        uint8 Visible[3];
+        const FOcclusionStats Stats = Culler.Cull(Spheres, 3, Visible);
+
+        TEST_CHECK(Stats.NumOccluders == 1);
+        TEST_CHECK(Visible[0] == 1);
+        TEST_CHECK(Visible[1] == 0);
+        TEST_CHECK(Visible[2] == 0);
+        TEST_CHECK(Stats.NumCulled == 2);
+    });
+
+    Runner.Register("OcclusionCuller.PartialOverlapStaysVisible", []
+    {
+        FOcclusionCuller Culler;
+
+        // 오클루더 실루엣은 Z=30에서 반지름 약 9, 그 경계에 걸친 구와 밖의 구, 앞에 있는 구
+        const FOcclusionSphere Spheres[] =
+        {
+            MakeSphere(0.0f, 0.0f, 10.0f, 3.0f, 3.0f),
+            MakeSphere(9.0f, 0.0f, 30.0f, 1.0f),
+            MakeSphere(0.0f, -9.5f, 30.0f, 1.0f),
+            MakeSphere(20.0f, 0.0f, 30.0f, 1.0f),
+            MakeSphere(0.0f, 0.0f, 5.0f, 0.5f),
+        };
+        uint8 Visible[5];
+        Culler.Cull(Spheres, 5, Visible);
+
+        TEST_CHECK(Visible[1] == 1);
+        TEST_CHECK(Visible[2] == 1);
+        TEST_CHECK(Visible[3] == 1);
+        TEST_CHECK(Visible[4] == 1);
+    });
+
+    Runner.Register("OcclusionCuller.NearPlaneCrossingStaysVisible", []
+    {
+        FOcclusionCuller Culler;
+        Culler.SetProjection(3.14159265f / 4.0f, 1.0f, 0.1f);
+
+        // 중심은 오클루더 뒤지만 앞쪽이 근평면을 넘어옴
+        const FOcclusionSphere Spheres[] =
+        {
+            MakeSphere(0.0f, 0.0f, 10.0f, 3.0f, 3.0f),
+            MakeSphere(0.0f, 0.0f, 12.0f, 11.95f),
+            MakeSphere(0.0f, 0.0f, 0.05f, 0.2f),
+        };
+        uint8 Visible[3];
+        Culler.Cull(Spheres, 3, Visible);
+
+        TEST_CHECK(Visible[1] == 1);
+        TEST_CHECK(Visible[2] == 1);
+    });
+
+    // 해상도와 위치를 바꿔가며, 컬링된 구는 모두 실제로 가려져 있어야 함 (실루엣 가장자리 포함)
+    Runner.Register("OcclusionCuller.CullingIsConservative", []
+    {
+        std::mt19937 Random(42);
+        std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+        constexpr uint32 NumOccludees = 256;
+        FOcclusionSphere Spheres[NumOccludees + 1];
+        uint8 Visible[NumOccludees + 1];
+
+        uint32 NumCulled = 0;
+        uint32 NumWrong = 0;
+        for (const int Resolution : { 32, 64, 160, 256 })
+        {
+            FOcclusionCuller Culler;
+            Culler.SetResolution(Resolution, Resolution * 3 / 4);
+            Culler.SetProjection(3.14159265f / 3.0f, 4.0f / 3.0f, 0.1f);
+
+            for (uint32 Round = 0; Round < 20; ++Round)
+            {
+                const float OccluderRadius = 1.0f + 2.0f * (Unit(Random) + 1.0f);
+                Spheres[0] = MakeSphere(Unit(Random) * 2.0f, Unit(Random) * 2.0f, 10.0f, OccluderRadius, OccluderRadius);
+
+                // 오클루더 실루엣 경계 근처에 몰리도록 배치
+                for (uint32 i = 1; i <= NumOccludees; ++i)
+                {
+                    const float Z = 20.0f + 10.0f * (Unit(Random) + 1.0f);
+                    const float Reach = OccluderRadius / 10.0f * Z;
+                    Spheres[i] = MakeSphere(
+                        Spheres[0].X / 10.0f * Z + Unit(Random) * Reach,
+                        Spheres[0].Y / 10.0f * Z + Unit(Random) * Reach,
+                        Z, 0.05f + 0.3f * (Unit(Random) + 1.0f));
+                }
+
+                Culler.Cull(Spheres, NumOccludees + 1, Visible);
+                for (uint32 i = 1; i <= NumOccludees; ++i)
+                {
+                    if (Visible[i] == 0)
+                    {
+                        ++NumCulled;
+                        NumWrong += IsHiddenAnalytic(Spheres[0], Spheres[i]) ? 0 : 1;
+                    }
+                }
+            }
+        }
+
+        TEST_CHECK(NumWrong == 0);
+        TEST_CHECK(NumCulled > 0);
+    });
+}
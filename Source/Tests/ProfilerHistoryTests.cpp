@@ -0,0 +1,235 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Profiler/ProfilerHistory.h"
+
+
+namespace
+{
+    /** 1틱 = 1ms로 두면 기대값을 틱 수 그대로 쓸 수 있음 */
+    constexpr double SecondsPerTick = 0.001;
+
+    /** 프레임 하나가 차지하는 틱 구간, 프레임 스코프 자체는 그 앞부분만 씀 (0번 프레임은 이 위치에서 시작) */
+    constexpr uint64 FrameSpacing = 1000;
+
+    /**
+     * FrameIndex 번째 프레임의 이벤트
+     * 메인 스레드: Frame(10 + FrameIndex) > Update(2 + 2), Render(3) > Update 안에 Inner(1)
+     * 워커 스레드: 짝수 프레임에만 Task(3)
+     */
+    void AppendFrameEvents(uint32 FrameIndex, std::vector<FProfileEvent>& OutEvents)
+    {
+        const uint64 Start = (FrameIndex + 1) * FrameSpacing;
+        OutEvents.push_back({ "Frame", Start, Start + 10 + FrameIndex, 0, 0 });
+        OutEvents.push_back({ "Update", Start + 1, Start + 3, 0, 1 });
+        OutEvents.push_back({ "Inner", Start + 1, Start + 2, 0, 2 });
+        OutEvents.push_back({ "Update", Start + 3, Start + 5, 0, 1 });
+        OutEvents.push_back({ "Render", Start + 5, Start + 8, 0, 1 });
+        if (FrameIndex % 2 == 0)
+        {
+            OutEvents.push_back({ "Task", Start + 2, Start + 5, 1, 0 });
+        }
+    }
+
+    /** [FirstFrame, FirstFrame + NumFrames) 프레임을 섞어서 한 번에 넣음 */
+    void AddFrames(FProfilerHistory& History, uint32 FirstFrame, uint32 NumFrames, std::mt19937& Random)
+    {
+        std::vector<FProfileEvent> Events;
+        for (uint32 FrameIndex = FirstFrame; FrameIndex < FirstFrame + NumFrames; ++FrameIndex)
+        {
+            AppendFrameEvents(FrameIndex, Events);
+        }
+        std::shuffle(Events.begin(), Events.end(), Random);
+        History.AddEvents(Events);
+    }
+
+    const FProfileScopeTime* FindScopeTime(const std::vector<FProfileScopeTime>& ScopeTimes, const char* Name)
+    {
+        for (const FProfileScopeTime& ScopeTime : ScopeTimes)
+        {
+            if (std::strcmp(ScopeTime.Name, Name) == 0)
+            {
+                return &ScopeTime;
+            }
+        }
+        return nullptr;
+    }
+
+    const FProfileScopeStats* FindScopeStats(const FProfilerHistory& History, const char* Name)
+    {
+        for (const FProfileScopeStats& Stats : History.GetScopeStats())
+        {
+            if (std::strcmp(Stats.Name, Name) == 0)
+            {
+                return &Stats;
+            }
+        }
+        return nullptr;
+    }
+}
+
+void RegisterProfilerHistoryTests(FTestRunner& Runner)
+{
+    Runner.Register("ProfilerHistory.SplitsFramesOnFrameScope", []
+    {
+        std::mt19937 Random(7);
+        FProfilerHistory History(SecondsPerTick);
+
+        // 첫 프레임보다 앞선 이벤트는 버림
+        History.AddEvents({ { "Startup", 0, 10, 0, 0 } });
+
+        // 다음 프레임 스코프가 들어와야 확정되므로 마지막 하나는 대기 중
+        AddFrames(History, 0, 1, Random);
+        TEST_CHECK(History.NumFrames() == 0);
+        AddFrames(History, 1, 3, Random);
+        TEST_CHECK(History.NumFrames() == 3);
+
+        for (uint32 FrameIndex = 0; FrameIndex < History.NumFrames(); ++FrameIndex)
+        {
+            const FProfileFrame& Frame = History.GetFrame(FrameIndex);
+            TEST_CHECK(Frame.StartTicks == (FrameIndex + 1) * FrameSpacing);
+            TEST_CHECK_NEAR(Frame.Milliseconds, 10.0 + FrameIndex, 1.0e-9);
+            TEST_CHECK(Frame.ThreadIndex == 0);
+            TEST_CHECK(Frame.Events.size() == (FrameIndex % 2 == 0 ? 6u : 5u));
+            TEST_CHECK(FindScopeTime(Frame.Totals, "Startup") == nullptr);
+
+            // (스레드, 시작 시각, 깊이) 순
+            TEST_CHECK(std::strcmp(Frame.Events.front().Name, "Frame") == 0);
+            for (size_t i = 1; i < Frame.Events.size(); ++i)
+            {
+                const FProfileEvent& A = Frame.Events[i - 1];
+                const FProfileEvent& B = Frame.Events[i];
+                TEST_CHECK(A.ThreadIndex < B.ThreadIndex || (A.ThreadIndex == B.ThreadIndex && A.StartTicks <= B.StartTicks));
+            }
+        }
+    });
+
+    Runner.Register("ProfilerHistory.BreakdownAndTotals", []
+    {
+        std::mt19937 Random(11);
+        FProfilerHistory History(SecondsPerTick);
+        AddFrames(History, 0, 3, Random);
+        TEST_CHECK(History.NumFrames() == 2);
+
+        for (uint32 FrameIndex = 0; FrameIndex < 2; ++FrameIndex)
+        {
+            const FProfileFrame& Frame = History.GetFrame(FrameIndex);
+
+            // Breakdown은 프레임 스코프 바로 아래만, 처음 나온 순서
+            TEST_CHECK(Frame.Breakdown.size() == 2);
+            if (Frame.Breakdown.size() == 2)
+            {
+                TEST_CHECK(std::strcmp(Frame.Breakdown[0].Name, "Update") == 0);
+                TEST_CHECK(Frame.Breakdown[0].NumCalls == 2);
+                TEST_CHECK_NEAR(Frame.Breakdown[0].Milliseconds, 4.0, 1.0e-9);
+                TEST_CHECK(std::strcmp(Frame.Breakdown[1].Name, "Render") == 0);
+                TEST_CHECK_NEAR(Frame.Breakdown[1].Milliseconds, 3.0, 1.0e-9);
+            }
+
+            // Totals는 모든 깊이와 스레드
+            const FProfileScopeTime* FrameTotal = FindScopeTime(Frame.Totals, "Frame");
+            const FProfileScopeTime* InnerTotal = FindScopeTime(Frame.Totals, "Inner");
+            const FProfileScopeTime* TaskTotal = FindScopeTime(Frame.Totals, "Task");
+            TEST_CHECK(FrameTotal && FrameTotal->Milliseconds == 10.0 + FrameIndex);
+            TEST_CHECK(InnerTotal && InnerTotal->Milliseconds == 1.0);
+            TEST_CHECK(FrameIndex % 2 == 0 ? TaskTotal && TaskTotal->Milliseconds == 3.0 : TaskTotal == nullptr);
+            TEST_CHECK(FindScopeTime(Frame.Breakdown, "Task") == nullptr);
+        }
+    });
+
+    Runner.Register("ProfilerHistory.ScopeStats", []
+    {
+        std::mt19937 Random(13);
+        FProfilerHistory History(SecondsPerTick);
+
+        // 100 프레임을 여러 묶음으로 나눠 넣음
+        constexpr uint32 NumFrames = 100;
+        for (uint32 FirstFrame = 0; FirstFrame <= NumFrames; FirstFrame += 7)
+        {
+            AddFrames(History, FirstFrame, std::min(7u, NumFrames + 1 - FirstFrame), Random);
+        }
+        TEST_CHECK(History.NumFrames() == NumFrames);
+
+        // Frame: 10..109ms, nearest-rank p99는 99번째 값
+        const FProfileScopeStats* FrameStats = FindScopeStats(History, "Frame");
+        TEST_CHECK(FrameStats != nullptr);
+        if (FrameStats)
+        {
+            TEST_CHECK_NEAR(FrameStats->Min, 10.0, 1.0e-9);
+            TEST_CHECK_NEAR(FrameStats->Max, 109.0, 1.0e-9);
+            TEST_CHECK_NEAR(FrameStats->Average, 59.5, 1.0e-9);
+            TEST_CHECK_NEAR(FrameStats->P99, 108.0, 1.0e-9);
+            TEST_CHECK_NEAR(FrameStats->Last, 109.0, 1.0e-9);
+        }
+
+        // Task가 없던 프레임은 0으로 계산
+        const FProfileScopeStats* TaskStats = FindScopeStats(History, "Task");
+        TEST_CHECK(TaskStats != nullptr);
+        if (TaskStats)
+        {
+            TEST_CHECK_NEAR(TaskStats->Min, 0.0, 1.0e-9);
+            TEST_CHECK_NEAR(TaskStats->Max, 3.0, 1.0e-9);
+            TEST_CHECK_NEAR(TaskStats->Average, 1.5, 1.0e-9);
+            TEST_CHECK_NEAR(TaskStats->Last, 0.0, 1.0e-9);
+        }
+
+        // 평균이 큰 순서
+        const std::vector<FProfileScopeStats>& AllStats = History.GetScopeStats();
+        TEST_CHECK(AllStats.size() == 5);
+        for (size_t i = 1; i < AllStats.size(); ++i)
+        {
+            TEST_CHECK(AllStats[i - 1].Average >= AllStats[i].Average);
+        }
+    });
+
+    Runner.Register("ProfilerHistory.RingBufferKeepsNewest", []
+    {
+        std::mt19937 Random(17);
+        FProfilerHistory History(SecondsPerTick, 8);
+        AddFrames(History, 0, 21, Random);
+
+        TEST_CHECK(History.NumFrames() == 8);
+        for (uint32 i = 0; i < History.NumFrames(); ++i)
+        {
+            TEST_CHECK(History.GetFrame(i).StartTicks == (13 + i) * FrameSpacing);
+        }
+
+        const FProfileScopeStats* FrameStats = FindScopeStats(History, "Frame");
+        TEST_CHECK(FrameStats && FrameStats->Min == 22.0 && FrameStats->Max == 29.0);
+    });
+
+    Runner.Register("ProfilerHistory.Freeze", []
+    {
+        std::mt19937 Random(19);
+        FProfilerHistory History(SecondsPerTick);
+        AddFrames(History, 0, 5, Random);
+        TEST_CHECK(History.NumFrames() == 4);
+
+        const FProfileScopeStats FrozenStats = *FindScopeStats(History, "Frame");
+
+        // 멈춘 동안 들어온 프레임은 버려지고 통계도 그대로
+        History.SetFrozen(true);
+        TEST_CHECK(History.IsFrozen());
+        AddFrames(History, 5, 10, Random);
+        TEST_CHECK(History.NumFrames() == 4);
+        TEST_CHECK(History.GetFrame(3).StartTicks == 4 * FrameSpacing);
+        TEST_CHECK(FindScopeStats(History, "Frame")->Max == FrozenStats.Max);
+        TEST_CHECK(FindScopeStats(History, "Frame")->Average == FrozenStats.Average);
+
+        // 다시 풀면 멈추기 전에 대기 중이던 프레임(4)은 버리고, 새 프레임부터 온전하게 이어짐
+        History.SetFrozen(false);
+        AddFrames(History, 20, 2, Random);
+        TEST_CHECK(History.NumFrames() == 5);
+
+        const FProfileFrame& Resumed = History.GetFrame(4);
+        TEST_CHECK(Resumed.StartTicks == 21 * FrameSpacing);
+        TEST_CHECK(Resumed.Events.size() == 6);
+        TEST_CHECK(Resumed.Breakdown.size() == 2);
+        TEST_CHECK(FindScopeStats(History, "Frame")->Max == 30.0);
+    });
+}
@@ -0,0 +1,340 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Profiler/Profiler.h"
+#include "SimpleJSON/Json.h"
+
+
+namespace
+{
+    /** 호출 스레드가 지금까지 남긴 이벤트를 건너뛰고, 이후에 새로 남긴 이벤트만 모음 */
+    class FThreadEventReader
+    {
+    public:
+        FThreadEventReader()
+        {
+            std::vector<FProfileEvent> Ignored;
+            NextIndex = FProfiler::GetThreadBuffer().ReadFrom(0, Ignored);
+        }
+
+        std::vector<FProfileEvent> ReadNew()
+        {
+            std::vector<FProfileEvent> Events;
+            NextIndex = FProfiler::GetThreadBuffer().ReadFrom(NextIndex, Events);
+            return Events;
+        }
+
+    private:
+        uint64 NextIndex = 0;
+    };
+
+    const FProfileEvent* FindEvent(const std::vector<FProfileEvent>& Events, const char* Name)
+    {
+        for (const FProfileEvent& Event : Events)
+        {
+            if (std::strcmp(Event.Name, Name) == 0)
+            {
+                return &Event;
+            }
+        }
+        return nullptr;
+    }
+
+    bool Contains(const FProfileEvent& Outer, const FProfileEvent& Inner)
+    {
+        return Outer.StartTicks <= Inner.StartTicks && Inner.EndTicks <= Outer.EndTicks;
+    }
+
+    /** 소수점이 있든 없든 숫자로 읽음 */
+    double ToNumber(const json::JSON& Value)
+    {
+        return Value.JSONType() == json::JSON::Class::Integral ? static_cast<double>(Value.ToInt()) : Value.ToFloat();
+    }
+
+    const json::JSON* FindTraceEvent(const json::JSON& Events, const std::string& Name, const std::string& Phase)
+    {
+        for (const json::JSON& Event : Events.ArrayRange())
+        {
+            if (Event.hasKey("name") && Event.at("name").ToString() == Name && Event.at("ph").ToString() == Phase)
+            {
+                return &Event;
+            }
+        }
+        return nullptr;
+    }
+}
+
+void RegisterProfilerTests(FTestRunner& Runner)
+{
+    // PROFILE_SCOPE는 WITH_PROFILER가 0이면 사라지므로 FProfileScope를 직접 씀
+    Runner.Register("Profiler.NestedScopeDepth", []
+    {
+        FProfiler::SetEnabled(true);
+        FThreadEventReader Reader;
+        const uint32 BaseDepth = FProfiler::GetThreadBuffer().Depth;
+
+        {
+            FProfileScope Outer("Profiler.Outer");
+            {
+                FProfileScope Inner("Profiler.Inner");
+                {
+                    FProfileScope Innermost("Profiler.Innermost");
+                    TEST_CHECK(FProfiler::GetThreadBuffer().Depth == BaseDepth + 3);
+                }
+            }
+            FProfileScope Sibling("Profiler.Sibling");
+        }
+        TEST_CHECK(FProfiler::GetThreadBuffer().Depth == BaseDepth);
+
+        // 스코프가 끝난 순서대로 기록됨
+        const std::vector<FProfileEvent> Events = Reader.ReadNew();
+        TEST_CHECK(Events.size() == 4);
+        if (Events.size() != 4)
+        {
+            return;
+        }
+        TEST_CHECK(std::strcmp(Events[0].Name, "Profiler.Innermost") == 0);
+        TEST_CHECK(std::strcmp(Events[1].Name, "Profiler.Inner") == 0);
+        TEST_CHECK(std::strcmp(Events[2].Name, "Profiler.Sibling") == 0);
+        TEST_CHECK(std::strcmp(Events[3].Name, "Profiler.Outer") == 0);
+
+        const FProfileEvent& Innermost = Events[0];
+        const FProfileEvent& Inner = Events[1];
+        const FProfileEvent& Sibling = Events[2];
+        const FProfileEvent& Outer = Events[3];
+        TEST_CHECK(Outer.Depth == BaseDepth);
+        TEST_CHECK(Inner.Depth == BaseDepth + 1);
+        TEST_CHECK(Innermost.Depth == BaseDepth + 2);
+        TEST_CHECK(Sibling.Depth == BaseDepth + 1);
+
+        TEST_CHECK(Contains(Outer, Inner));
+        TEST_CHECK(Contains(Inner, Innermost));
+        TEST_CHECK(Contains(Outer, Sibling));
+        TEST_CHECK(Inner.EndTicks <= Sibling.StartTicks);
+    });
+
+    Runner.Register("Profiler.DisabledRecordsNothing", []
+    {
+        FProfiler::SetEnabled(true);
+        FThreadEventReader Reader;
+        const uint32 BaseDepth = FProfiler::GetThreadBuffer().Depth;
+
+        {
+            FProfileScope Outer("Profiler.Outer");
+
+            // 도중에 꺼도 이미 열린 스코프는 끝까지 기록됨
+            FProfiler::SetEnabled(false);
+            FProfileScope Skipped("Profiler.Skipped");
+            TEST_CHECK(FProfiler::GetThreadBuffer().Depth == BaseDepth + 1);
+        }
+        TEST_CHECK(FProfiler::GetThreadBuffer().Depth == BaseDepth);
+        FProfiler::SetEnabled(true);
+
+        const std::vector<FProfileEvent> Events = Reader.ReadNew();
+        TEST_CHECK(Events.size() == 1);
+        TEST_CHECK(FindEvent(Events, "Profiler.Outer") != nullptr);
+        TEST_CHECK(FindEvent(Events, "Profiler.Skipped") == nullptr);
+    });
+
+    Runner.Register("Profiler.RingWrapKeepsLatest", []
+    {
+        constexpr uint32 Capacity = FProfilerThreadBuffer::Capacity;
+        constexpr uint32 Extra = 100;
+        FProfilerThreadBuffer Buffer(7);
+
+        for (uint64 Index = 0; Index < Capacity + Extra; ++Index)
+        {
+            Buffer.Push("Profiler.Event", Index, Index + 1, static_cast<uint32>(Index & 7));
+        }
+
+        // 처음부터 읽어도 덮어써진 앞부분 Extra개는 빠지고, 나머지는 기록된 순서대로 나옴
+        std::vector<FProfileEvent> Events;
+        TEST_CHECK(Buffer.ReadFrom(0, Events) == Capacity + Extra);
+        TEST_CHECK(Events.size() == Capacity);
+        bool bInOrder = Events.size() == Capacity;
+        for (size_t i = 0; bInOrder && i < Events.size(); ++i)
+        {
+            const uint64 Expected = Extra + i;
+            bInOrder = Events[i].StartTicks == Expected && Events[i].EndTicks == Expected + 1
+                && Events[i].Depth == static_cast<uint32>(Expected & 7) && Events[i].ThreadIndex == 7;
+        }
+        TEST_CHECK(bInOrder);
+
+        // 중간부터 읽기
+        Events.clear();
+        TEST_CHECK(Buffer.ReadFrom(Capacity + Extra - 10, Events) == Capacity + Extra);
+        TEST_CHECK(Events.size() == 10);
+        TEST_CHECK(!Events.empty() && Events.front().StartTicks == Capacity + Extra - 10);
+
+        // 다 읽은 뒤에는 아무것도 없음
+        Events.clear();
+        TEST_CHECK(Buffer.ReadFrom(Capacity + Extra, Events) == Capacity + Extra);
+        TEST_CHECK(Events.empty());
+
+        // SinceTicks 기준 읽기
+        Buffer.Read(Capacity + Extra - 50, Events);
+        TEST_CHECK(Events.size() == 50);
+    });
+
+    Runner.Register("Profiler.ReadWhileWrapping", []
+    {
+        // 쓰는 스레드가 링을 여러 바퀴 도는 동안 읽어도 찢어진 슬롯이 나오지 않아야 함
+        constexpr uint64 NumEvents = FProfilerThreadBuffer::Capacity * 4ull;
+        FProfilerThreadBuffer Buffer(3);
+        std::atomic<bool> bDone = false;
+
+        std::thread Writer([&Buffer, &bDone]
+        {
+            for (uint64 Index = 0; Index < NumEvents; ++Index)
+            {
+                Buffer.Push("Profiler.Event", Index, Index + 1, static_cast<uint32>(Index & 7));
+            }
+            bDone.store(true, std::memory_order_release);
+        });
+
+        uint64 NumReads = 0;
+        bool bConsistent = true;
+        std::vector<FProfileEvent> Events;
+        while (bConsistent && (!bDone.load(std::memory_order_acquire) || NumReads == 0))
+        {
+            Events.clear();
+            const uint64 End = Buffer.ReadFrom(0, Events);
+            ++NumReads;
+
+            for (size_t i = 0; i < Events.size(); ++i)
+            {
+                const FProfileEvent& Event = Events[i];
+                const bool bSlotConsistent = Event.Name != nullptr && Event.EndTicks == Event.StartTicks + 1
+                    && Event.Depth == static_cast<uint32>(Event.StartTicks & 7);
+
+                // 남은 이벤트는 End 바로 앞까지 빈틈없이 이어짐
+                const bool bContiguous = Event.StartTicks == End - Events.size() + i;
+                bConsistent = bSlotConsistent && bContiguous;
+                if (!bConsistent)
+                {
+                    break;
+                }
+            }
+        }
+        Writer.join();
+
+        TEST_CHECK(bConsistent);
+        TEST_CHECK(NumReads > 0);
+    });
+
+    Runner.Register("Profiler.CollectEventsFromThreads", []
+    {
+        FProfiler::SetEnabled(true);
+        const uint64 SinceTicks = FProfiler::ReadTicks();
+
+        std::thread Worker([]
+        {
+            FProfileScope Scope("Profiler.WorkerScope");
+        });
+        Worker.join();
+        {
+            FProfileScope Scope("Profiler.MainScope");
+        }
+
+        std::vector<FProfileEvent> Events;
+        FProfiler::Get().CollectEvents(SinceTicks, Events);
+        const FProfileEvent* WorkerEvent = FindEvent(Events, "Profiler.WorkerScope");
+        const FProfileEvent* MainEvent = FindEvent(Events, "Profiler.MainScope");
+        TEST_CHECK(WorkerEvent != nullptr);
+        TEST_CHECK(MainEvent != nullptr);
+        if (WorkerEvent && MainEvent)
+        {
+            TEST_CHECK(MainEvent->ThreadIndex == FProfiler::GetThreadBuffer().GetThreadIndex());
+            TEST_CHECK(WorkerEvent->ThreadIndex != MainEvent->ThreadIndex);
+            TEST_CHECK(WorkerEvent->StartTicks >= SinceTicks);
+        }
+
+        // SinceTicks 이전의 이벤트는 빠짐
+        for (const FProfileEvent& Event : Events)
+        {
+            TEST_CHECK(Event.StartTicks >= SinceTicks);
+        }
+    });
+
+    Runner.Register("Profiler.ExportChromeTraceParses", []
+    {
+        FProfiler& Profiler = FProfiler::Get();
+        Profiler.SetEnabled(true);
+
+        uint32 WorkerIndex = 0;
+        std::thread Worker([&WorkerIndex]
+        {
+            FProfiler::Get().SetThreadName("Profiler Trace Worker");
+            WorkerIndex = FProfiler::GetThreadBuffer().GetThreadIndex();
+            FProfileScope Outer("Profiler.TraceOuter");
+            FProfileScope Inner("Profiler.TraceInner");
+        });
+        Worker.join();
+
+        const std::filesystem::path Path = std::filesystem::temp_directory_path() / "ProfilerTests.trace.json";
+        TEST_CHECK(Profiler.ExportChromeTrace(Path.string()));
+
+        std::stringstream Text;
+        {
+            std::ifstream File(Path, std::ios::binary);
+            Text << File.rdbuf();
+        }
+        std::filesystem::remove(Path);
+
+        const json::JSON Root = json::JSON::Load(Text.str());
+        TEST_CHECK(Root.hasKey("displayTimeUnit") && Root.at("displayTimeUnit").ToString() == "ms");
+        TEST_CHECK(Root.hasKey("traceEvents") && Root.at("traceEvents").JSONType() == json::JSON::Class::Array);
+        if (!Root.hasKey("traceEvents"))
+        {
+            return;
+        }
+        const json::JSON& Events = Root.at("traceEvents");
+
+        const json::JSON* ThreadName = nullptr;
+        for (const json::JSON& Event : Events.ArrayRange())
+        {
+            if (Event.at("ph").ToString() == "M" && ToNumber(Event.at("tid")) == WorkerIndex)
+            {
+                ThreadName = &Event;
+            }
+        }
+        TEST_CHECK(ThreadName != nullptr);
+        if (ThreadName)
+        {
+            TEST_CHECK(ThreadName->at("name").ToString() == "thread_name");
+            TEST_CHECK(ThreadName->at("args").at("name").ToString() == "Profiler Trace Worker");
+        }
+
+        const json::JSON* Outer = FindTraceEvent(Events, "Profiler.TraceOuter", "X");
+        const json::JSON* Inner = FindTraceEvent(Events, "Profiler.TraceInner", "X");
+        TEST_CHECK(Outer != nullptr);
+        TEST_CHECK(Inner != nullptr);
+        if (!Outer || !Inner)
+        {
+            return;
+        }
+
+        TEST_CHECK(ToNumber(Outer->at("pid")) == 1);
+        TEST_CHECK(ToNumber(Outer->at("tid")) == WorkerIndex);
+        TEST_CHECK(ToNumber(Inner->at("tid")) == WorkerIndex);
+
+        // 시각은 마이크로초, 소수점 셋째 자리까지라 반올림 오차만큼 여유를 둠
+        const double OuterStart = ToNumber(Outer->at("ts"));
+        const double OuterEnd = OuterStart + ToNumber(Outer->at("dur"));
+        const double InnerStart = ToNumber(Inner->at("ts"));
+        const double InnerEnd = InnerStart + ToNumber(Inner->at("dur"));
+        TEST_CHECK(OuterStart >= 0.0);
+        TEST_CHECK(ToNumber(Inner->at("dur")) >= 0.0);
+        TEST_CHECK(InnerStart >= OuterStart - 0.001);
+        TEST_CHECK(InnerEnd <= OuterEnd + 0.002);
+    });
+}
@@ -0,0 +1,206 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "RenderBatch.h"
+
+
+namespace
+{
+    struct FSubmittedInstance
+    {
+        EShaderType Shader;
+        EPrimitiveType Primitive;
+    };
+
+    /**
+     * URenderer::UpdateInstance처럼 구는 임포스터 셰이더, 나머지는 Simple 셰이더로 그리는 인스턴스를 섞어서 등록
+     * 구의 절반은 임포스터 대신 Simple 셰이더로 그려서, 같은 프리미티브가 셰이더에 따라 나뉘는지도 봄
+     */
+    std::vector<FSubmittedInstance> AddShuffledInstances(FRenderBatchBuilder& Builder, uint32 NumPerPrimitive, uint32 Seed)
+    {
+        std::vector<FSubmittedInstance> Instances;
+        for (uint32 i = 0; i < NumPerPrimitive; ++i)
+        {
+            Instances.push_back({ EShaderType::EST_Simple, EPrimitiveType::EPT_Triangle });
+            Instances.push_back({ EShaderType::EST_Simple, EPrimitiveType::EPT_Cube });
+            Instances.push_back({ EShaderType::EST_SphereImpostor, EPrimitiveType::EPT_Sphere });
+            if (i % 2 == 0)
+            {
+                Instances.push_back({ EShaderType::EST_Simple, EPrimitiveType::EPT_Sphere });
+            }
+        }
+
+        std::mt19937 Random(Seed);
+        std::shuffle(Instances.begin(), Instances.end(), Random);
+
+        Builder.Reset();
+        for (uint32 i = 0; i < static_cast<uint32>(Instances.size()); ++i)
+        {
+            Builder.AddInstance(Instances[i].Shader, Instances[i].Primitive, i);
+        }
+        return Instances;
+    }
+
+    uint32 CountMatching(const std::vector<FSubmittedInstance>& Instances, EShaderType Shader, EPrimitiveType Primitive)
+    {
+        return static_cast<uint32>(std::count_if(Instances.begin(), Instances.end(), [Shader, Primitive](const FSubmittedInstance& Instance)
+        {
+            return Instance.Shader == Shader && Instance.Primitive == Primitive;
+        }));
+    }
+}
+
+void RegisterRenderBatchTests(FTestRunner& Runner)
+{
+    Runner.Register("RenderBatch.DrawKeyOrdering", []
+    {
+        // 셰이더가 가장 먼저, 그다음 프리미티브, 마지막이 제출 순서
+        const FDrawKey A = FDrawKey::Make(EShaderType::EST_Simple, EPrimitiveType::EPT_Sphere, 0xffffffffu);
+        const FDrawKey B = FDrawKey::Make(EShaderType::EST_SphereImpostor, EPrimitiveType::EPT_Triangle, 0);
+        const FDrawKey C = FDrawKey::Make(EShaderType::EST_Simple, EPrimitiveType::EPT_Triangle, 5);
+        const FDrawKey D = FDrawKey::Make(EShaderType::EST_Simple, EPrimitiveType::EPT_Triangle, 6);
+        TEST_CHECK(A < B);
+        TEST_CHECK(C < A);
+        TEST_CHECK(C < D);
+        TEST_CHECK(C.IsSameState(D));
+        TEST_CHECK(!A.IsSameState(C));
+        TEST_CHECK(!A.IsSameState(B));
+
+        TEST_CHECK(A.GetShader() == EShaderType::EST_Simple);
+        TEST_CHECK(A.GetPrimitive() == EPrimitiveType::EPT_Sphere);
+        TEST_CHECK(A.GetSourceIndex() == 0xffffffffu);
+        TEST_CHECK(B.GetShader() == EShaderType::EST_SphereImpostor);
+        TEST_CHECK(B.GetPrimitive() == EPrimitiveType::EPT_Triangle);
+    });
+
+    Runner.Register("RenderBatch.GroupsShuffledInstances", []
+    {
+        FRenderBatchBuilder Builder;
+        const std::vector<FSubmittedInstance> Instances = AddShuffledInstances(Builder, 50, 1);
+        Builder.Build();
+
+        TEST_CHECK(Builder.NumInstances() == Instances.size());
+
+        // (Shader, Primitive)마다 배치 하나, 키 순서대로
+        const TArray<FDrawBatch>& Batches = Builder.GetBatches();
+        TEST_CHECK(Batches.Num() == 4);
+        if (Batches.Num() != 4)
+        {
+            return;
+        }
+        const FSubmittedInstance ExpectedOrder[] = {
+            { EShaderType::EST_Simple, EPrimitiveType::EPT_Triangle },
+            { EShaderType::EST_Simple, EPrimitiveType::EPT_Cube },
+            { EShaderType::EST_Simple, EPrimitiveType::EPT_Sphere },
+            { EShaderType::EST_SphereImpostor, EPrimitiveType::EPT_Sphere },
+        };
+
+        // 배치는 빈틈없이 이어지고, 모두 합치면 전체 인스턴스
+        uint32 NextOffset = 0;
+        for (size_t i = 0; i < Batches.Num(); ++i)
+        {
+            const FDrawBatch& Batch = Batches[i];
+            TEST_CHECK(Batch.Shader == ExpectedOrder[i].Shader && Batch.Primitive == ExpectedOrder[i].Primitive);
+            TEST_CHECK(Batch.InstanceOffset == NextOffset);
+            TEST_CHECK(Batch.InstanceCount == CountMatching(Instances, Batch.Shader, Batch.Primitive));
+            NextOffset += Batch.InstanceCount;
+        }
+        TEST_CHECK(NextOffset == Instances.size());
+
+        // 배치 안의 인스턴스는 그 배치의 상태를 쓰고, 제출 순서를 유지
+        bool bSourcesMatch = true;
+        std::vector<uint32> SeenSources;
+        for (const FDrawBatch& Batch : Batches)
+        {
+            for (uint32 i = Batch.InstanceOffset; i < Batch.InstanceOffset + Batch.InstanceCount; ++i)
+            {
+                const uint32 Source = Builder.GetSourceIndex(i);
+                const FSubmittedInstance& Instance = Instances[Source];
+                bSourcesMatch = bSourcesMatch && Instance.Shader == Batch.Shader && Instance.Primitive == Batch.Primitive;
+                bSourcesMatch = bSourcesMatch && (i == Batch.InstanceOffset || Builder.GetSourceIndex(i - 1) < Source);
+                SeenSources.push_back(Source);
+            }
+        }
+        TEST_CHECK(bSourcesMatch);
+
+        // 모든 인스턴스가 정확히 한 번씩
+        std::sort(SeenSources.begin(), SeenSources.end());
+        bool bEachOnce = SeenSources.size() == Instances.size();
+        for (uint32 i = 0; bEachOnce && i < SeenSources.size(); ++i)
+        {
+            bEachOnce = SeenSources[i] == i;
+        }
+        TEST_CHECK(bEachOnce);
+    });
+
+    Runner.Register("RenderBatch.ResetAndRebuild", []
+    {
+        FRenderBatchBuilder Builder;
+        Builder.Build();
+        TEST_CHECK(Builder.GetBatches().Num() == 0);
+
+        AddShuffledInstances(Builder, 10, 2);
+        Builder.Build();
+        TEST_CHECK(Builder.GetBatches().Num() == 4);
+
+        // 다음 프레임은 이전 프레임의 인스턴스를 이어받지 않음
+        Builder.Reset();
+        Builder.AddInstance(EShaderType::EST_Simple, EPrimitiveType::EPT_Cube, 0);
+        Builder.AddInstance(EShaderType::EST_Simple, EPrimitiveType::EPT_Cube, 1);
+        Builder.Build();
+        TEST_CHECK(Builder.NumInstances() == 2);
+        TEST_CHECK(Builder.GetBatches().Num() == 1);
+        TEST_CHECK(Builder.GetBatches()[0].InstanceOffset == 0 && Builder.GetBatches()[0].InstanceCount == 2);
+
+        // Build를 두 번 불러도 배치가 쌓이지 않음
+        Builder.Build();
+        TEST_CHECK(Builder.GetBatches().Num() == 1);
+    });
+
+    Runner.Register("RenderBatch.ClampToMaxInstanceCount", []
+    {
+        FRenderBatchBuilder Builder;
+        const std::vector<FSubmittedInstance> Instances = AddShuffledInstances(Builder, 20, 3);
+        Builder.Build();
+        const TArray<FDrawBatch>& Batches = Builder.GetBatches();
+        const uint32 NumInstances = static_cast<uint32>(Instances.size());
+
+        // 용량이 충분하면 그대로
+        TArray<FDrawBatch> Clamped;
+        TEST_CHECK(Builder.ClampBatches(NumInstances + 10, Clamped) == NumInstances);
+        TEST_CHECK(Clamped.Num() == Batches.Num());
+
+        // 모든 경계와 그 앞뒤에서 자름
+        for (uint32 MaxInstanceCount = 0; MaxInstanceCount <= NumInstances; ++MaxInstanceCount)
+        {
+            const uint32 Drawn = Builder.ClampBatches(MaxInstanceCount, Clamped);
+            uint32 Total = 0;
+            bool bValid = Drawn == MaxInstanceCount;
+            for (size_t i = 0; i < Clamped.Num(); ++i)
+            {
+                // 앞쪽 배치는 그대로, 마지막 배치만 줄어듦
+                const FDrawBatch& Batch = Clamped[i];
+                const FDrawBatch& Original = Batches[i];
+                bValid = bValid && Batch.Shader == Original.Shader && Batch.Primitive == Original.Primitive && Batch.InstanceOffset == Original.InstanceOffset;
+                bValid = bValid && Batch.InstanceCount > 0 && Batch.InstanceCount <= Original.InstanceCount;
+                bValid = bValid && (i + 1 == Clamped.Num() || Batch.InstanceCount == Original.InstanceCount);
+                Total += Batch.InstanceCount;
+            }
+            bValid = bValid && Total == Drawn;
+            if (!bValid)
+            {
+                ReportTestFailure(__FILE__, __LINE__, "MaxInstanceCount " + std::to_string(MaxInstanceCount));
+                return;
+            }
+        }
+
+        // 0이면 그릴 것이 없음
+        TEST_CHECK(Builder.ClampBatches(0, Clamped) == 0);
+        TEST_CHECK(Clamped.Num() == 0);
+    });
+}
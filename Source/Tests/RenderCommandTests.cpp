@@ -0,0 +1,146 @@
+﻿#include "TestCases.h"
+
+#include <vector>
+
+#include "Test.h"
+#include "RenderCommand.h"
+#include "Core/Async/TaskPool.h"
+
+
+namespace
+{
+    using FCommand = FRecordingRenderDevice::FCommand;
+
+    /** 여러 상태와 크기가 섞인 배치 목록, 인스턴스 구간은 이어져 있음 */
+    TArray<FDrawBatch> MakeBatches(uint32 NumBatches)
+    {
+        TArray<FDrawBatch> Batches;
+        uint32 Offset = 0;
+        for (uint32 i = 0; i < NumBatches; ++i)
+        {
+            FDrawBatch Batch;
+            Batch.Shader = static_cast<EShaderType>(i * static_cast<uint32>(EShaderType::EST_Max) / NumBatches);
+            Batch.Primitive = static_cast<EPrimitiveType>(i % static_cast<uint32>(EPrimitiveType::EPT_Max));
+            Batch.InstanceOffset = Offset;
+            Batch.InstanceCount = 1 + (i * 37) % 50;
+            Offset += Batch.InstanceCount;
+            Batches.Add(Batch);
+        }
+        return Batches;
+    }
+
+    /**
+     * 재생된 명령이 Recorder 순서대로 Begin, Draw..., Finish로 묶여 있고,
+     * 드로우를 이어 붙이면 원래 배치 목록과 같은지 확인
+     */
+    bool IsReplayedInOrder(const std::vector<FCommand>& Commands, uint32 NumRecorders, const TArray<FDrawBatch>& Batches)
+    {
+        size_t CommandIndex = 0;
+        size_t BatchIndex = 0;
+        uint32 BatchConsumed = 0;
+
+        for (uint32 Recorder = 0; Recorder < NumRecorders; ++Recorder)
+        {
+            if (CommandIndex >= Commands.size()
+                || Commands[CommandIndex].Type != FCommand::EType::Begin
+                || Commands[CommandIndex].RecorderIndex != Recorder)
+            {
+                return false;
+            }
+            ++CommandIndex;
+
+            while (CommandIndex < Commands.size() && Commands[CommandIndex].Type == FCommand::EType::Draw)
+            {
+                const FCommand& Command = Commands[CommandIndex++];
+                if (Command.RecorderIndex != Recorder || BatchIndex >= Batches.Num())
+                {
+                    return false;
+                }
+
+                // 청크 경계에서 쪼개진 배치는 같은 상태로 이어지는 구간이어야 함
+                const FDrawBatch& Expected = Batches[BatchIndex];
+                if (Command.Batch.Shader != Expected.Shader
+                    || Command.Batch.Primitive != Expected.Primitive
+                    || Command.Batch.InstanceOffset != Expected.InstanceOffset + BatchConsumed
+                    || Command.Batch.InstanceCount == 0
+                    || BatchConsumed + Command.Batch.InstanceCount > Expected.InstanceCount)
+                {
+                    return false;
+                }
+
+                BatchConsumed += Command.Batch.InstanceCount;
+                if (BatchConsumed == Expected.InstanceCount)
+                {
+                    ++BatchIndex;
+                    BatchConsumed = 0;
+                }
+            }
+
+            if (CommandIndex >= Commands.size()
+                || Commands[CommandIndex].Type != FCommand::EType::Finish
+                || Commands[CommandIndex].RecorderIndex != Recorder)
+            {
+                return false;
+            }
+            ++CommandIndex;
+        }
+
+        return CommandIndex == Commands.size() && BatchIndex == Batches.Num();
+    }
+}
+
+void RegisterRenderCommandTests(FTestRunner& Runner)
+{
+    // 여러 스레드에서 청크별로 기록해도 재생 순서는 항상 원래 배치 순서
+    Runner.Register("RenderCommand.ParallelSubmitReplaysInOrder", []
+    {
+        constexpr uint32 NumRecorders = 6;
+        FTaskPool TaskPool(3);
+        FRecordingRenderDevice Device(NumRecorders);
+        FParallelCommandSubmitter Submitter;
+
+        for (uint32 Frame = 0; Frame < 300; ++Frame)
+        {
+            const TArray<FDrawBatch> Batches = MakeBatches(1 + Frame % 40);
+
+            Device.ClearReplayed();
+            Submitter.Submit(Device, TaskPool, Batches);
+
+            if (!IsReplayedInOrder(Device.GetReplayedCommands(), NumRecorders, Batches))
+            {
+                ReportTestFailure(__FILE__, __LINE__, "replayed commands out of order");
+                return;
+            }
+        }
+    });
+
+    Runner.Register("RenderCommand.SplitBatchesBalancesInstances", []
+    {
+        const TArray<FDrawBatch> Batches = MakeBatches(10);
+        uint32 TotalInstances = 0;
+        for (const FDrawBatch& Batch : Batches)
+        {
+            TotalInstances += Batch.InstanceCount;
+        }
+
+        constexpr uint32 NumChunks = 4;
+        std::vector<std::vector<FDrawBatch>> Chunks;
+        FParallelCommandSubmitter::SplitBatches(Batches, NumChunks, Chunks);
+        TEST_CHECK(Chunks.size() == NumChunks);
+
+        // 마지막 청크를 빼면 모두 올림한 몫만큼 채워짐
+        const uint32 PerChunk = (TotalInstances + NumChunks - 1) / NumChunks;
+        uint32 Sum = 0;
+        for (uint32 i = 0; i < NumChunks; ++i)
+        {
+            uint32 ChunkInstances = 0;
+            for (const FDrawBatch& Piece : Chunks[i])
+            {
+                ChunkInstances += Piece.InstanceCount;
+            }
+            TEST_CHECK(i + 1 == NumChunks ? ChunkInstances <= PerChunk : ChunkInstances == PerChunk);
+            Sum += ChunkInstances;
+        }
+        TEST_CHECK(Sum == TotalInstances);
+    });
+}
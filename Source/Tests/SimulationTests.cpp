@@ -0,0 +1,105 @@
+﻿#include "TestCases.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "Test.h"
+#include "USimulation.h"
+
+
+namespace
+{
+    FSimulationSettings MakeTestSettings()
+    {
+        FSimulationSettings Settings;
+        Settings.NumBalls = 64;
+        Settings.bApplyGravity = true;
+        Settings.bBallCollision = true;
+        Settings.PrimitiveMode = static_cast<int32>(EPrimitiveType::EPT_Sphere);
+
+        // 스레드로 돌릴 때 실제 시간이 오래 걸리지 않도록 짧은 스텝
+        Settings.FixedTimeStep = 1.0f / 1000.0f;
+        return Settings;
+    }
+}
+
+void RegisterSimulationTests(FTestRunner& Runner)
+{
+    Runner.Register("Simulation.ResetIsDeterministic", []
+    {
+        USimulation Simulation;
+        const FSimulationSettings Settings = MakeTestSettings();
+        Simulation.SetSettings(Settings);
+
+        Simulation.Reset(1234);
+        for (uint32 i = 0; i < 300; ++i)
+        {
+            Simulation.Step(Settings.FixedTimeStep);
+        }
+        const uint64 FirstHash = Simulation.GetStateHash();
+
+        Simulation.Reset(1234);
+        TEST_CHECK(Simulation.GetStepCount() == 0);
+        for (uint32 i = 0; i < 300; ++i)
+        {
+            Simulation.Step(Settings.FixedTimeStep);
+        }
+        TEST_CHECK(Simulation.GetStateHash() == FirstHash);
+
+        Simulation.Reset(4321);
+        for (uint32 i = 0; i < 300; ++i)
+        {
+            Simulation.Step(Settings.FixedTimeStep);
+        }
+        TEST_CHECK(Simulation.GetStateHash() != FirstHash);
+    });
+
+    // 고정 스텝이면 스레드에서 돌려도 같은 스텝 수 뒤의 상태가 같음
+    Runner.Register("Simulation.ThreadedMatchesUnthreaded", []
+    {
+        constexpr uint32 Seed = 77;
+        constexpr uint64 MinSteps = 200;
+        const FSimulationSettings Settings = MakeTestSettings();
+
+        USimulation Threaded;
+        Threaded.SetSettings(Settings);
+        Threaded.Reset(Seed);
+        Threaded.StartThread();
+        TEST_CHECK(Threaded.IsThreaded());
+
+        // 스레드가 도는 동안 렌더 쪽에서 받는 스냅샷도 확인
+        uint64 LastStepIndex = 0;
+        uint32 NumBadSnapshots = 0;
+        const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (Threaded.GetStepCount() < MinSteps && std::chrono::steady_clock::now() < Deadline)
+        {
+            const FSimulationSnapshot& Snapshot = Threaded.ConsumeSnapshot();
+            const bool bTimeMatches = std::fabs(Snapshot.SimulationTime - Snapshot.StepIndex * static_cast<double>(Settings.FixedTimeStep)) < 1.0e-6;
+            if (Snapshot.StepIndex < LastStepIndex || Snapshot.Balls.size() != static_cast<size_t>(Settings.NumBalls) || !bTimeMatches)
+            {
+                ++NumBadSnapshots;
+            }
+            LastStepIndex = Snapshot.StepIndex;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        Threaded.StopThread();
+        TEST_CHECK(!Threaded.IsThreaded());
+        TEST_CHECK(NumBadSnapshots == 0);
+
+        const uint64 NumSteps = Threaded.GetStepCount();
+        TEST_CHECK(NumSteps >= MinSteps);
+
+        USimulation Unthreaded;
+        Unthreaded.SetSettings(Settings);
+        Unthreaded.Reset(Seed);
+        for (uint64 i = 0; i < NumSteps; ++i)
+        {
+            Unthreaded.Step(Settings.FixedTimeStep);
+        }
+
+        TEST_CHECK(Unthreaded.GetStepCount() == NumSteps);
+        TEST_CHECK(Unthreaded.GetStateHash() == Threaded.GetStateHash());
+    });
+}
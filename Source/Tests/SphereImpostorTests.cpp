@@ -0,0 +1,185 @@
+﻿#include "TestCases.h"
+
+#include <cmath>
+
+#include "Test.h"
+#include "SphereImpostor.h"
+
+
+namespace
+{
+    constexpr float NearZ = 0.1f;
+    constexpr float FarZ = 1000.0f;
+
+    struct FTestSphere
+    {
+        FVector Center;
+        float Radius;
+    };
+
+    /** 화면 가운데, 비스듬한 위치, 멀고 큰 구, 카메라에 아주 가까운 구 */
+    const FTestSphere TestSpheres[] =
+    {
+        { FVector(0.0f, 0.0f, 10.0f), 1.0f },
+        { FVector(3.0f, -2.0f, 15.0f), 2.5f },
+        { FVector(-8.0f, 5.0f, 30.0f), 4.0f },
+        { FVector(0.5f, 0.5f, 2.0f), 1.5f },
+    };
+
+    /** 해석적 광선-구 교차, 정규화하지 않은 방향으로 double에서 근의 공식을 그대로 풂 */
+    struct FAnalyticHit
+    {
+        bool bHit = false;
+        double ViewDepth = 0.0;
+        double Normal[3] = {};
+    };
+
+    FAnalyticHit IntersectAnalytic(const double Dir[3], const FTestSphere& Sphere)
+    {
+        const double C[3] = { Sphere.Center.X, Sphere.Center.Y, Sphere.Center.Z };
+        const double A = Dir[0] * Dir[0] + Dir[1] * Dir[1] + Dir[2] * Dir[2];
+        const double B = Dir[0] * C[0] + Dir[1] * C[1] + Dir[2] * C[2];
+        const double Cc = C[0] * C[0] + C[1] * C[1] + C[2] * C[2] - static_cast<double>(Sphere.Radius) * Sphere.Radius;
+
+        FAnalyticHit Hit;
+        const double Discriminant = B * B - A * Cc;
+        if (Discriminant < 0.0)
+        {
+            return Hit;
+        }
+
+        const double T = (B - std::sqrt(Discriminant)) / A;
+        Hit.bHit = true;
+        Hit.ViewDepth = T * Dir[2];
+        for (int i = 0; i < 3; ++i)
+        {
+            Hit.Normal[i] = (T * Dir[i] - C[i]) / Sphere.Radius;
+        }
+        return Hit;
+    }
+
+    /** 구 중심 방향에서 실루엣 쪽으로 Angle만큼 돌린 광선 */
+    void MakeRayAtAngle(const FTestSphere& Sphere, double Angle, double Roll, double OutDir[3])
+    {
+        const double Dist = Sphere.Center.Length();
+        const double W[3] = { Sphere.Center.X / Dist, Sphere.Center.Y / Dist, Sphere.Center.Z / Dist };
+
+        // W에 수직인 두 축 (U = Y x W, V = W x U)
+        double U[3] = { W[2], 0.0, -W[0] };
+        const double ULength = std::sqrt(U[0] * U[0] + U[2] * U[2]);
+        U[0] /= ULength;
+        U[2] /= ULength;
+        const double V[3] = { W[1] * U[2] - W[2] * U[1], W[2] * U[0] - W[0] * U[2], W[0] * U[1] - W[1] * U[0] };
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const double Side = std::cos(Roll) * U[i] + std::sin(Roll) * V[i];
+            OutDir[i] = std::cos(Angle) * W[i] + std::sin(Angle) * Side;
+        }
+    }
+
+    /** Resolve 결과가 해석해와 같은지 확인, Tolerance는 뷰 깊이 기준 */
+    void CheckSample(const double Dir[3], const FTestSphere& Sphere, double Tolerance)
+    {
+        const FVector RayDir(static_cast<float>(Dir[0]), static_cast<float>(Dir[1]), static_cast<float>(Dir[2]));
+        const FSphereImpostor::FSample Sample = FSphereImpostor::Resolve(RayDir, Sphere.Center, Sphere.Radius, NearZ, FarZ);
+        const FAnalyticHit Expected = IntersectAnalytic(Dir, Sphere);
+
+        TEST_CHECK(Sample.bCovered == Expected.bHit);
+        if (!Sample.bCovered || !Expected.bHit)
+        {
+            return;
+        }
+
+        TEST_CHECK_NEAR(Sample.ViewDepth, Expected.ViewDepth, Tolerance * Expected.ViewDepth);
+
+        const double ExpectedDeviceDepth = FarZ / (FarZ - NearZ) * (1.0 - NearZ / Expected.ViewDepth);
+        TEST_CHECK_NEAR(Sample.DeviceDepth, ExpectedDeviceDepth, 1.0e-5);
+
+        TEST_CHECK_NEAR(Sample.Normal.X, Expected.Normal[0], Tolerance * 10.0);
+        TEST_CHECK_NEAR(Sample.Normal.Y, Expected.Normal[1], Tolerance * 10.0);
+        TEST_CHECK_NEAR(Sample.Normal.Z, Expected.Normal[2], Tolerance * 10.0);
+    }
+}
+
+void RegisterSphereImpostorTests(FTestRunner& Runner)
+{
+    // 화면 격자의 광선마다 커버리지, 깊이, 노멀을 해석해와 비교
+    Runner.Register("SphereImpostor.MatchesAnalyticOnScreenGrid", []
+    {
+        const double TanHalfFovY = std::tan(3.14159265358979 / 6.0);
+        const double AspectRatio = 16.0 / 9.0;
+        constexpr int GridSize = 65;
+
+        for (const FTestSphere& Sphere : TestSpheres)
+        {
+            uint32 NumCovered = 0;
+            for (int Row = 0; Row < GridSize; ++Row)
+            {
+                for (int Column = 0; Column < GridSize; ++Column)
+                {
+                    const double NdcX = Column * 2.0 / (GridSize - 1) - 1.0;
+                    const double NdcY = Row * 2.0 / (GridSize - 1) - 1.0;
+                    const double Dir[3] = { NdcX * TanHalfFovY * AspectRatio, NdcY * TanHalfFovY, 1.0 };
+
+                    CheckSample(Dir, Sphere, 1.0e-4);
+                    NumCovered += IntersectAnalytic(Dir, Sphere).bHit ? 1 : 0;
+                }
+            }
+            TEST_CHECK(NumCovered > 0);
+        }
+    });
+
+    // 실루엣 원뿔 반각 asin(r/d) 바로 안쪽은 덮이고 바로 바깥은 안 덮임
+    Runner.Register("SphereImpostor.SilhouetteEdge", []
+    {
+        for (const FTestSphere& Sphere : TestSpheres)
+        {
+            const double HalfAngle = std::asin(Sphere.Radius / Sphere.Center.Length());
+            for (int Step = 0; Step < 8; ++Step)
+            {
+                const double Roll = Step * 3.14159265358979 / 4.0;
+
+                double Inside[3];
+                MakeRayAtAngle(Sphere, HalfAngle * (1.0 - 1.0e-3), Roll, Inside);
+                CheckSample(Inside, Sphere, 1.0e-3);
+                TEST_CHECK(IntersectAnalytic(Inside, Sphere).bHit);
+
+                double Outside[3];
+                MakeRayAtAngle(Sphere, HalfAngle * (1.0 + 1.0e-3), Roll, Outside);
+                const FVector OutsideDir(static_cast<float>(Outside[0]), static_cast<float>(Outside[1]), static_cast<float>(Outside[2]));
+                TEST_CHECK(!FSphereImpostor::Resolve(OutsideDir, Sphere.Center, Sphere.Radius, NearZ, FarZ).bCovered);
+            }
+        }
+    });
+
+    // 덮이는 광선은 모두 ComputeQuad 사각형을 지나야 함, 아니면 래스터라이저가 그 픽셀을 만들지 않음
+    Runner.Register("SphereImpostor.QuadContainsSilhouette", []
+    {
+        for (const FTestSphere& Sphere : TestSpheres)
+        {
+            const FSphereImpostor::FQuad Quad = FSphereImpostor::ComputeQuad(Sphere.Center, Sphere.Radius);
+            const FVector Origin = (Quad.Corners[0] + Quad.Corners[3]) * 0.5f;
+            const FVector AxisU = (Quad.Corners[2] - Quad.Corners[0]) * 0.5f;
+            const FVector AxisV = (Quad.Corners[1] - Quad.Corners[0]) * 0.5f;
+            const FVector Normal = FVector::CrossProduct(AxisU, AxisV).Normalize();
+
+            const double HalfAngle = std::asin(Sphere.Radius / Sphere.Center.Length());
+            for (int Step = 0; Step < 64; ++Step)
+            {
+                double Dir[3];
+                MakeRayAtAngle(Sphere, HalfAngle * (1.0 - 1.0e-4), Step * 3.14159265358979 / 32.0, Dir);
+                const FVector RayDir(static_cast<float>(Dir[0]), static_cast<float>(Dir[1]), static_cast<float>(Dir[2]));
+
+                // 사각형 평면과의 교점을 사각형 축으로 나타냄
+                const float T = FVector::DotProduct(Origin, Normal) / FVector::DotProduct(RayDir, Normal);
+                const FVector Offset = RayDir * T - Origin;
+                const float U = FVector::DotProduct(Offset, AxisU) / AxisU.LengthSquared();
+                const float V = FVector::DotProduct(Offset, AxisV) / AxisV.LengthSquared();
+
+                TEST_CHECK(std::fabs(U) <= 1.0f + 1.0e-4f);
+                TEST_CHECK(std::fabs(V) <= 1.0f + 1.0e-4f);
+            }
+        }
+    });
+}
@@ -0,0 +1,67 @@
+﻿#include "TestCases.h"
+
+#include <atomic>
+#include <memory>
+
+#include "Test.h"
+#include "Core/Async/TaskPool.h"
+
+
+void RegisterTaskPoolTests(FTestRunner& Runner)
+{
+    // 작업 수와 함수를 바꿔가며 연달아 호출해도 각 인덱스가 정확히 한 번씩, 그 호출의 함수로 실행됨
+    Runner.Register("TaskPool.BackToBackParallelFor", []
+    {
+        FTaskPool TaskPool(3);
+
+        constexpr uint32 MaxTasks = 64;
+        std::unique_ptr<std::atomic<uint32>[]> Counts(new std::atomic<uint32>[MaxTasks]);
+        uint32 NumWrongRound = 0;
+
+        for (uint32 Round = 0; Round < 2000; ++Round)
+        {
+            const uint32 NumTasks = 2 + Round % (MaxTasks - 1);
+            for (uint32 i = 0; i < MaxTasks; ++i)
+            {
+                Counts[i].store(0, std::memory_order_relaxed);
+            }
+
+            std::atomic<uint32> WrongRound = 0;
+            TaskPool.ParallelFor(NumTasks, [&Counts, &WrongRound, NumTasks](uint32 Index)
+            {
+                if (Index >= NumTasks)
+                {
+                    WrongRound.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                Counts[Index].fetch_add(1, std::memory_order_relaxed);
+            });
+
+            // ParallelFor가 반환한 뒤에는 이번 작업이 더 실행되지 않아야 함
+            NumWrongRound += WrongRound.load();
+            for (uint32 i = 0; i < MaxTasks; ++i)
+            {
+                const uint32 Expected = i < NumTasks ? 1 : 0;
+                if (Counts[i].load() != Expected)
+                {
+                    ReportTestFailure(__FILE__, __LINE__, "task index not run exactly once");
+                    return;
+                }
+            }
+        }
+
+        TEST_CHECK(NumWrongRound == 0);
+    });
+
+    Runner.Register("TaskPool.SmallCountsRunInline", []
+    {
+        FTaskPool TaskPool(2);
+        TEST_CHECK(TaskPool.GetNumThreads() == 3);
+
+        uint32 NumCalls = 0;
+        TaskPool.ParallelFor(0, [&NumCalls](uint32) { ++NumCalls; });
+        TEST_CHECK(NumCalls == 0);
+        TaskPool.ParallelFor(1, [&NumCalls](uint32 Index) { NumCalls += Index + 1; });
+        TEST_CHECK(NumCalls == 1);
+    });
+}
@@ -0,0 +1,96 @@
+﻿#include "Test.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+
+
+namespace
+{
+    std::atomic<uint32> NumFailures = 0;
+    std::mutex PrintMutex;
+}
+
+void ReportTestFailure(const char* File, int Line, const std::string& Message)
+{
+    std::lock_guard Lock(PrintMutex);
+    std::printf("  %s:%d: %s\n", File, Line, Message.c_str());
+    std::fflush(stdout);
+    NumFailures.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool CheckNear(double Actual, double Expected, double Tolerance, const char* File, int Line, const char* Expression)
+{
+    // NaN도 실패로 잡히도록 부정형으로 비교
+    if (!(std::fabs(Actual - Expected) <= Tolerance))
+    {
+        char Buffer[128];
+        std::snprintf(Buffer, sizeof(Buffer), " (%.9g vs %.9g, tolerance %.3g)", Actual, Expected, Tolerance);
+        ReportTestFailure(File, Line, std::string(Expression) + Buffer);
+        return false;
+    }
+    return true;
+}
+
+void FTestRunner::Register(const std::string& Name, FTestFunction Function)
+{
+    Cases.push_back({ Name, std::move(Function) });
+}
+
+int32 FTestRunner::Run(const std::string& Filter) const
+{
+    int32 NumRun = 0;
+    int32 NumFailed = 0;
+    for (const FCase& Case : Cases)
+    {
+        if (!Filter.empty() && Case.Name.find(Filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::printf("[ RUN  ] %s\n", Case.Name.c_str());
+        std::fflush(stdout);
+
+        const uint32 FailuresBefore = NumFailures.load();
+        Case.Function();
+        const bool bPassed = NumFailures.load() == FailuresBefore;
+
+        std::printf("[ %s ] %s\n", bPassed ? " OK " : "FAIL", Case.Name.c_str());
+        ++NumRun;
+        NumFailed += bPassed ? 0 : 1;
+    }
+
+    if (NumRun == 0)
+    {
+        return -1;
+    }
+
+    std::printf("%d passed, %d failed\n", NumRun - NumFailed, NumFailed);
+    return NumFailed;
+}
+
+int RunTestMain(const FTestRunner& Runner, const std::vector<std::string>& Args)
+{
+    std::string Filter;
+    for (const std::string& Arg : Args)
+    {
+        if (Arg.compare(0, 9, "--filter=") == 0)
+        {
+            Filter = Arg.substr(9);
+        }
+        else
+        {
+            std::printf("Unknown argument: %s\nUsage: [--filter=Name]\n", Arg.c_str());
+            return 2;
+        }
+    }
+
+    const int32 NumFailed = Runner.Run(Filter);
+    if (NumFailed < 0)
+    {
+        std::printf("No test matched the filter \"%s\".\n", Filter.c_str());
+        return 2;
+    }
+    return NumFailed == 0 ? 0 : 1;
+}
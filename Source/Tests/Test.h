@@ -0,0 +1,55 @@
+﻿#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 실패한 검사를 현재 테스트에 기록합니다. 보통 TEST_CHECK로 부름
+ * 어느 스레드에서 불러도 되지만, 테스트 함수가 끝나기 전에 불러야 그 테스트의 실패로 잡힌다.
+ */
+void ReportTestFailure(const char* File, int Line, const std::string& Message);
+
+/** |Actual - Expected| <= Tolerance가 아니면 두 값을 함께 기록 */
+bool CheckNear(double Actual, double Expected, double Tolerance, const char* File, int Line, const char* Expression);
+
+#define TEST_CHECK(Expression) \
+    ((Expression) ? true : (ReportTestFailure(__FILE__, __LINE__, #Expression), false))
+
+#define TEST_CHECK_NEAR(Actual, Expected, Tolerance) \
+    CheckNear((Actual), (Expected), (Tolerance), __FILE__, __LINE__, #Actual " ~= " #Expected)
+
+using FTestFunction = std::function<void()>;
+
+/**
+ * 테스트 케이스 목록과 실행기
+ * 케이스 하나가 실패해도 나머지는 계속 실행한다.
+ */
+class FTestRunner
+{
+public:
+    void Register(const std::string& Name, FTestFunction Function);
+
+    /**
+     * 이름에 Filter가 들어간 케이스를 실행합니다. Filter가 비어 있으면 전부
+     * @return 실패한 케이스 수, 맞는 케이스가 없으면 -1
+     */
+    int32 Run(const std::string& Filter) const;
+
+private:
+    struct FCase
+    {
+        std::string Name;
+        FTestFunction Function;
+    };
+
+    std::vector<FCase> Cases;
+};
+
+/**
+ * 테스트 실행 파일의 main, Args는 프로그램 이름을 뺀 인자 ([--filter=이름])
+ * @return 0 모두 성공, 1 실패한 케이스가 있음, 2 인자 오류나 맞는 케이스 없음
+ */
+int RunTestMain(const FTestRunner& Runner, const std::vector<std::string>& Args);
@@ -0,0 +1,89 @@
+﻿#pragma once
+
+class FTestRunner;
+
+
+/** FMatrix, FTransform */
+void RegisterMathTests(FTestRunner& Runner);
+
+/** FFramePacer를 실제 시계와 FFakeClock으로 */
+void RegisterFramePacerTests(FTestRunner& Runner);
+
+/** FTimeManager 스텝 예산, 누적 상한, 적응형 스텝 */
+void RegisterTimeManagerTests(FTestRunner& Runner);
+
+/** InputSystem 이벤트 적용과 TMpscQueue */
+void RegisterInputTests(FTestRunner& Runner);
+
+/** FTaskPool::ParallelFor */
+void RegisterTaskPoolTests(FTestRunner& Runner);
+
+/** FParallelCommandSubmitter를 FRecordingRenderDevice로 */
+void RegisterRenderCommandTests(FTestRunner& Runner);
+
+/** FProfilerHistory 프레임 나누기와 통계 */
+void RegisterProfilerHistoryTests(FTestRunner& Runner);
+
+/** FOcclusionCuller 가려짐 판정 */
+void RegisterOcclusionCullerTests(FTestRunner& Runner);
+
+/** FSphereImpostor CPU 레퍼런스를 해석해와 비교 */
+void RegisterSphereImpostorTests(FTestRunner& Runner);
+
+/** TTripleBuffer 생산자/소비자 */
+void RegisterTripleBufferTests(FTestRunner& Runner);
+
+/** USimulation 결정성 */
+void RegisterSimulationTests(FTestRunner& Runner);
+
+/** TArray 삭제, 이어 붙이기, 검색 */
+void RegisterArrayTests(FTestRunner& Runner);
+
+/** FInputRecording 저장/읽기와 재생 결정성 */
+void RegisterInputRecordingTests(FTestRunner& Runner);
+
+/** FProfiler 스코프 기록, 링 버퍼, Chrome Trace 내보내기 */
+void RegisterProfilerTests(FTestRunner& Runner);
+
+/** TMap Robin Hood 삽입, 삭제, 재배치와 문자열 키 조회 */
+void RegisterMapTests(FTestRunner& Runner);
+
+/** VectorKernels의 Exact/Fast 길이와 정규화 */
+void RegisterVectorKernelsTests(FTestRunner& Runner);
+
+/** UCamera의 기저 벡터, 행렬 캐시와 Version */
+void RegisterUCameraTests(FTestRunner& Runner);
+
+/** FInterpolationBuffer의 SoA 보간 */
+void RegisterInterpolationBufferTests(FTestRunner& Runner);
+
+/** FRenderBatchBuilder의 정렬, 묶기, 인스턴스 수 제한 */
+void RegisterRenderBatchTests(FTestRunner& Runner);
+
+/** TInlineArray 인라인 버퍼와 힙 사이의 전환 */
+void RegisterInlineArrayTests(FTestRunner& Runner);
+
+/** 위의 케이스를 모두 등록합니다. */
+inline void RegisterAllTests(FTestRunner& Runner)
+{
+    RegisterMathTests(Runner);
+    RegisterFramePacerTests(Runner);
+    RegisterTimeManagerTests(Runner);
+    RegisterInputTests(Runner);
+    RegisterTaskPoolTests(Runner);
+    RegisterRenderCommandTests(Runner);
+    RegisterProfilerHistoryTests(Runner);
+    RegisterOcclusionCullerTests(Runner);
+    RegisterSphereImpostorTests(Runner);
+    RegisterTripleBufferTests(Runner);
+    RegisterSimulationTests(Runner);
+    RegisterArrayTests(Runner);
+    RegisterInputRecordingTests(Runner);
+    RegisterProfilerTests(Runner);
+    RegisterMapTests(Runner);
+    RegisterVectorKernelsTests(Runner);
+    RegisterUCameraTests(Runner);
+    RegisterInterpolationBufferTests(Runner);
+    RegisterRenderBatchTests(Runner);
+    RegisterInlineArrayTests(Runner);
+}
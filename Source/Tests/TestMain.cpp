@@ -0,0 +1,15 @@
+﻿#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "TestCases.h"
+
+
+int main(int Argc, char** Argv)
+{
+    FTestRunner Runner;
+    RegisterAllTests(Runner);
+
+    const std::vector<std::string> Args(Argv + 1, Argv + Argc);
+    return RunTestMain(Runner, Args);
+}
@@ -0,0 +1,168 @@
+﻿#include "TestCases.h"
+
+#include <random>
+
+#include "Test.h"
+#include "Core/Time/Clock.h"
+#include "Core/Time/TimeManager.h"
+
+
+namespace
+{
+    /** 스텝을 다 꺼내고 꺼낸 스텝 수를 돌려줌 */
+    uint32 ConsumeAllSteps(FTimeManager& Time, float* OutLastTimeStep = nullptr)
+    {
+        uint32 NumSteps = 0;
+        float TimeStep;
+        while (Time.ConsumeStep(TimeStep))
+        {
+            ++NumSteps;
+            if (OutLastTimeStep)
+            {
+                *OutLastTimeStep = TimeStep;
+            }
+        }
+        return NumSteps;
+    }
+}
+
+void RegisterTimeManagerTests(FTestRunner& Runner)
+{
+    Runner.Register("TimeManager.TickUsesClock", []
+    {
+        FFakeClock Clock;
+        FTimeManager Time(&Clock);
+
+        TEST_CHECK(Time.Tick() == 0.0f);
+
+        Clock.Advance(0.05);
+        TEST_CHECK_NEAR(Time.Tick(), 0.05f, 1.0e-6f);
+        TEST_CHECK(ConsumeAllSteps(Time) == 3);
+        TEST_CHECK_NEAR(Time.GetAccumulator(), 0.05f - 3.0f / 60.0f, 1.0e-5f);
+
+        // Reset 뒤 첫 Tick은 다시 0
+        Time.Reset();
+        Clock.Advance(1.0);
+        TEST_CHECK(Time.Tick() == 0.0f);
+        TEST_CHECK(Time.GetAccumulator() == 0.0f);
+    });
+
+    // 누적 상한 안에 있는 긴 프레임은 정확히 MaxSubSteps만 돌고, 한 스텝 미만의 나머지만 남김
+    Runner.Register("TimeManager.SubStepCapDropsTime", []
+    {
+        FTimeStepSettings Settings;
+        Settings.FixedTimeStep = 1.0f / 60.0f;
+        Settings.MaxSubSteps = 4;
+        Settings.MaxAccumulatedTime = 1.0f;
+
+        FTimeManager Time;
+        Time.SetSettings(Settings);
+
+        // 6.3 스텝 분량
+        const float DeltaTime = 0.105f;
+        Time.Advance(DeltaTime);
+        TEST_CHECK(ConsumeAllSteps(Time) == 4);
+
+        const FTimeStats& Stats = Time.GetStats();
+        TEST_CHECK(Stats.FrameSteps == 4);
+        TEST_CHECK(Stats.NumThrottledFrames == 1);
+        TEST_CHECK_NEAR(Stats.FrameDroppedTime, 2.0f / 60.0f, 1.0e-5f);
+        TEST_CHECK_NEAR(Time.GetAccumulator(), DeltaTime - 6.0f / 60.0f, 1.0e-5f);
+
+        // 버린 시간 + 돌린 시간 + 남은 시간 = 들어온 시간
+        TEST_CHECK_NEAR(static_cast<float>(Stats.DroppedTime) + 4.0f / 60.0f + Time.GetAccumulator(), DeltaTime, 1.0e-5f);
+
+        // 다음 보통 프레임은 예산 안이라 버리지 않음
+        Time.Advance(1.0f / 60.0f);
+        TEST_CHECK(ConsumeAllSteps(Time) == 1);
+        TEST_CHECK(Time.GetStats().FrameDroppedTime == 0.0f);
+        TEST_CHECK(Time.GetStats().NumThrottledFrames == 1);
+    });
+
+    Runner.Register("TimeManager.MaxAccumulatedTimeClamp", []
+    {
+        FTimeStepSettings Settings;
+        Settings.FixedTimeStep = 1.0f / 60.0f;
+        Settings.MaxSubSteps = 100;
+        Settings.MaxAccumulatedTime = 0.25f;
+
+        FTimeManager Time;
+        Time.SetSettings(Settings);
+
+        // 긴 멈춤은 Advance에서 바로 상한까지 잘림
+        Time.Advance(2.0f);
+        TEST_CHECK(Time.GetAccumulator() == 0.25f);
+        TEST_CHECK_NEAR(Time.GetStats().FrameDroppedTime, 1.75f, 1.0e-6f);
+        TEST_CHECK(Time.GetStats().NumThrottledFrames == 1);
+
+        // 스텝 예산이 넉넉하면 남은 0.25초(15 스텝)는 모두 돌림
+        TEST_CHECK(ConsumeAllSteps(Time) == 15);
+        TEST_CHECK_NEAR(static_cast<float>(Time.GetStats().DroppedTime), 1.75f, 1.0e-6f);
+    });
+
+    Runner.Register("TimeManager.AdaptiveStepGrowsToMax", []
+    {
+        FTimeStepSettings Settings;
+        Settings.FixedTimeStep = 1.0f / 60.0f;
+        Settings.MaxSubSteps = 4;
+        Settings.MaxAccumulatedTime = 1.0f;
+        Settings.bAdaptiveTimeStep = true;
+        Settings.MaxTimeStep = 1.0f / 15.0f;
+
+        FTimeManager Time;
+        Time.SetSettings(Settings);
+
+        // 부하가 없으면 고정 스텝
+        float TimeStep = 0.0f;
+        Time.Advance(1.0f / 60.0f);
+        TEST_CHECK(Time.GetCurrentTimeStep() == Settings.FixedTimeStep);
+        TEST_CHECK(ConsumeAllSteps(Time, &TimeStep) == 1);
+        TEST_CHECK(TimeStep == Settings.FixedTimeStep);
+
+        // 예산(4 스텝)으로 소화할 수 있는 크기까지 늘어나고, 시간을 버리지 않음
+        Time.Advance(0.1f);
+        TEST_CHECK_NEAR(Time.GetCurrentTimeStep(), 0.025f, 1.0e-6f);
+        TEST_CHECK(ConsumeAllSteps(Time, &TimeStep) == 4);
+        TEST_CHECK_NEAR(TimeStep, 0.025f, 1.0e-6f);
+        TEST_CHECK(Time.GetStats().FrameDroppedTime == 0.0f);
+        TEST_CHECK_NEAR(Time.GetAccumulator(), 0.0f, 1.0e-6f);
+
+        // MaxTimeStep에서 멈추고, 그래도 남는 시간은 버림
+        Time.Advance(0.4f);
+        TEST_CHECK(Time.GetCurrentTimeStep() == Settings.MaxTimeStep);
+        TEST_CHECK(ConsumeAllSteps(Time, &TimeStep) == 4);
+        TEST_CHECK(TimeStep == Settings.MaxTimeStep);
+        TEST_CHECK_NEAR(Time.GetStats().FrameDroppedTime, 0.4f - 4.0f / 15.0f, 1.0e-5f);
+
+        // 부하가 풀리면 다시 고정 스텝
+        Time.Advance(1.0f / 60.0f);
+        TEST_CHECK(Time.GetCurrentTimeStep() == Settings.FixedTimeStep);
+    });
+
+    Runner.Register("TimeManager.AlphaInRange", []
+    {
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> DeltaTimeDist(0.0f, 0.2f);
+
+        for (const bool bAdaptive : { false, true })
+        {
+            FTimeStepSettings Settings;
+            Settings.MaxSubSteps = 3;
+            Settings.bAdaptiveTimeStep = bAdaptive;
+
+            FTimeManager Time;
+            Time.SetSettings(Settings);
+
+            for (uint32 Frame = 0; Frame < 1000; ++Frame)
+            {
+                Time.Advance(DeltaTimeDist(Random));
+                ConsumeAllSteps(Time);
+
+                const float Alpha = Time.GetAlpha();
+                TEST_CHECK(Alpha >= 0.0f && Alpha <= 1.0f);
+                TEST_CHECK(Time.GetAccumulator() < Time.GetCurrentTimeStep());
+                TEST_CHECK_NEAR(Alpha, Time.GetAccumulator() / Time.GetCurrentTimeStep(), 1.0e-6f);
+            }
+        }
+    });
+}
@@ -0,0 +1,119 @@
+﻿#include "TestCases.h"
+
+#include <atomic>
+#include <thread>
+
+#include "Test.h"
+#include "Core/Async/TripleBuffer.h"
+
+
+namespace
+{
+    /** 한 번에 쓰이지 않으면 값이 섞여 보이도록 큰 페이로드 */
+    struct FPayload
+    {
+        uint64 Sequence = 0;
+        uint64 Values[63] = {};
+
+        void Fill(uint64 InSequence)
+        {
+            Sequence = InSequence;
+            for (uint64& Value : Values)
+            {
+                Value = InSequence;
+            }
+        }
+
+        bool IsConsistent() const
+        {
+            for (const uint64 Value : Values)
+            {
+                if (Value != Sequence)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
+
+void RegisterTripleBufferTests(FTestRunner& Runner)
+{
+    Runner.Register("TripleBuffer.ConsumeSeesLatestPublish", []
+    {
+        TTripleBuffer<FPayload> Buffer;
+        FPayload Initial;
+        Initial.Fill(0);
+        Buffer.Reset(Initial);
+
+        TEST_CHECK(!Buffer.Consume());
+        TEST_CHECK(Buffer.GetReadBuffer().Sequence == 0);
+
+        // 두 번 공개하면 마지막 것만 보임
+        Buffer.GetWriteBuffer().Fill(1);
+        Buffer.Publish();
+        Buffer.GetWriteBuffer().Fill(2);
+        Buffer.Publish();
+
+        TEST_CHECK(Buffer.Consume());
+        TEST_CHECK(Buffer.GetReadBuffer().Sequence == 2);
+        TEST_CHECK(Buffer.GetReadBuffer().IsConsistent());
+
+        // 새로 공개된 것이 없으면 이전 값을 유지
+        TEST_CHECK(!Buffer.Consume());
+        TEST_CHECK(Buffer.GetReadBuffer().Sequence == 2);
+
+        // 쓰기 버퍼는 소비자가 읽는 버퍼와 겹치지 않음
+        Buffer.GetWriteBuffer().Fill(3);
+        TEST_CHECK(Buffer.GetReadBuffer().Sequence == 2);
+        TEST_CHECK(Buffer.GetReadBuffer().IsConsistent());
+    });
+
+    // 생산자가 계속 공개하는 동안 소비자가 보는 값은 항상 완전하고, 이전 값으로 되돌아가지 않음
+    Runner.Register("TripleBuffer.ProducerConsumer", []
+    {
+        constexpr uint64 NumPublishes = 200000;
+
+        TTripleBuffer<FPayload> Buffer;
+        FPayload Initial;
+        Initial.Fill(0);
+        Buffer.Reset(Initial);
+
+        std::thread Producer([&Buffer]
+        {
+            for (uint64 Sequence = 1; Sequence <= NumPublishes; ++Sequence)
+            {
+                Buffer.GetWriteBuffer().Fill(Sequence);
+                Buffer.Publish();
+            }
+        });
+
+        uint64 LastSequence = 0;
+        uint32 NumTorn = 0;
+        uint32 NumStale = 0;
+        uint32 NumConsumed = 0;
+        while (LastSequence < NumPublishes)
+        {
+            if (!Buffer.Consume())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const FPayload& Payload = Buffer.GetReadBuffer();
+            NumTorn += Payload.IsConsistent() ? 0 : 1;
+            NumStale += Payload.Sequence > LastSequence ? 0 : 1;
+            LastSequence = Payload.Sequence;
+            ++NumConsumed;
+        }
+
+        Producer.join();
+
+        TEST_CHECK(NumTorn == 0);
+        TEST_CHECK(NumStale == 0);
+        TEST_CHECK(NumConsumed > 0);
+        TEST_CHECK(LastSequence == NumPublishes);
+        TEST_CHECK(!Buffer.Consume());
+    });
+}
@@ -0,0 +1,157 @@
+﻿#include "TestCases.h"
+
+#include <cmath>
+
+#include "Test.h"
+#include "UCamera.h"
+
+
+namespace
+{
+    constexpr double Tolerance = 1e-5;
+
+    void CheckVectorNear(const FVector& Actual, const FVector& Expected, int Line)
+    {
+        if (std::abs(Actual.X - Expected.X) > Tolerance || std::abs(Actual.Y - Expected.Y) > Tolerance || std::abs(Actual.Z - Expected.Z) > Tolerance)
+        {
+            ReportTestFailure(__FILE__, Line, "(" + std::to_string(Actual.X) + ", " + std::to_string(Actual.Y) + ", " + std::to_string(Actual.Z)
+                + ") != (" + std::to_string(Expected.X) + ", " + std::to_string(Expected.Y) + ", " + std::to_string(Expected.Z) + ")");
+        }
+    }
+
+    /** Forward, Right, Up이 서로 수직인 단위 벡터인지 */
+    void CheckOrthonormalBasis(const UCamera& Camera, int Line)
+    {
+        const FVector Forward = Camera.GetForward();
+        const FVector Right = Camera.GetRight();
+        const FVector Up = Camera.GetUp();
+        const double Dots[] = { Forward.Dot(Right), Right.Dot(Up), Up.Dot(Forward) };
+        const double Lengths[] = { Forward.Length(), Right.Length(), Up.Length() };
+        for (int i = 0; i < 3; ++i)
+        {
+            if (std::abs(Dots[i]) > Tolerance || std::abs(Lengths[i] - 1.0) > Tolerance)
+            {
+                ReportTestFailure(__FILE__, Line, "camera basis is not orthonormal");
+                return;
+            }
+        }
+    }
+
+    /** 캐시가 지금 값으로 새로 계산한 것과 같은지 */
+    void CheckMatchesFreshCamera(const UCamera& Camera, int Line)
+    {
+        const FMatrix ExpectedView = FMatrix::LookAtLH(Camera.Location, Camera.Location + Camera.GetForward(), Camera.UpVector);
+        const FMatrix ExpectedProjection = FMatrix::PerspectiveFovLH(Camera.GetFovY(), Camera.GetAspectRatio(), Camera.GetNearZ(), Camera.GetFarZ());
+        if (!(Camera.GetViewMatrix() == ExpectedView))
+        {
+            ReportTestFailure(__FILE__, Line, "stale view matrix");
+        }
+        if (!(Camera.GetProjectionMatrix() == ExpectedProjection))
+        {
+            ReportTestFailure(__FILE__, Line, "stale projection matrix");
+        }
+        if (!(Camera.GetViewProjectionMatrix() == ExpectedView * ExpectedProjection))
+        {
+            ReportTestFailure(__FILE__, Line, "stale view-projection matrix");
+        }
+    }
+}
+
+void RegisterUCameraTests(FTestRunner& Runner)
+{
+    Runner.Register("UCamera.CacheFollowsChanges", []
+    {
+        UCamera Camera;
+        Camera.Location = FVector(0, 0, 0);
+
+        // 회전이 0이면 +X를 봄
+        CheckVectorNear(Camera.GetForward(), FVector(1, 0, 0), __LINE__);
+        CheckVectorNear(Camera.GetUp(), FVector(0, 1, 0), __LINE__);
+        CheckOrthonormalBasis(Camera, __LINE__);
+        const FVector RightBefore = Camera.GetRight();
+        CheckMatchesFreshCamera(Camera, __LINE__);
+
+        // Z축으로 90도 돌면 +Z를 봄, 기저 벡터가 함께 바뀌어야 함
+        Camera.Rotation = FVector(0, 0, 90);
+        CheckVectorNear(Camera.GetForward(), FVector(0, 0, 1), __LINE__);
+        CheckVectorNear(Camera.GetUp(), FVector(0, 1, 0), __LINE__);
+        CheckOrthonormalBasis(Camera, __LINE__);
+        TEST_CHECK(std::abs(Camera.GetRight().Dot(RightBefore)) < Tolerance);
+        CheckMatchesFreshCamera(Camera, __LINE__);
+
+        // 위치만 바꿔도 뷰 행렬은 다시 계산됨
+        const FMatrix ViewBefore = Camera.GetViewMatrix();
+        Camera.Location = FVector(1, 2, 3);
+        TEST_CHECK(!(Camera.GetViewMatrix() == ViewBefore));
+        CheckVectorNear(Camera.GetViewMatrix().TransformPosition(Camera.Location), FVector(0, 0, 0), __LINE__);
+        CheckMatchesFreshCamera(Camera, __LINE__);
+
+        Camera.SetUpVector(FVector(0, 1, -1));
+        CheckMatchesFreshCamera(Camera, __LINE__);
+
+        // 뷰포트를 바꾸면 투영 행렬의 가로/세로 비율이 바뀜
+        const FMatrix ProjectionBefore = Camera.GetProjectionMatrix();
+        Camera.SetViewport(1920.0f, 1080.0f);
+        TEST_CHECK_NEAR(Camera.GetAspectRatio(), 1920.0 / 1080.0, Tolerance);
+        TEST_CHECK(!(Camera.GetProjectionMatrix() == ProjectionBefore));
+        CheckMatchesFreshCamera(Camera, __LINE__);
+
+        // 크기가 0인 뷰포트(최소화된 창)는 무시
+        Camera.SetViewport(0.0f, 0.0f);
+        TEST_CHECK_NEAR(Camera.GetAspectRatio(), 1920.0 / 1080.0, Tolerance);
+
+        Camera.SetProjection(1.0f, 0.5f, 50.0f);
+        CheckMatchesFreshCamera(Camera, __LINE__);
+    });
+
+    Runner.Register("UCamera.VersionAdvancesOnlyOnChange", []
+    {
+        UCamera Camera;
+        Camera.SetViewport(800.0f, 600.0f);
+        const uint64 Initial = Camera.GetVersion();
+
+        // 읽기만 하거나 같은 값을 다시 넣으면 그대로
+        Camera.GetViewProjectionMatrix();
+        Camera.GetForward();
+        TEST_CHECK(Camera.GetVersion() == Initial);
+
+        const FVector SameLocation = Camera.Location;
+        Camera.Location = SameLocation;
+        Camera.Rotation = FVector(0, 0, 0);
+        Camera.SetViewport(800.0f, 600.0f);
+        Camera.SetViewport(1600.0f, 1200.0f);
+        Camera.SetProjection(Camera.GetFovY(), Camera.GetNearZ(), Camera.GetFarZ());
+        Camera.SetViewport(-1.0f, 600.0f);
+        TEST_CHECK(Camera.GetVersion() == Initial);
+
+        // 값마다 한 번씩
+        Camera.Location = Camera.Location + FVector(0, 0, 1);
+        TEST_CHECK(Camera.GetVersion() == Initial + 1);
+
+        Camera.Rotation = FVector(0, 10, 0);
+        TEST_CHECK(Camera.GetVersion() == Initial + 2);
+
+        Camera.SetUpVector(FVector(0, 0, 1));
+        TEST_CHECK(Camera.GetVersion() == Initial + 3);
+
+        Camera.SetViewport(1024.0f, 1024.0f);
+        TEST_CHECK(Camera.GetVersion() == Initial + 4);
+
+        Camera.SetProjection(1.0f, 0.1f, 100.0f);
+        TEST_CHECK(Camera.GetVersion() == Initial + 5);
+
+        // 여러 값을 바꿔도 다시 계산하는 것은 한 번
+        Camera.Location = FVector(5, 5, 5);
+        Camera.Rotation = FVector(0, 0, 45);
+        Camera.SetViewport(640.0f, 480.0f);
+        TEST_CHECK(Camera.GetVersion() == Initial + 6);
+        TEST_CHECK(Camera.GetVersion() == Initial + 6);
+
+        // FixedUpdate는 속도가 있을 때만 위치를 바꿈
+        Camera.FixedUpdate(1.0f);
+        TEST_CHECK(Camera.GetVersion() == Initial + 6);
+        Camera.SetVelocity(FVector(1, 0, 0));
+        Camera.FixedUpdate(0.5f);
+        TEST_CHECK(Camera.GetVersion() == Initial + 7);
+    });
+}
@@ -0,0 +1,190 @@
+﻿#include "TestCases.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Core/Math/Vector.h"
+#include "Core/Math/VectorKernels.h"
+
+
+namespace
+{
+    /** Fast 모드에서 허용하는 상대 오차 (VectorKernels.h의 ESqrtMode::Fast) */
+    constexpr double FastTolerance = 4e-7;
+
+    /** SIMD 4개 묶음과 남는 원소를 모두 거치도록 4의 배수가 아닌 크기를 섞음 */
+    const std::vector<size_t> TestSizes = { 0, 1, 3, 4, 5, 7, 8, 13, 1003 };
+
+    /** X, Y, Z 채널을 Num개씩 이어 붙인 SoA 배열 */
+    struct FVectorStreams
+    {
+        std::vector<float> Values;
+        size_t Num = 0;
+
+        explicit FVectorStreams(const std::vector<FVector>& Vectors)
+            : Values(Vectors.size() * 3)
+            , Num(Vectors.size())
+        {
+            for (size_t i = 0; i < Num; ++i)
+            {
+                Values[i] = Vectors[i].X;
+                Values[Num + i] = Vectors[i].Y;
+                Values[Num * 2 + i] = Vectors[i].Z;
+            }
+        }
+
+        FVectorSpan Span()
+        {
+            return { std::span(Values.data(), Num), std::span(Values.data() + Num, Num), std::span(Values.data() + Num * 2, Num) };
+        }
+
+        FVector Get(size_t Index) const
+        {
+            return FVector(Values[Index], Values[Num + Index], Values[Num * 2 + Index]);
+        }
+    };
+
+    /** 길이가 1e-3 ~ 1e3 범위에 고르게 퍼진 벡터들 */
+    std::vector<FVector> MakeRandomVectors(size_t Num, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Direction(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> Exponent(-3.0f, 3.0f);
+
+        std::vector<FVector> Vectors(Num);
+        for (FVector& Vector : Vectors)
+        {
+            const float Scale = std::pow(10.0f, Exponent(Random));
+            Vector = FVector(Direction(Random) * Scale, Direction(Random) * Scale, Direction(Random) * Scale);
+        }
+        return Vectors;
+    }
+
+    bool BitEqual(float A, float B)
+    {
+        return std::memcmp(&A, &B, sizeof(float)) == 0;
+    }
+
+    void ReportMismatch(int Line, const char* What, size_t Num, size_t Index, double Actual, double Expected)
+    {
+        ReportTestFailure(__FILE__, Line, std::string(What) + " Num " + std::to_string(Num) + " [" + std::to_string(Index) + "]: "
+            + std::to_string(Actual) + ", expected " + std::to_string(Expected));
+    }
+}
+
+void RegisterVectorKernelsTests(FTestRunner& Runner)
+{
+    Runner.Register("VectorKernels.ExactMatchesFVector", []
+    {
+        for (const size_t Num : TestSizes)
+        {
+            const std::vector<FVector> Vectors = MakeRandomVectors(Num, static_cast<uint32>(Num + 1));
+            FVectorStreams Streams(Vectors);
+
+            std::vector<float> Lengths(Num);
+            VectorKernels::LengthN(Streams.Span(), Lengths, ESqrtMode::Exact);
+            VectorKernels::NormalizeN(Streams.Span(), ESqrtMode::Exact);
+
+            for (size_t i = 0; i < Num; ++i)
+            {
+                const FVector Expected = Vectors[i].Normalize();
+                const FVector Actual = Streams.Get(i);
+                if (!BitEqual(Lengths[i], Vectors[i].Length()))
+                {
+                    ReportMismatch(__LINE__, "Length", Num, i, Lengths[i], Vectors[i].Length());
+                    return;
+                }
+                if (!BitEqual(Actual.X, Expected.X) || !BitEqual(Actual.Y, Expected.Y) || !BitEqual(Actual.Z, Expected.Z))
+                {
+                    ReportMismatch(__LINE__, "Normalize.X", Num, i, Actual.X, Expected.X);
+                    return;
+                }
+            }
+        }
+    });
+
+    Runner.Register("VectorKernels.FastWithinTolerance", []
+    {
+        for (const size_t Num : TestSizes)
+        {
+            const std::vector<FVector> Vectors = MakeRandomVectors(Num, static_cast<uint32>(Num + 100));
+            FVectorStreams Streams(Vectors);
+
+            std::vector<float> Lengths(Num);
+            VectorKernels::LengthN(Streams.Span(), Lengths, ESqrtMode::Fast);
+            VectorKernels::NormalizeN(Streams.Span(), ESqrtMode::Fast);
+
+            for (size_t i = 0; i < Num; ++i)
+            {
+                // 비교 기준은 double로 계산한 값
+                const double X = Vectors[i].X;
+                const double Y = Vectors[i].Y;
+                const double Z = Vectors[i].Z;
+                const double Length = std::sqrt(X * X + Y * Y + Z * Z);
+
+                if (std::abs(Lengths[i] - Length) > FastTolerance * Length)
+                {
+                    ReportMismatch(__LINE__, "Length", Num, i, Lengths[i], Length);
+                    return;
+                }
+
+                // 정규화한 성분의 크기는 1 이하이므로 절대 오차로 봄
+                const FVector Actual = Streams.Get(i);
+                const double Error = std::max({ std::abs(Actual.X - X / Length), std::abs(Actual.Y - Y / Length), std::abs(Actual.Z - Z / Length) });
+                if (Error > FastTolerance)
+                {
+                    ReportMismatch(__LINE__, "Normalize error", Num, i, Error, FastTolerance);
+                    return;
+                }
+            }
+        }
+    });
+
+    Runner.Register("VectorKernels.OverflowAndUnderflow", []
+    {
+        // 길이의 제곱이 float 범위를 넘거나 0으로 떨어지는 벡터를 4개 묶음과 남는 원소 양쪽에 둠
+        const std::vector<FVector> Vectors = {
+            FVector(1e20f, 0.0f, 0.0f), FVector(0.0f, -3e19f, 2e19f), FVector(1.0f, 2.0f, 2.0f), FVector(1e-30f, 0.0f, 0.0f),
+            FVector(0.0f, 0.0f, 0.0f), FVector(1e20f, 1e20f, 1e20f), FVector(0.0f, 0.0f, -5.0f),
+        };
+
+        for (const ESqrtMode Mode : { ESqrtMode::Exact, ESqrtMode::Fast })
+        {
+            const char* ModeName = Mode == ESqrtMode::Exact ? "Exact" : "Fast";
+            FVectorStreams Streams(Vectors);
+
+            std::vector<float> Lengths(Vectors.size());
+            VectorKernels::LengthN(Streams.Span(), Lengths, Mode);
+            VectorKernels::NormalizeN(Streams.Span(), Mode);
+
+            for (size_t i = 0; i < Vectors.size(); ++i)
+            {
+                const FVector Actual = Streams.Get(i);
+                if (std::isnan(Lengths[i]) || std::isnan(Actual.X) || std::isnan(Actual.Y) || std::isnan(Actual.Z))
+                {
+                    ReportTestFailure(__FILE__, __LINE__, std::string(ModeName) + " produced NaN at " + std::to_string(i));
+                }
+            }
+
+            // 넘치면 길이는 무한대, 정규화는 0 벡터
+            TEST_CHECK(std::isinf(Lengths[0]) && std::isinf(Lengths[1]) && std::isinf(Lengths[5]));
+            TEST_CHECK(Streams.Get(0).X == 0.0f && Streams.Get(1).Y == 0.0f && Streams.Get(1).Z == 0.0f);
+            TEST_CHECK(Streams.Get(5).X == 0.0f && Streams.Get(5).Y == 0.0f && Streams.Get(5).Z == 0.0f);
+
+            // 제곱이 0으로 떨어지면 길이 0, 0 벡터
+            TEST_CHECK(Lengths[3] == 0.0f && Lengths[4] == 0.0f);
+            TEST_CHECK(Streams.Get(3).X == 0.0f && Streams.Get(4).X == 0.0f);
+
+            // 보통 벡터는 그대로 처리됨
+            TEST_CHECK_NEAR(Lengths[2], 3.0, 3.0 * FastTolerance);
+            TEST_CHECK_NEAR(Streams.Get(2).Y, 2.0 / 3.0, FastTolerance);
+            TEST_CHECK_NEAR(Lengths[6], 5.0, 5.0 * FastTolerance);
+            TEST_CHECK_NEAR(Streams.Get(6).Z, -1.0, FastTolerance);
+        }
+    });
+}
@@ -0,0 +1,53 @@
+﻿#include "SphereImpostor.h"
+
+#include <algorithm>
+#include <cmath>
+
+FSphereImpostor::FQuad FSphereImpostor::ComputeQuad(const FVector& Center, float Radius)
+{
+    // 중심을 지나고 시선에 수직인 평면에서 실루엣 원뿔의 반지름은 r * d / sqrt(d^2 - r^2)
+    const float DistSq = Center.LengthSquared();
+    const float Enlarge = std::sqrt(DistSq / std::max(DistSq - Radius * Radius, 1e-6f));
+
+    const FVector W = Center.Normalize();
+    const FVector U = FVector::CrossProduct(FVector(0, 1, 0), W).Normalize();
+    const FVector V = FVector::CrossProduct(W, U);
+
+    const float Extent = Radius * Enlarge;
+    FQuad Quad;
+    Quad.Corners[0] = Center + (-U - V) * Extent;
+    Quad.Corners[1] = Center + (-U + V) * Extent;
+    Quad.Corners[2] = Center + (U - V) * Extent;
+    Quad.Corners[3] = Center + (U + V) * Extent;
+    return Quad;
+}
+
+FSphereImpostor::FSample FSphereImpostor::Resolve(const FVector& RayDir, const FVector& Center, float Radius, float NearZ, float FarZ)
+{
+    FSample Sample;
+
+    // |tD - C|^2 = r^2
+    const FVector D = RayDir.Normalize();
+    const float B = FVector::DotProduct(D, Center);
+    const float C = Center.LengthSquared() - Radius * Radius;
+    const float Discriminant = B * B - C;
+    if (Discriminant < 0.0f)
+    {
+        return Sample;
+    }
+
+    const float T = B - std::sqrt(Discriminant);
+    const FVector Hit = D * T;
+
+    Sample.bCovered = true;
+    Sample.ViewDepth = Hit.Z;
+    Sample.DeviceDepth = ViewDepthToDeviceDepth(Hit.Z, NearZ, FarZ);
+    Sample.Normal = (Hit - Center) / Radius;
+    return Sample;
+}
+
+float FSphereImpostor::ViewDepthToDeviceDepth(float ViewDepth, float NearZ, float FarZ)
+{
+    const float Range = FarZ / (FarZ - NearZ);
+    return Range - Range * NearZ / ViewDepth;
+}
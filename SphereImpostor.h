@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include "Core/Math/Vector.h"
+
+/**
+ * 구 임포스터 수식의 CPU 레퍼런스 구현
+ * Shaders/SphereImpostor.hlsl과 같은 계산을 하므로, GPU 없이 커버리지와 깊이를 검증할 때 사용한다.
+ * 모든 좌표는 눈이 원점에 있는 뷰 공간(LH, +Z가 전방) 기준이다.
+ */
+struct FSphereImpostor
+{
+    /** 카메라를 향한 사각형의 네 코너 (좌하, 좌상, 우하, 우상) */
+    struct FQuad
+    {
+        FVector Corners[4];
+    };
+
+    /** 광선 하나에 대한 결과 */
+    struct FSample
+    {
+        bool bCovered = false;
+        float ViewDepth = 0.0f;   // 교차점의 뷰 공간 Z
+        float DeviceDepth = 0.0f; // 투영 후 깊이 버퍼에 쓰일 값 [0, 1]
+        FVector Normal;           // 뷰 공간 노멀
+    };
+
+    /**
+     * 구의 실루엣을 빈틈없이 덮는 사각형을 만듭니다.
+     * @param Center 뷰 공간 구 중심
+     * @param Radius 구 반지름
+     */
+    static FQuad ComputeQuad(const FVector& Center, float Radius);
+
+    /**
+     * 눈에서 출발한 광선과 구의 가장 가까운 교차점을 구합니다.
+     * @param RayDir 광선 방향 (정규화되지 않아도 됨)
+     * @param NearZ, FarZ 렌더러와 같은 투영 범위
+     */
+    static FSample Resolve(const FVector& RayDir, const FVector& Center, float Radius, float NearZ, float FarZ);
+
+    /** XMMatrixPerspectiveFovLH와 같은 깊이 변환 */
+    static float ViewDepthToDeviceDepth(float ViewDepth, float NearZ, float FarZ);
+};
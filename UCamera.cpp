@@ -3,23 +3,72 @@
 
 #define TORAD 3.14159265358979323846/180
 
-FVector UCamera::GetForward()
+FVector UCamera::GetForward() const
 {
-    return FVector(
-            std::cos(Rotation.Z * TORAD) * std::cos(Rotation.Y * TORAD),
-            std::sin(Rotation.Y * TORAD),
-            std::sin(Rotation.Z * TORAD) * std::cos(Rotation.Y * TORAD)
-        ).Normalize();
+    UpdateCache();
+    return Forward;
 }
 
-FVector UCamera::GetRight()
+FVector UCamera::GetRight() const
 {
-    return FVector::CrossProduct(GetForward(), FVector(0, 1, 0));
+    UpdateCache();
+    return Right;
 }
 
-FVector UCamera::GetUp()
+FVector UCamera::GetUp() const
 {
-    return FVector::CrossProduct(GetRight(), GetForward());
+    UpdateCache();
+    return Up;
+}
+
+void UCamera::SetProjection(float InFovY, float InNearZ, float InFarZ)
+{
+    if (FovY != InFovY || NearZ != InNearZ || FarZ != InFarZ)
+    {
+        FovY = InFovY;
+        NearZ = InNearZ;
+        FarZ = InFarZ;
+        bProjectionDirty = true;
+    }
+}
+
+void UCamera::SetViewport(float Width, float Height)
+{
+    if (Width <= 0.0f || Height <= 0.0f)
+    {
+        return;
+    }
+
+    const float NewAspectRatio = Width / Height;
+    if (AspectRatio != NewAspectRatio)
+    {
+        AspectRatio = NewAspectRatio;
+        bProjectionDirty = true;
+    }
+}
+
+const FMatrix& UCamera::GetViewMatrix() const
+{
+    UpdateCache();
+    return ViewMatrix;
+}
+
+const FMatrix& UCamera::GetProjectionMatrix() const
+{
+    UpdateCache();
+    return ProjectionMatrix;
+}
+
+const FMatrix& UCamera::GetViewProjectionMatrix() const
+{
+    UpdateCache();
+    return ViewProjectionMatrix;
+}
+
+uint64 UCamera::GetVersion() const
+{
+    UpdateCache();
+    return Version;
 }
 
 void UCamera::FixedUpdate(float DeltaTime)
@@ -27,4 +76,42 @@ void UCamera::FixedUpdate(float DeltaTime)
     Location += Velocity * DeltaTime;
 }
 
+void UCamera::UpdateCache() const
+{
+    const bool bRotationChanged = !bCacheValid || CachedRotation != Rotation;
+    const bool bViewChanged = bRotationChanged || CachedLocation != Location || CachedUpVector != UpVector;
+    if (!bViewChanged && !bProjectionDirty)
+    {
+        return;
+    }
+
+    if (bRotationChanged)
+    {
+        Forward = FVector(
+                std::cos(Rotation.Z * TORAD) * std::cos(Rotation.Y * TORAD),
+                std::sin(Rotation.Y * TORAD),
+                std::sin(Rotation.Z * TORAD) * std::cos(Rotation.Y * TORAD)
+            ).Normalize();
+        Right = FVector::CrossProduct(Forward, FVector(0, 1, 0));
+        Up = FVector::CrossProduct(Right, Forward);
+    }
+
+    if (bViewChanged)
+    {
+        ViewMatrix = FMatrix::LookAtLH(Location, Location + Forward, UpVector);
+    }
 
+    if (bProjectionDirty)
+    {
+        ProjectionMatrix = FMatrix::PerspectiveFovLH(FovY, AspectRatio, NearZ, FarZ);
+        bProjectionDirty = false;
+    }
+
+    ViewProjectionMatrix = ViewMatrix * ProjectionMatrix;
+
+    CachedLocation = Location;
+    CachedRotation = Rotation;
+    CachedUpVector = UpVector;
+    bCacheValid = true;
+    ++Version;
+}
@@ -1,24 +1,77 @@
 #pragma once
 
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/Matrix.h"
 #include "Core/Math/Vector.h"
 
+/**
+ * 카메라
+ * Location, Rotation, UpVector는 밖에서 직접 바꿔도 되고, 기저 벡터와 행렬은 값이 바뀐 것을 확인한 뒤에만 다시 계산한다.
+ * 캐시는 Get 함수를 처음 부를 때 갱신되므로 여러 스레드에서 동시에 읽으면 안 된다.
+ */
 class UCamera
 {
 public:
     FVector Location = FVector(-5, 0, 1);
     FVector UpVector = FVector(0, 1, 0); //업벡터를 조금씩 틀어주면 rotation할듯
-    FVector Rotation = FVector(0, 0, 0);
+    FVector Rotation = FVector(0, 0, 0); // 도(degree) 단위
 
     void SetVelocity(FVector NewVelocity) { Velocity = NewVelocity; }
     void SetUpVector(FVector NewUpVector) { UpVector = NewUpVector; }
 
-    FVector GetForward();
-    FVector GetRight();
-    FVector GetUp();
+    FVector GetForward() const;
+    FVector GetRight() const;
+    FVector GetUp() const;
+
+    /** 원근 투영 설정, FovY는 라디안 */
+    void SetProjection(float InFovY, float InNearZ, float InFarZ);
+
+    /** 뷰포트 크기로 가로/세로 비율을 정합니다. */
+    void SetViewport(float Width, float Height);
+
+    float GetFovY() const { return FovY; }
+    float GetAspectRatio() const { return AspectRatio; }
+    float GetNearZ() const { return NearZ; }
+    float GetFarZ() const { return FarZ; }
+
+    const FMatrix& GetViewMatrix() const;
+    const FMatrix& GetProjectionMatrix() const;
+
+    /** View * Projection */
+    const FMatrix& GetViewProjectionMatrix() const;
+
+    /**
+     * 뷰나 투영 행렬이 바뀔 때마다 1씩 증가하는 값
+     * 카메라에서 파생된 값을 캐시하는 쪽은 이 값이 같으면 다시 계산하지 않아도 된다.
+     */
+    uint64 GetVersion() const;
 
     void FixedUpdate(float DeltaTime);
     
+private:
+    /** 바뀐 값이 있으면 기저 벡터와 행렬을 다시 계산 */
+    void UpdateCache() const;
+
 private:
     FVector Velocity;
-    
-};
\ No newline at end of file
+
+    float FovY = 3.14159265f / 4.0f;
+    float AspectRatio = 1.0f;
+    float NearZ = 0.1f;
+    float FarZ = 100.0f;
+
+    // 마지막으로 캐시를 계산할 때 쓴 값
+    mutable bool bProjectionDirty = true;
+    mutable FVector CachedLocation;
+    mutable FVector CachedRotation;
+    mutable FVector CachedUpVector;
+    mutable bool bCacheValid = false;
+
+    mutable FVector Forward;
+    mutable FVector Right;
+    mutable FVector Up;
+    mutable FMatrix ViewMatrix;
+    mutable FMatrix ProjectionMatrix;
+    mutable FMatrix ViewProjectionMatrix;
+    mutable uint64 Version = 0;
+};
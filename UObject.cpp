@@ -1,7 +1,11 @@
-﻿#include <cstdlib>
+﻿#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 #include "UObject.h"
-#include "URenderer.h"
+
+float UObject::Gravity = 9.81f;
+unsigned int UObject::UUID_GEN = 0;
 
 UObject::UObject(): Location{
     static_cast<float>(rand()) / (static_cast<float>(RAND_MAX) / 2.0f) - 1.0f,
@@ -88,15 +92,15 @@ void UObject::FixedUpdate(float FixedTime)
 	Velocity.Y += Gravity * FixedTime;
 }
 
-
-void UObject::UpdateConstantView(const URenderer& Renderer, const UCamera& Camera) const
-{
-	Renderer.UpdateConstantView(*this, Camera);
-}
-
-void UObject::UpdateConstantUUID(const URenderer& Renderer, const DirectX::XMFLOAT4 UUIDColor)const
+FObjectRenderState UObject::GetRenderState() const
 {
-	Renderer.UpdateConstantUUID(UUIDColor);
+	FObjectRenderState State;
+	State.Location = Location;
+	State.Rotation = Rotation;
+	State.Radius = Radius;
+	State.UUID = UUID;
+	State.PrimitiveType = PrimitiveType;
+	return State;
 }
 
 void UObject::HandleWallCollision(const FVector& WallNormal)
@@ -114,8 +118,12 @@ void UObject::HandleWallCollision(const FVector& WallNormal)
 
 void UObject::HandleBallCollision(UObject& OtherBall)
 {
-	// 충돌 법선 벡터와 상대속도 계산
-	const FVector Normal = (OtherBall.Location - Location).Normalize();
+	HandleBallCollision(OtherBall, (OtherBall.Location - Location).Normalize());
+}
+
+void UObject::HandleBallCollision(UObject& OtherBall, const FVector& Normal)
+{
+	// 상대속도 계산
 	const FVector RelativeVelocity = OtherBall.Velocity - Velocity;
 
 	const float VelocityAlongNormal = FVector::DotProduct(RelativeVelocity, Normal);
@@ -124,7 +132,7 @@ void UObject::HandleBallCollision(UObject& OtherBall)
 	if (VelocityAlongNormal > 0) return;
 
 	// 충격량 계산
-	const float e = min(BounceFactor, OtherBall.BounceFactor);  // 반발 계수를 둘중 더 작은걸로 설정
+	const float e = std::min(BounceFactor, OtherBall.BounceFactor);  // 반발 계수를 둘중 더 작은걸로 설정
 	float j = -(1 + e) * VelocityAlongNormal;
 	j /= 1 / Mass + 1 / OtherBall.Mass;
 
@@ -143,7 +151,7 @@ void UObject::HandleBallCollision(UObject& OtherBall)
 		float JT = -FVector::DotProduct(RelativeVelocity, Tangent);  // 접선 방향 상대 속도에 기반한 충격량 크기
 		JT /= 1 / Mass + 1 / OtherBall.Mass;                               // 두 물체의 유효 질량
 
-		const float MuT = min(Friction, OtherBall.Friction);
+		const float MuT = std::min(Friction, OtherBall.Friction);
 		FVector FrictionImpulse;
 		if (fabsf(JT) < j * MuT)
 		{
@@ -4,11 +4,20 @@
 
 #include "Enum.h"
 #include "Core/Math/Vector.h"
+#include "Core/Math/Vector4.h"
 
-namespace DirectX
+/**
+ * 렌더링에 필요한 오브젝트 상태만 복사해 둔 값
+ * 시뮬레이션 스레드가 채우고 렌더 쪽에서 읽는다.
+ */
+struct FObjectRenderState
 {
-	struct XMFLOAT4;
-}
+	FVector Location;
+	FVector Rotation;
+	float Radius = 0.0f;
+	unsigned int UUID = 0;
+	EPrimitiveType PrimitiveType = EPrimitiveType::EPT_Cube;
+};
 
 class UObject
 {
@@ -28,6 +37,8 @@ public:
 	float Friction = 0.01f;      // 마찰 계수
 	float BounceFactor = 0.85f;  // 반발 계수
 
+	EPrimitiveType PrimitiveType = EPrimitiveType::EPT_Cube;
+
 	bool   bApplyGravity = false;
 	static float Gravity;
 
@@ -40,11 +51,19 @@ public:
 	void Update(float DeltaTime);
 
 	void FixedUpdate(float FixedTime);
+
+	FObjectRenderState GetRenderState() const;
 	
 	void UpdateConstantView(const class URenderer& Renderer, const class UCamera& Camera) const;
 
-	void UpdateConstantUUID(const URenderer& Renderer, DirectX::XMFLOAT4 UUIDColor) const;
+	void UpdateConstantUUID(const URenderer& Renderer, const FVector4& UUIDColor) const;
 	void HandleWallCollision(const FVector& WallNormal);
 
 	void HandleBallCollision(UObject& OtherBall);
+
+	/**
+	 * 충돌 법선을 미리 구해 둔 경우
+	 * @param Normal 이 공에서 OtherBall로 향하는 단위 벡터
+	 */
+	void HandleBallCollision(UObject& OtherBall, const FVector& Normal);
 };
@@ -4,6 +4,9 @@
 
 #include "PrimitiveVertices.h"
 #include "UObject.h"
+#include "Core/Math/VectorKernels.h"
+#include "Core/Memory/MemoryAllocInfo.h"
+#include "Core/Profiler/Profiler.h"
 
 /** Renderer를 초기화 합니다. */
 void URenderer::Create(HWND hWindow)
@@ -69,6 +72,8 @@ void URenderer::CreateShader()
     ID3DBlob* VertexShaderCSO;
     ID3DBlob* PixelShaderCSO;
     ID3DBlob* UIDShaderCSO;
+    ID3DBlob* ImpostorVertexShaderCSO;
+    ID3DBlob* ImpostorPixelShaderCSO;
     
     // 셰이더 컴파일 및 생성
     D3DCompileFromFile(L"Shaders/ShaderW0.hlsl", nullptr, nullptr, "mainVS", "vs_5_0", 0, 0, &VertexShaderCSO, nullptr);
@@ -80,6 +85,12 @@ void URenderer::CreateShader()
     D3DCompileFromFile(L"Shaders/ShaderW0.hlsl", nullptr, nullptr, "UUIDPS", "ps_5_0", 0, 0, &UIDShaderCSO, nullptr);
     Device->CreatePixelShader(UIDShaderCSO->GetBufferPointer(), UIDShaderCSO->GetBufferSize(), nullptr, &UIDPixelShader);
 
+    D3DCompileFromFile(L"Shaders/SphereImpostor.hlsl", nullptr, nullptr, "mainVS", "vs_5_0", 0, 0, &ImpostorVertexShaderCSO, nullptr);
+    Device->CreateVertexShader(ImpostorVertexShaderCSO->GetBufferPointer(), ImpostorVertexShaderCSO->GetBufferSize(), nullptr, &ImpostorVertexShader);
+
+    D3DCompileFromFile(L"Shaders/SphereImpostor.hlsl", nullptr, nullptr, "mainPS", "ps_5_0", 0, 0, &ImpostorPixelShaderCSO, nullptr);
+    Device->CreatePixelShader(ImpostorPixelShaderCSO->GetBufferPointer(), ImpostorPixelShaderCSO->GetBufferSize(), nullptr, &ImpostorPixelShader);
+
     // 입력 레이아웃 정의 및 생성
     D3D11_INPUT_ELEMENT_DESC Layout[] =
     {
@@ -94,10 +105,13 @@ void URenderer::CreateShader()
     };
 
     Device->CreateInputLayout(Layout, ARRAYSIZE(Layout), VertexShaderCSO->GetBufferPointer(), VertexShaderCSO->GetBufferSize(), &SimpleInputLayout);
+    Device->CreateInputLayout(Layout, ARRAYSIZE(Layout), ImpostorVertexShaderCSO->GetBufferPointer(), ImpostorVertexShaderCSO->GetBufferSize(), &ImpostorInputLayout);
 
     VertexShaderCSO->Release();
     PixelShaderCSO->Release();
     UIDShaderCSO->Release();
+    ImpostorVertexShaderCSO->Release();
+    ImpostorPixelShaderCSO->Release();
 
     // 정점 하나의 크기를 설정 (바이트 단위)
     Stride = sizeof(FVertexSimple);
@@ -127,6 +141,24 @@ void URenderer::ReleaseShader()
         UIDPixelShader->Release();
         UIDPixelShader = nullptr;
     }
+
+    if (ImpostorInputLayout)
+    {
+        ImpostorInputLayout->Release();
+        ImpostorInputLayout = nullptr;
+    }
+
+    if (ImpostorPixelShader)
+    {
+        ImpostorPixelShader->Release();
+        ImpostorPixelShader = nullptr;
+    }
+
+    if (ImpostorVertexShader)
+    {
+        ImpostorVertexShader->Release();
+        ImpostorVertexShader = nullptr;
+    }
 }
 
 void URenderer::CreateConstantBuffer()
@@ -137,6 +169,7 @@ void URenderer::CreateConstantBuffer()
     ConstantBufferDescView.ByteWidth = sizeof(FMatrixConstants) + 0xf & 0xfffffff0;  // 16byte의 배수로 올림
     ConstantBufferDescView.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;            // CPU에서 쓰기 접근이 가능하게 설정
     Device->CreateBuffer(&ConstantBufferDescView, nullptr, &ConstantWorldBuffer);
+    FrameConstantsCameraVersion = 0;
 
     
     D3D11_BUFFER_DESC ConstantBufferDesc = {};
@@ -297,12 +330,13 @@ void URenderer::RenderPickingTexture()
 void URenderer::ClearMatrix()
 {
     InstanceData.clear();
+    BatchBuilder.Reset();
 }
 
-ID3D11Buffer* URenderer::CreateVertexBuffer(const FVertexSimple* Vertices, UINT MaxInstanceCount)
+ID3D11Buffer* URenderer::CreateVertexBuffer(const FVertexSimple* Vertices, UINT ByteWidth)
 {
     D3D11_BUFFER_DESC VertexBufferDesc = {};
-    VertexBufferDesc.ByteWidth = MaxInstanceCount;
+    VertexBufferDesc.ByteWidth = ByteWidth;
     VertexBufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
     VertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 
@@ -316,6 +350,37 @@ ID3D11Buffer* URenderer::CreateVertexBuffer(const FVertexSimple* Vertices, UINT
         return nullptr;
     }
 
+    return VertexBuffer;
+}
+
+void URenderer::CreatePrimitiveBuffers(UINT InMaxInstanceCount)
+{
+    MEMORY_TAG_SCOPE(Renderer);
+
+    struct FPrimitiveSource
+    {
+        const FVertexSimple* Vertices;
+        UINT NumVertices;
+    };
+
+    // EPrimitiveType 순서와 동일해야 함
+    const FPrimitiveSource Sources[] = {
+        { TriangleVertices, ARRAYSIZE(TriangleVertices) },
+        { CubeVertices, ARRAYSIZE(CubeVertices) },
+        { SphereVertices, ARRAYSIZE(SphereVertices) },
+    };
+    static_assert(ARRAYSIZE(Sources) == static_cast<int>(EPrimitiveType::EPT_Max));
+
+    for (int i = 0; i < static_cast<int>(EPrimitiveType::EPT_Max); ++i)
+    {
+        PrimitiveVertexBuffers[i] = CreateVertexBuffer(Sources[i].Vertices, sizeof(FVertexSimple) * Sources[i].NumVertices);
+        PrimitiveVertexCounts[i] = Sources[i].NumVertices;
+    }
+
+    ImpostorQuadBuffer = CreateVertexBuffer(ImpostorQuadVertices, sizeof(ImpostorQuadVertices));
+
+    MaxInstanceCount = InMaxInstanceCount;
+
     D3D11_BUFFER_DESC ibDesc = { };
     ibDesc.Usage = D3D11_USAGE_DYNAMIC;
     ibDesc.ByteWidth = sizeof(FMVP) * MaxInstanceCount; //InstanceCount만큼
@@ -323,57 +388,335 @@ ID3D11Buffer* URenderer::CreateVertexBuffer(const FVertexSimple* Vertices, UINT
     ibDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
     Device->CreateBuffer(&ibDesc, nullptr, &pInstanceBuffer);
-    
-    return VertexBuffer;
 }
 
-void URenderer::RenderInstance(ID3D11Buffer* VertexBuffer)
+void URenderer::ReleasePrimitiveBuffers()
 {
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    for (ID3D11Buffer*& Buffer : PrimitiveVertexBuffers)
+    {
+        if (Buffer)
+        {
+            Buffer->Release();
+            Buffer = nullptr;
+        }
+    }
 
-    FMVP* arr = new FMVP[InstanceData.size()];
-    std::copy(InstanceData.begin(), InstanceData.end(), arr);
-    
-    DeviceContext->Map(pInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-    FMVP* pData = reinterpret_cast<FMVP*>(mappedResource.pData);
-    // for (int i=0;i<InstanceData.size(); i++)
-    // {
-    //     pData[i] = InstanceData[i];
-    // }
-    memcpy(pData, arr, InstanceData.size() * sizeof(FMVP));
-    
-    DeviceContext->Unmap(pInstanceBuffer, 0);
-    
-    UINT strides[] = { 12 + 16, sizeof(FMVP)  };
+    if (ImpostorQuadBuffer)
+    {
+        ImpostorQuadBuffer->Release();
+        ImpostorQuadBuffer = nullptr;
+    }
+
+    if (pInstanceBuffer)
+    {
+        pInstanceBuffer->Release();
+        pInstanceBuffer = nullptr;
+    }
+}
+
+void URenderer::BindShader(ID3D11DeviceContext* Context, EShaderType Shader) const
+{
+    switch (Shader)
+    {
+    case EShaderType::EST_SphereImpostor:
+        Context->VSSetShader(ImpostorVertexShader, nullptr, 0);
+        Context->PSSetShader(ImpostorPixelShader, nullptr, 0);
+        Context->IASetInputLayout(ImpostorInputLayout);
+        Context->PSSetConstantBuffers(0, 1, &ConstantWorldBuffer);
+        break;
+    case EShaderType::EST_Simple:
+    default:
+        Context->VSSetShader(SimpleVertexShader, nullptr, 0);
+        Context->PSSetShader(SimplePixelShader, nullptr, 0);
+        Context->IASetInputLayout(SimpleInputLayout);
+        break;
+    }
+}
+
+void URenderer::BindPipelineState(ID3D11DeviceContext* Context) const
+{
+    // Deferred Context는 기본 상태에서 시작하므로 Prepare()에서 설정한 상태를 다시 잡아줌
+    Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    Context->RSSetViewports(1, &ViewportInfo);
+    Context->RSSetState(RasterizerState);
+    Context->OMSetBlendState(nullptr, nullptr, 0xffffffff);
+    Context->OMSetDepthStencilState(MainDepthStencilState, 0);
+    Context->OMSetRenderTargets(1, &FrameBufferRTV, DepthStencilView);
+
+    if (ConstantWorldBuffer)
+    {
+        Context->VSSetConstantBuffers(0, 1, &ConstantWorldBuffer);
+    }
+}
+
+void URenderer::DrawBatch(ID3D11DeviceContext* Context, const FDrawBatch& Batch) const
+{
+    // 임포스터는 프리미티브와 무관하게 사각형 하나를 그림
+    const int PrimitiveIndex = static_cast<int>(Batch.Primitive);
+    const bool bImpostor = Batch.Shader == EShaderType::EST_SphereImpostor;
+    ID3D11Buffer* VertexBuffer = bImpostor ? ImpostorQuadBuffer : PrimitiveVertexBuffers[PrimitiveIndex];
+    const UINT VertexCount = bImpostor ? ARRAYSIZE(ImpostorQuadVertices) : PrimitiveVertexCounts[PrimitiveIndex];
+
+    UINT strides[] = { sizeof(FVertexSimple), sizeof(FMVP) };
     UINT offsets[] = { 0, 0 };
     ID3D11Buffer* buffers[] = { VertexBuffer, pInstanceBuffer };
+    Context->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+
+    Context->DrawInstanced(VertexCount, Batch.InstanceCount, 0, Batch.InstanceOffset);
+}
+
+void URenderer::RenderInstance()
+{
+    PROFILE_SCOPE("RenderInstance");
+    MEMORY_TAG_SCOPE(Renderer);
+
+    BatchBuilder.Build();
+
+    // 인스턴스 버퍼 용량을 넘는 부분은 잘라냄
+    const UINT NumInstances = BatchBuilder.ClampBatches(MaxInstanceCount, DrawBatches);
+    if (NumInstances == 0)
+    {
+        return;
+    }
+
+    const bool bParallel = bMultithreadedRecording && RecordTaskPool && !Recorders.empty();
+
+    // 정렬된 순서대로 공유 인스턴스 버퍼에 한 번만 업로드
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    DeviceContext->Map(pInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+    FMVP* pData = static_cast<FMVP*>(mappedResource.pData);
+    if (bParallel)
+    {
+        const uint32 NumRanges = RecordTaskPool->GetNumThreads();
+        const UINT PerRange = (NumInstances + NumRanges - 1) / NumRanges;
+        RecordTaskPool->ParallelFor(NumRanges, [this, pData, PerRange, NumInstances](uint32 Range)
+        {
+            const UINT Begin = Range * PerRange;
+            const UINT End = min(Begin + PerRange, NumInstances);
+            for (UINT i = Begin; i < End; ++i)
+            {
+                pData[i] = InstanceData[BatchBuilder.GetSourceIndex(i)];
+            }
+        });
+    }
+    else
+    {
+        for (UINT i = 0; i < NumInstances; ++i)
+        {
+            pData[i] = InstanceData[BatchBuilder.GetSourceIndex(i)];
+        }
+    }
+    DeviceContext->Unmap(pInstanceBuffer, 0);
+
+    if (bParallel)
+    {
+        CommandSubmitter.Submit(*this, *RecordTaskPool, DrawBatches);
+        return;
+    }
 
-    DeviceContext->IASetVertexBuffers(0, 2, buffers, strides, offsets);
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    DeviceContext->DrawInstanced(ARRAYSIZE(CubeVertices), ObjCount, 0, 0);
 
-    delete[] arr;
+    EShaderType BoundShader = EShaderType::EST_Max;
+    for (const FDrawBatch& Batch : DrawBatches)
+    {
+        if (Batch.Shader != BoundShader)
+        {
+            BindShader(DeviceContext, Batch.Shader);
+            BoundShader = Batch.Shader;
+        }
+        DrawBatch(DeviceContext, Batch);
+    }
 }
 
-void URenderer::UpdateInstance(UObject Target, UCamera Camera, int index)
+void URenderer::CreateDeferredContexts(uint32 NumContexts)
 {
-    DirectX::XMMATRIX ScaleMatrix = DirectX::XMMatrixScalingFromVector(CastVecToXMV(FVector(Target.Radius,Target.Radius,Target.Radius)));
-    DirectX::XMMATRIX RotationMatrix = DirectX::XMMatrixRotationRollPitchYawFromVector(CastVecToXMV(Target.Rotation));
-    DirectX::XMMATRIX TranslationMatrix = DirectX::XMMatrixTranslationFromVector(CastVecToXMV(Target.Location));
+    MEMORY_TAG_SCOPE(Renderer);
 
-    DirectX::XMMATRIX WorldMatrix = TranslationMatrix * RotationMatrix * ScaleMatrix;
+    RecordTaskPool = std::make_unique<FTaskPool>(NumContexts > 1 ? NumContexts - 1 : 1);
 
-    FVector CamForwardVec = Camera.Location + Camera.GetForward();
-    
-    DirectX::XMMATRIX ViewMatrix = DirectX::XMMatrixLookAtLH(CastVecToXMV(Camera.Location), CastVecToXMV(CamForwardVec), CastVecToXMV(Camera.UpVector));
+    Recorders.resize(NumContexts);
+    for (FD3D11CommandRecorder& Recorder : Recorders)
+    {
+        Recorder.Renderer = this;
+        Device->CreateDeferredContext(0, &Recorder.Context);
+    }
+}
 
-    DirectX::XMMATRIX ProjMatrix = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV4, 1, 0.1f, 100.0f);
+void URenderer::ReleaseDeferredContexts()
+{
+    for (FD3D11CommandRecorder& Recorder : Recorders)
+    {
+        if (Recorder.CommandList)
+        {
+            Recorder.CommandList->Release();
+            Recorder.CommandList = nullptr;
+        }
+        if (Recorder.Context)
+        {
+            Recorder.Context->Release();
+            Recorder.Context = nullptr;
+        }
+    }
+    Recorders.clear();
+    RecordTaskPool.reset();
+}
+
+uint32 URenderer::GetNumRecorders() const
+{
+    return static_cast<uint32>(Recorders.size());
+}
+
+IRenderCommandRecorder& URenderer::GetRecorder(uint32 Index)
+{
+    return Recorders[Index];
+}
+
+void URenderer::ExecuteRecorded(uint32 Index)
+{
+    FD3D11CommandRecorder& Recorder = Recorders[Index];
+    if (Recorder.CommandList)
+    {
+        // 재생 후에도 Immediate Context 상태(ImGui 등)가 유지되도록 복원
+        DeviceContext->ExecuteCommandList(Recorder.CommandList, TRUE);
+        Recorder.CommandList->Release();
+        Recorder.CommandList = nullptr;
+    }
+}
+
+void FD3D11CommandRecorder::BeginRecording()
+{
+    Renderer->BindPipelineState(Context);
+    BoundShader = EShaderType::EST_Max;
+}
+
+void FD3D11CommandRecorder::RecordBatch(const FDrawBatch& Batch)
+{
+    if (Batch.Shader != BoundShader)
+    {
+        Renderer->BindShader(Context, Batch.Shader);
+        BoundShader = Batch.Shader;
+    }
+    Renderer->DrawBatch(Context, Batch);
+}
+
+void FD3D11CommandRecorder::FinishRecording()
+{
+    Context->FinishCommandList(FALSE, &CommandList);
+}
+
+FOcclusionStats URenderer::CullOccludedObjects(const FObjectRenderState* Objects, int Count, const UCamera& Camera, std::vector<uint8>& OutVisible)
+{
+    PROFILE_SCOPE("OcclusionCulling");
+    MEMORY_TAG_SCOPE(Renderer);
+
+    // 메시 로컬 공간 기준 (감싸는 반지름, 안쪽 반지름), EPrimitiveType 순서
+    // 삼각형은 두께가 없어서 오클루더로 쓰지 않음
+    constexpr float MeshBounds[][2] = {
+        { 0.71f, 0.0f },
+        { 0.87f, 0.5f },
+        { 1.0f, 0.95f },
+    };
+    static_assert(ARRAYSIZE(MeshBounds) == static_cast<int>(EPrimitiveType::EPT_Max));
+
+    if (OcclusionCameraVersion != Camera.GetVersion())
+    {
+        OcclusionCuller.SetProjection(Camera.GetFovY(), Camera.GetAspectRatio(), Camera.GetNearZ());
+        OcclusionCameraVersion = Camera.GetVersion();
+    }
+
+    OcclusionSpheres.resize(Count);
+    OutVisible.resize(Count);
+    OcclusionCenters.resize(static_cast<size_t>(Count) * 6);
+
+    const size_t Num = static_cast<size_t>(Count);
+    const auto Channel = [this, Num](int Index) { return std::span(OcclusionCenters.data() + Num * Index, Num); };
+    const FVectorSpan WorldCenters{ Channel(0), Channel(1), Channel(2) };
+    const FVectorSpan ViewCenters{ Channel(3), Channel(4), Channel(5) };
+
+    // 원점을 월드 행렬로 옮긴 위치는 월드 행렬의 마지막 행
+    for (int i = 0; i < Count; ++i)
+    {
+        const FVector4 Center = MakeWorldMatrix(Objects[i]).GetRow(3);
+        WorldCenters.X[i] = Center.X;
+        WorldCenters.Y[i] = Center.Y;
+        WorldCenters.Z[i] = Center.Z;
+    }
+
+    // 뷰 변환은 아핀이라 열마다 내적 한 번과 이동 성분 더하기로 끝남
+    const FMatrix& ViewMatrix = Camera.GetViewMatrix();
+    const FMatrix ViewColumns = ViewMatrix.Transpose();
+    VectorKernels::DotN(WorldCenters, ViewColumns.GetRow(0).ToVector(), ViewCenters.X);
+    VectorKernels::DotN(WorldCenters, ViewColumns.GetRow(1).ToVector(), ViewCenters.Y);
+    VectorKernels::DotN(WorldCenters, ViewColumns.GetRow(2).ToVector(), ViewCenters.Z);
+
+    for (int i = 0; i < Count; ++i)
+    {
+        const FObjectRenderState& Target = Objects[i];
+        const float* Bounds = MeshBounds[static_cast<int>(Target.PrimitiveType)];
+
+        FOcclusionSphere& Sphere = OcclusionSpheres[i];
+        Sphere.X = ViewCenters.X[i] + ViewMatrix.M[3][0];
+        Sphere.Y = ViewCenters.Y[i] + ViewMatrix.M[3][1];
+        Sphere.Z = ViewCenters.Z[i] + ViewMatrix.M[3][2];
+        Sphere.Radius = Bounds[0] * Target.Radius;
+        Sphere.OccluderRadius = Bounds[1] * Target.Radius;
+    }
 
-    DirectX::XMMATRIX MVP = XMMatrixTranspose((WorldMatrix * ViewMatrix * ProjMatrix));
+    return OcclusionCuller.Cull(OcclusionSpheres.data(), static_cast<uint32>(Count), OutVisible.data());
+}
+
+FMatrix URenderer::MakeWorldMatrix(const FObjectRenderState& Target) const
+{
+    FMatrix ScaleMatrix = FMatrix::MakeScale(Target.Radius);
+    FMatrix RotationMatrix = FMatrix::MakeRotation(Target.Rotation);
+    FMatrix TranslationMatrix = FMatrix::MakeTranslation(Target.Location);
+
+    return TranslationMatrix * RotationMatrix * ScaleMatrix;
+}
+
+void URenderer::UpdateFrameConstants(const UCamera& Camera) const
+{
+    if (!ConstantWorldBuffer) return;
+
+    // 카메라가 그대로면 버퍼에 이미 같은 값이 있음
+    if (FrameConstantsCameraVersion == Camera.GetVersion()) return;
+    FrameConstantsCameraVersion = Camera.GetVersion();
+
+    D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR;
+    DeviceContext->Map(ConstantWorldBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &ConstantBufferMSR);
+    {
+        FMatrixConstants* Constants = static_cast<FMatrixConstants*>(ConstantBufferMSR.pData);
+        Constants->World = FMatrix::Identity();
+        Constants->View = Camera.GetViewMatrix().Transpose();
+        Constants->Proj = Camera.GetProjectionMatrix().Transpose();
+    }
+    DeviceContext->Unmap(ConstantWorldBuffer, 0);
+}
+
+void URenderer::UpdateInstance(const FObjectRenderState& Target, const UCamera& Camera, int index)
+{
+    MEMORY_TAG_SCOPE(Renderer);
+
+    FMatrix WorldMatrix = MakeWorldMatrix(Target);
+
+    if (bUseSphereImpostor && Target.PrimitiveType == EPrimitiveType::EPT_Sphere)
+    {
+        // 임포스터는 행렬 대신 첫 행에 뷰 공간 중심과 반지름을 담는다 (SphereImpostor.hlsl 참고)
+        const FVector Center = Camera.GetViewMatrix().TransformPosition(WorldMatrix.GetRow(3).ToVector());
+
+        FMVP M;
+        M.MVP.SetRow(0, FVector4(Center, Target.Radius));
+
+        BatchBuilder.AddInstance(EShaderType::EST_SphereImpostor, Target.PrimitiveType, static_cast<uint32>(InstanceData.size()));
+        InstanceData.push_back(M);
+        return;
+    }
+
+    FMatrix MVP = (WorldMatrix * Camera.GetViewProjectionMatrix()).Transpose();
 
     FMVP M(MVP);
 
-    //
+    BatchBuilder.AddInstance(EShaderType::EST_Simple, Target.PrimitiveType, static_cast<uint32>(InstanceData.size()));
     InstanceData.push_back(M);
 }
 
@@ -383,31 +726,26 @@ void URenderer::ReleaseVertexBuffer(ID3D11Buffer* pBuffer) const
     pBuffer->Release();
 }
 
-void URenderer::UpdateConstantView(UObject Target, UCamera Camera) const
+void URenderer::UpdateConstantView(UObject Target, const UCamera& Camera) const
 {
     if (!ConstantWorldBuffer) return;
 
-    D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR;
-
-    DirectX::XMMATRIX ScaleMatrix = DirectX::XMMatrixScalingFromVector(CastVecToXMV(FVector(Target.Radius,Target.Radius,Target.Radius)));
-    DirectX::XMMATRIX RotationMatrix = DirectX::XMMatrixRotationRollPitchYawFromVector(CastVecToXMV(Target.Rotation));
-    DirectX::XMMATRIX TranslationMatrix = DirectX::XMMatrixTranslationFromVector(CastVecToXMV(Target.Location));
+    // 프레임 상수를 덮어쓰므로 다음 UpdateFrameConstants는 다시 채워야 함
+    FrameConstantsCameraVersion = 0;
 
-    DirectX::XMMATRIX WorldMatrix = TranslationMatrix * RotationMatrix * ScaleMatrix;
-
-    FVector CamForwardVec = Camera.Location + Camera.GetForward();
-    
-    DirectX::XMMATRIX ViewMatrix = DirectX::XMMatrixLookAtLH(CastVecToXMV(Camera.Location), CastVecToXMV(CamForwardVec), CastVecToXMV(Camera.UpVector));
+    D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR;
 
-    DirectX::XMMATRIX ProjMatrix = DirectX::XMMatrixPerspectiveFovLH(DirectX::XM_PIDIV4, 1, 0.1f, 100.0f);
+    FMatrix WorldMatrix = MakeWorldMatrix(Target.GetRenderState());
+    const FMatrix& ViewMatrix = Camera.GetViewMatrix();
+    const FMatrix& ProjMatrix = Camera.GetProjectionMatrix();
 
     
     DeviceContext->Map(ConstantWorldBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &ConstantBufferMSR);
     {
         FMatrixConstants* Constants = static_cast<FMatrixConstants*>(ConstantBufferMSR.pData);
-        Constants->World = DirectX::XMMatrixTranspose(WorldMatrix);
-        Constants->View = DirectX::XMMatrixTranspose(ViewMatrix);
-        Constants->Proj = DirectX::XMMatrixTranspose(ProjMatrix);
+        Constants->World = WorldMatrix.Transpose();
+        Constants->View = ViewMatrix.Transpose();
+        Constants->Proj = ProjMatrix.Transpose();
     }
     DeviceContext->Unmap(ConstantWorldBuffer, 0);
 }
@@ -428,6 +766,17 @@ void URenderer::UpdateConstantUUID(DirectX::XMFLOAT4 UUIDColor) const
     DeviceContext->Unmap(ConstantUUIDBuffer, 0);
 }
 
+// UObject.cpp가 렌더러 없이 빌드되도록 렌더러를 부르는 UObject 함수는 여기에 둠
+void UObject::UpdateConstantView(const URenderer& Renderer, const UCamera& Camera) const
+{
+    Renderer.UpdateConstantView(*this, Camera);
+}
+
+void UObject::UpdateConstantUUID(const URenderer& Renderer, const FVector4& UUIDColor) const
+{
+    Renderer.UpdateConstantUUID(DirectX::XMFLOAT4(UUIDColor.X, UUIDColor.Y, UUIDColor.Z, UUIDColor.W));
+}
+
 // void URenderer::CreateDeviceAndSwapChain(HWND hWindow) //멀티샘플링 활성화
 // {
 //     // 지원하는 Direct3D 기능 레벨을 정의
@@ -729,10 +1078,9 @@ void URenderer::CreateDepthStencilBuffer(FVector WindowSize)
     DepthStencilDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
     DepthStencilDesc.DepthFunc = D3D11_COMPARISON_LESS;
 
-    ID3D11DepthStencilState* DepthStencilState;
-    Device->CreateDepthStencilState(&DepthStencilDesc, &DepthStencilState);
+    Device->CreateDepthStencilState(&DepthStencilDesc, &MainDepthStencilState);
 
-    DeviceContext->OMSetDepthStencilState(DepthStencilState, 0);
+    DeviceContext->OMSetDepthStencilState(MainDepthStencilState, 0);
 }
 
 void URenderer::ReleaseDepthStencilBuffer()
@@ -742,4 +1090,10 @@ void URenderer::ReleaseDepthStencilBuffer()
         DepthStencilView->Release();
         DepthStencilView = nullptr;
     }
+
+    if (MainDepthStencilState)
+    {
+        MainDepthStencilState->Release();
+        MainDepthStencilState = nullptr;
+    }
 }
\ No newline at end of file
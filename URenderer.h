@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Enum.h"
 #include "Source/Core/Math/Vector.h"
+#include "Core/Math/Matrix.h"
 
 #pragma comment(lib, "user32")
 #pragma comment(lib, "d3d11")
@@ -8,13 +9,38 @@
 #include <d3d11.h>
 #include <d3dcompiler.h>
 #include <DirectXMath.h>
+#include <memory>
 #include <vector>
 
+#include "OcclusionCuller.h"
+#include "RenderBatch.h"
+#include "RenderCommand.h"
+#include "Core/Async/TaskPool.h"
 #include "UCamera.h"
 #include "UObject.h"
 
-class URenderer
+/**
+ * D3D11 Deferred Context 하나에 배치 드로우를 기록하는 Recorder
+ */
+class FD3D11CommandRecorder : public IRenderCommandRecorder
 {
+public:
+    void BeginRecording() override;
+    void RecordBatch(const FDrawBatch& Batch) override;
+    void FinishRecording() override;
+
+    const class URenderer* Renderer = nullptr;
+    ID3D11DeviceContext* Context = nullptr;
+    ID3D11CommandList* CommandList = nullptr;
+
+private:
+    EShaderType BoundShader = EShaderType::EST_Max;
+};
+
+class URenderer : public IRenderDevice
+{
+    friend class FD3D11CommandRecorder;
+
 private:
     struct alignas(16) FUUIDConstants
     {
@@ -23,13 +49,13 @@ private:
 
     struct alignas(16) FMatrixConstants
     {
-        DirectX::XMMATRIX World;
-        DirectX::XMMATRIX View;
-        DirectX::XMMATRIX Proj;  
+        FMatrix World;
+        FMatrix View;
+        FMatrix Proj;
     };
 
     struct alignas(16) FMVP{
-        DirectX::XMMATRIX MVP;
+        FMatrix MVP;
     };
 
 public:
@@ -77,25 +103,67 @@ public:
     /**
      * 정점 데이터로 Vertex Buffer를 생성합니다.
      * @param Vertices 버퍼로 변환할 정점 데이터 배열의 포인터
-     * @param MaxInstanceCount 버퍼의 총 크기 (바이트 단위)
+     * @param ByteWidth 버퍼의 총 크기 (바이트 단위)
      * @return 생성된 버텍스 버퍼에 대한 ID3D11Buffer 포인터, 실패 시 nullptr
      *
      * @note 이 함수는 D3D11_USAGE_IMMUTABLE 사용법으로 버퍼를 생성합니다.
      */
-    ID3D11Buffer* CreateVertexBuffer(const FVertexSimple* Vertices, UINT MaxInstanceCount);
-    void RenderInstance(ID3D11Buffer* VertexBuffer);
-    void UpdateInstance(UObject Target, UCamera Camera, int index);
+    ID3D11Buffer* CreateVertexBuffer(const FVertexSimple* Vertices, UINT ByteWidth);
+
+    /**
+     * 모든 EPrimitiveType의 Vertex Buffer와 공유 인스턴스 버퍼를 생성합니다.
+     * @param InMaxInstanceCount 한 프레임에 그릴 수 있는 최대 인스턴스 수
+     */
+    void CreatePrimitiveBuffers(UINT InMaxInstanceCount);
+    void ReleasePrimitiveBuffers();
+
+    /**
+     * 프레임 단위 상수 버퍼(View, Proj)를 갱신합니다.
+     * 임포스터 셰이더가 투영과 노멀 변환에 사용하므로 RenderInstance 전에 호출해야 합니다.
+     * 카메라 버전이 지난번과 같으면 아무것도 하지 않습니다.
+     */
+    void UpdateFrameConstants(const UCamera& Camera) const;
+
+    /**
+     * 이번 프레임에 쌓인 인스턴스를 배치별로 정렬해서 한 번에 업로드하고 그립니다.
+     * bMultithreadedRecording이 켜져 있으면 업로드와 드로우 기록을 워커 스레드에 나눠서 처리합니다.
+     */
+    void RenderInstance();
+
+    /**
+     * 멀티스레드 기록에 사용할 Deferred Context와 워커 스레드를 생성합니다.
+     * @param NumContexts Deferred Context 수 (= 병렬로 기록되는 명령 리스트 수)
+     */
+    void CreateDeferredContexts(uint32 NumContexts);
+    void ReleaseDeferredContexts();
+
+    // IRenderDevice
+    uint32 GetNumRecorders() const override;
+    IRenderCommandRecorder& GetRecorder(uint32 Index) override;
+    void ExecuteRecorded(uint32 Index) override;
+    void UpdateInstance(const FObjectRenderState& Target, const UCamera& Camera, int index);
+
+    /**
+     * CPU 오클루전 컬링으로 다른 공에 완전히 가려진 오브젝트를 찾습니다.
+     * @param Objects 검사할 오브젝트 상태 배열
+     * @param Count 오브젝트 수
+     * @param Camera 현재 카메라
+     * @param OutVisible Count 크기로 채워지며, 0이면 그리지 않아도 되는 오브젝트
+     * @return 컬링 통계 (컬링 비율 등)
+     */
+    FOcclusionStats CullOccludedObjects(const FObjectRenderState* Objects, int Count, const UCamera& Camera, std::vector<uint8>& OutVisible);
 
     /** Buffer를 해제합니다. */
     void ReleaseVertexBuffer(ID3D11Buffer* pBuffer) const;
     
-    void UpdateConstantView(UObject OriginTargetPos, UCamera Camera) const;
+    void UpdateConstantView(UObject OriginTargetPos, const UCamera& Camera) const;
     void UpdateConstantUUID(DirectX::XMFLOAT4 UUIDColor) const;
     void UpdateConstantPick(DirectX::XMFLOAT4 UUIDColor) const;
     DirectX::XMFLOAT4 GetPixel(FVector MPos);
 
     ID3D11Device* GetDevice() const { return Device; }
     ID3D11DeviceContext* GetDeviceContext() const { return DeviceContext; }
+    const D3D11_VIEWPORT& GetViewport() const { return ViewportInfo; }
     void PrepareLine();
 
     void ReleaseRasterizerState();
@@ -118,7 +186,16 @@ protected:
 
     /** 레스터라이저 상태를 해제합니다. */
 
-    DirectX::XMVECTOR CastVecToXMV(FVector Vec) const{ return DirectX::XMVectorSet(Vec.X, Vec.Y, Vec.Z, 1.0f); }
+    /** 배치에 해당하는 셰이더와 InputLayout을 바인딩합니다. */
+    void BindShader(ID3D11DeviceContext* Context, EShaderType Shader) const;
+
+    /** 인스턴스 드로우에 필요한 파이프라인 상태를 Context에 설정합니다. */
+    void BindPipelineState(ID3D11DeviceContext* Context) const;
+
+    /** 배치 하나를 Context에 그립니다. 셰이더는 미리 바인딩되어 있어야 합니다. */
+    void DrawBatch(ID3D11DeviceContext* Context, const FDrawBatch& Batch) const;
+
+    FMatrix MakeWorldMatrix(const FObjectRenderState& Target) const;
     
 protected:
     // Direct3D 11 장치(Device)와 장치 컨텍스트(Device Context) 및 스왑 체인(Swap Chain)을 관리하기 위한 포인터들
@@ -133,15 +210,33 @@ protected:
     ID3D11RenderTargetView* PickingFrameBufferRTV = nullptr;       // 텍스처를 렌더 타겟으로 사용하는 뷰
     ID3D11RasterizerState* RasterizerState = nullptr;       // 래스터라이저 상태(컬링, 채우기 모드 등 정의)
     ID3D11Buffer* ConstantWorldBuffer = nullptr;                 // 뷰 상수 버퍼
+    mutable uint64 FrameConstantsCameraVersion = 0;              // ConstantWorldBuffer에 들어 있는 카메라 버전, 0이면 없음
     ID3D11Buffer* ConstantUUIDBuffer = nullptr;                 // 뷰 상수 버퍼
 
-    ID3D11Buffer* pInstanceBuffer = nullptr;
+    ID3D11Buffer* pInstanceBuffer = nullptr;               // 모든 배치가 공유하는 인스턴스 버퍼
+    UINT MaxInstanceCount = 0;
+
+    ID3D11Buffer* PrimitiveVertexBuffers[static_cast<int>(EPrimitiveType::EPT_Max)] = {};
+    UINT PrimitiveVertexCounts[static_cast<int>(EPrimitiveType::EPT_Max)] = {};
 
     ID3D11DepthStencilView* DepthStencilView = nullptr;
     ID3D11DepthStencilState* DepthStencilState = nullptr;
+    ID3D11DepthStencilState* MainDepthStencilState = nullptr;
     ID3D11BlendState* BlendState = nullptr;
 
     std::vector<FMVP> InstanceData;
+    FRenderBatchBuilder BatchBuilder;
+    TArray<FDrawBatch> DrawBatches;
+
+    // 멀티스레드 명령 기록
+    std::vector<FD3D11CommandRecorder> Recorders;
+    std::unique_ptr<FTaskPool> RecordTaskPool;
+    FParallelCommandSubmitter CommandSubmitter;
+
+    FOcclusionCuller OcclusionCuller;
+    std::vector<FOcclusionSphere> OcclusionSpheres;
+    uint64 OcclusionCameraVersion = 0;    // OcclusionCuller에 투영을 넘긴 카메라 버전
+    std::vector<float> OcclusionCenters;  // 월드 공간 X, Y, Z 채널 뒤에 뷰 공간 X, Y, Z 채널, 채널마다 오브젝트 수만큼
     
     FLOAT PickingClearColor[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
     FLOAT ClearColor[4] = { 0.025f, 0.025f, 0.025f, 1.0f }; // 화면을 초기화(clear)할 때 사용할 색상 (RGBA)
@@ -153,7 +248,15 @@ protected:
     ID3D11PixelShader* UIDPixelShader = nullptr;         // Pixel의 색상을 결정하는 Pixel 셰이더
     ID3D11InputLayout* SimpleInputLayout = nullptr;         // Vertex 셰이더 입력 레이아웃 정의
 
+    // 구 임포스터 셰이더
+    ID3D11VertexShader* ImpostorVertexShader = nullptr;
+    ID3D11PixelShader* ImpostorPixelShader = nullptr;
+    ID3D11InputLayout* ImpostorInputLayout = nullptr;
+    ID3D11Buffer* ImpostorQuadBuffer = nullptr;
+
 public:
     int ObjCount = 1;
+    bool bUseSphereImpostor = false;                        // EPT_Sphere를 메시 대신 임포스터로 그림
+    bool bMultithreadedRecording = false;                   // Deferred Context로 드로우를 병렬 기록
     unsigned int Stride = 0;
 };
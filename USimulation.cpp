@@ -0,0 +1,380 @@
+﻿#include "USimulation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+#include "Core/Math/VectorKernels.h"
+#include "Core/Memory/MemoryAllocInfo.h"
+#include "Core/Profiler/Profiler.h"
+
+void FSimulationSnapshot::Interpolate(float Alpha, std::vector<FObjectRenderState>& OutStates) const
+{
+    PROFILE_SCOPE("Interpolate");
+
+    OutStates = Balls;
+    Interpolation.Interpolate(Alpha, OutStates.data());
+}
+
+USimulation::USimulation()
+{
+    ApplySettings();
+    CapturePreviousState();
+    PublishSnapshot(Settings.FixedTimeStep);
+}
+
+USimulation::~USimulation()
+{
+    StopThread();
+
+    for (UObject* Ball : Balls)
+    {
+        delete Ball;
+    }
+    Balls.Empty();
+}
+
+void USimulation::SetSettings(const FSimulationSettings& NewSettings)
+{
+    std::lock_guard Lock(SettingsMutex);
+    PendingSettings = NewSettings;
+    bSettingsDirty = true;
+}
+
+FSimulationSettings USimulation::GetSettings() const
+{
+    std::lock_guard Lock(SettingsMutex);
+    return PendingSettings;
+}
+
+void USimulation::Step(float TimeStep)
+{
+    PROFILE_SCOPE("Simulation Step");
+    MEMORY_TAG_SCOPE(Simulation);
+
+    ApplySettings();
+    CapturePreviousState();
+
+    for (UObject* Ball : Balls)
+    {
+        Ball->Update(TimeStep);
+        Ball->FixedUpdate(TimeStep);
+    }
+
+    if (Settings.bBallCollision)
+    {
+        ResolveBallCollisions();
+    }
+
+    SimulationTime += TimeStep;
+    StepCount.fetch_add(1, std::memory_order_relaxed);
+
+    PublishSnapshot(TimeStep);
+}
+
+void USimulation::Tick(float DeltaTime)
+{
+    Time.Advance(DeltaTime);
+
+    float TimeStep;
+    while (Time.ConsumeStep(TimeStep))
+    {
+        Step(TimeStep);
+    }
+}
+
+void USimulation::Reset(uint32 Seed)
+{
+    StopThread();
+
+    for (UObject* Ball : Balls)
+    {
+        delete Ball;
+    }
+    Balls.Empty();
+
+    // 공 배치는 UObject 생성자의 rand()로 정해지므로 시드를 고정하면 같은 배치가 나옴
+    srand(Seed);
+
+    SimulationTime = 0.0;
+    StepCount.store(0, std::memory_order_relaxed);
+    Time.Reset();
+    Time.ResetStats();
+    {
+        std::lock_guard Lock(SettingsMutex);
+        bSettingsDirty = true;
+    }
+
+    ApplySettings();
+    CapturePreviousState();
+    PublishSnapshot(Settings.FixedTimeStep);
+}
+
+uint64 USimulation::GetStateHash() const
+{
+    // FNV-1a, 같은 값이면 같은 비트이므로 float 비트를 그대로 섞음
+    uint64 Hash = 14695981039346656037ull;
+    auto Combine = [&Hash](const void* Data, size_t Size)
+    {
+        const uint8* Bytes = static_cast<const uint8*>(Data);
+        for (size_t i = 0; i < Size; ++i)
+        {
+            Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+        }
+    };
+    auto CombineVector = [&Combine](const FVector& Vector)
+    {
+        const float Components[3] = { Vector.X, Vector.Y, Vector.Z };
+        Combine(Components, sizeof(Components));
+    };
+
+    for (const UObject* Ball : Balls)
+    {
+        CombineVector(Ball->Location);
+        CombineVector(Ball->Velocity);
+        CombineVector(Ball->Rotation);
+    }
+    Combine(&SimulationTime, sizeof(SimulationTime));
+    return Hash;
+}
+
+void USimulation::StartThread()
+{
+    if (SimulationThread.joinable())
+    {
+        return;
+    }
+
+    bStopRequested = false;
+    SimulationThread = std::thread(&USimulation::ThreadMain, this);
+}
+
+void USimulation::StopThread()
+{
+    if (!SimulationThread.joinable())
+    {
+        return;
+    }
+
+    bStopRequested = true;
+    SimulationThread.join();
+
+    // 이후 Tick은 새로 시간을 쌓기 시작
+    Time.Reset();
+}
+
+const FSimulationSnapshot& USimulation::ConsumeSnapshot()
+{
+    Snapshots.Consume();
+    return Snapshots.GetReadBuffer();
+}
+
+float USimulation::GetInterpolationAlpha(const FSimulationSnapshot& Snapshot) const
+{
+    float Alpha;
+    if (IsThreaded())
+    {
+        const std::chrono::duration<float> SincePublish = std::chrono::steady_clock::now() - Snapshot.PublishTime;
+        Alpha = SincePublish.count() / Snapshot.TimeStep;
+    }
+    else
+    {
+        Alpha = Time.GetAlpha();
+    }
+    return std::clamp(Alpha, 0.0f, 1.0f);
+}
+
+void USimulation::ApplySettings()
+{
+    {
+        std::lock_guard Lock(SettingsMutex);
+        if (!bSettingsDirty)
+        {
+            return;
+        }
+        Settings = PendingSettings;
+        bSettingsDirty = false;
+    }
+
+    FTimeStepSettings TimeStepSettings = Time.GetSettings();
+    TimeStepSettings.FixedTimeStep = Settings.FixedTimeStep;
+    TimeStepSettings.MaxSubSteps = Settings.MaxSubSteps;
+    TimeStepSettings.bAdaptiveTimeStep = Settings.bAdaptiveTimeStep;
+    Time.SetSettings(TimeStepSettings);
+
+    UObject::Gravity = Settings.Gravity;
+    SetBallCount(Settings.NumBalls);
+
+    for (UObject* Ball : Balls)
+    {
+        ApplyBallSettings(Ball);
+    }
+}
+
+void USimulation::SetBallCount(int32 NumBalls)
+{
+    NumBalls = std::max(NumBalls, 1);
+
+    Balls.Reserve(NumBalls);
+    while (static_cast<int32>(Balls.Num()) < NumBalls)
+    {
+        UObject* Ball = new UObject;
+        ApplyBallSettings(Ball);
+        Balls.Add(Ball);
+    }
+
+    // 무작위로 골라서 제거, 순서는 상관없으므로 RemoveAtSwap
+    while (static_cast<int32>(Balls.Num()) > NumBalls)
+    {
+        const int32 IndexToRemove = rand() % static_cast<int32>(Balls.Num());
+        delete Balls[IndexToRemove];
+        Balls.RemoveAtSwap(IndexToRemove);
+    }
+}
+
+void USimulation::ApplyBallSettings(UObject* Ball) const
+{
+    Ball->bApplyGravity = Settings.bApplyGravity;
+    Ball->BounceFactor = Settings.BounceFactor;
+    Ball->Friction = Settings.Friction;
+    Ball->PrimitiveType = Settings.PrimitiveMode == static_cast<int32>(EPrimitiveType::EPT_Max)
+        ? static_cast<EPrimitiveType>(Ball->UUID % static_cast<unsigned int>(EPrimitiveType::EPT_Max))
+        : static_cast<EPrimitiveType>(Settings.PrimitiveMode);
+}
+
+void USimulation::ResolveBallCollisions()
+{
+    PROFILE_SCOPE("Ball Collision");
+
+    const size_t Num = Balls.Num();
+    CollisionX.resize(Num);
+    CollisionY.resize(Num);
+    CollisionZ.resize(Num);
+    CollisionRadius.resize(Num);
+    DeltaX.resize(Num);
+    DeltaY.resize(Num);
+    DeltaZ.resize(Num);
+    DistanceSq.resize(Num);
+    HitIndices.resize(Num);
+
+    for (size_t i = 0; i < Num; ++i)
+    {
+        CollisionX[i] = Balls[i]->Location.X;
+        CollisionY[i] = Balls[i]->Location.Y;
+        CollisionZ[i] = Balls[i]->Location.Z;
+        CollisionRadius[i] = Balls[i]->Radius;
+    }
+
+    // 공 i마다 뒤쪽 공들과의 거리를 한 번에 구하고, 겹친 쌍만 모아서 법선을 한 번에 정규화한다.
+    // 법선은 행을 시작할 때의 위치로 구하므로, 같은 행에서 앞선 충돌로 공 i가 밀려난 만큼은 반영되지 않는다.
+    for (size_t i = 0; i + 1 < Num; ++i)
+    {
+        const size_t Count = Num - i - 1;
+        for (size_t k = 0; k < Count; ++k)
+        {
+            DeltaX[k] = CollisionX[i + 1 + k] - CollisionX[i];
+            DeltaY[k] = CollisionY[i + 1 + k] - CollisionY[i];
+            DeltaZ[k] = CollisionZ[i + 1 + k] - CollisionZ[i];
+        }
+
+        const FVectorSpan Deltas{
+            std::span(DeltaX.data(), Count),
+            std::span(DeltaY.data(), Count),
+            std::span(DeltaZ.data(), Count)
+        };
+        VectorKernels::LengthSquaredN(Deltas, std::span(DistanceSq.data(), Count));
+
+        size_t NumHits = 0;
+        for (size_t k = 0; k < Count; ++k)
+        {
+            const float RadiusSum = CollisionRadius[i] + CollisionRadius[i + 1 + k];
+            if (DistanceSq[k] <= RadiusSum * RadiusSum)
+            {
+                DeltaX[NumHits] = DeltaX[k];
+                DeltaY[NumHits] = DeltaY[k];
+                DeltaZ[NumHits] = DeltaZ[k];
+                HitIndices[NumHits] = static_cast<uint32>(i + 1 + k);
+                ++NumHits;
+            }
+        }
+        if (NumHits == 0)
+        {
+            continue;
+        }
+
+        VectorKernels::NormalizeN({
+            std::span(DeltaX.data(), NumHits),
+            std::span(DeltaY.data(), NumHits),
+            std::span(DeltaZ.data(), NumHits)
+        });
+
+        UObject* Ball = Balls[i];
+        for (size_t Hit = 0; Hit < NumHits; ++Hit)
+        {
+            const uint32 j = HitIndices[Hit];
+            UObject* OtherBall = Balls[j];
+            Ball->HandleBallCollision(*OtherBall, FVector(DeltaX[Hit], DeltaY[Hit], DeltaZ[Hit]));
+
+            // 겹침 해결로 밀려난 위치를 다음 행에 반영
+            CollisionX[j] = OtherBall->Location.X;
+            CollisionY[j] = OtherBall->Location.Y;
+            CollisionZ[j] = OtherBall->Location.Z;
+        }
+        CollisionX[i] = Ball->Location.X;
+        CollisionY[i] = Ball->Location.Y;
+        CollisionZ[i] = Ball->Location.Z;
+    }
+}
+
+void USimulation::CapturePreviousState()
+{
+    // 공 수 변경은 ApplySettings에서 끝났으므로 여기서 맞춘 크기가 이번 스텝 동안 유지됨
+    FInterpolationBuffer& Interpolation = Snapshots.GetWriteBuffer().Interpolation;
+    Interpolation.Resize(static_cast<uint32>(Balls.Num()));
+    for (uint32 i = 0; i < Interpolation.Num(); ++i)
+    {
+        Interpolation.SetPrevious(i, Balls[i]->Location, Balls[i]->Rotation);
+    }
+}
+
+void USimulation::PublishSnapshot(float TimeStep)
+{
+    FSimulationSnapshot& Snapshot = Snapshots.GetWriteBuffer();
+    Snapshot.Balls.resize(Balls.Num());
+    for (size_t i = 0; i < Balls.Num(); ++i)
+    {
+        Snapshot.Balls[i] = Balls[i]->GetRenderState();
+        Snapshot.Interpolation.SetCurrent(static_cast<uint32>(i), Balls[i]->Location, Balls[i]->Rotation);
+    }
+    Snapshot.StepIndex = GetStepCount();
+    Snapshot.SimulationTime = SimulationTime;
+    Snapshot.TimeStep = TimeStep;
+    Snapshot.PublishTime = std::chrono::steady_clock::now();
+    Snapshot.TimeStats = Time.GetStats();
+
+    Snapshots.Publish();
+}
+
+void USimulation::ThreadMain()
+{
+    PROFILE_THREAD_NAME("Simulation");
+
+    Time.Reset();
+    while (!bStopRequested)
+    {
+        Time.Tick();
+
+        float TimeStep;
+        while (Time.ConsumeStep(TimeStep))
+        {
+            Step(TimeStep);
+        }
+
+        // 다음 스텝만큼 시간이 쌓일 때까지 대기
+        const float WaitTime = Time.GetCurrentTimeStep() - Time.GetAccumulator();
+        if (WaitTime > 0.0f)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<float>(WaitTime));
+        }
+    }
+}
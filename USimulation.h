@@ -0,0 +1,142 @@
+﻿#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "InterpolationBuffer.h"
+#include "UObject.h"
+#include "Core/Async/TripleBuffer.h"
+#include "Core/Container/Array.h"
+#include "Core/Time/Clock.h"
+#include "Core/Time/TimeManager.h"
+
+/**
+ * UI에서 바꿀 수 있는 시뮬레이션 설정
+ * 시뮬레이션 스레드는 다음 스텝 시작 시점에 한 번에 적용한다.
+ */
+struct FSimulationSettings
+{
+    int32 NumBalls = 1;
+    bool bApplyGravity = false;
+    float Gravity = 9.81f;
+    float BounceFactor = 0.85f;
+    float Friction = 0.01f;
+    int32 PrimitiveMode = static_cast<int32>(EPrimitiveType::EPT_Cube);  // EPT_Max면 UUID 별로 섞음
+    float FixedTimeStep = 1.0f / 60.0f;
+    uint32 MaxSubSteps = 8;            // 프레임당 최대 스텝 수
+    bool bAdaptiveTimeStep = false;    // 부하가 걸리면 스텝 크기를 늘림
+    bool bBallCollision = false;       // 공끼리 충돌, 모든 쌍을 검사하므로 O(N^2)
+};
+
+/**
+ * 시뮬레이션 스텝 하나가 끝난 시점의 공 상태
+ * 스텝 직전 상태도 같이 담고 있어서 렌더링 시점에 두 스텝 사이를 보간할 수 있다.
+ */
+struct FSimulationSnapshot
+{
+    std::vector<FObjectRenderState> Balls;  // 스텝 직후 상태
+    FInterpolationBuffer Interpolation;     // 스텝 직전/직후 Location, Rotation
+    uint64 StepIndex = 0;
+    double SimulationTime = 0.0;
+    float TimeStep = 1.0f / 60.0f;          // 이번 스텝의 길이
+    std::chrono::steady_clock::time_point PublishTime;
+    FTimeStats TimeStats;                   // 스냅샷을 공개한 시점의 시간 통계
+
+    /**
+     * 직전 스텝과 이번 스텝 사이를 보간한 공 상태를 만듭니다.
+     * @param Alpha 0이면 직전 스텝, 1이면 이번 스텝
+     * @param OutStates 공 수만큼 크기가 맞춰짐
+     */
+    void Interpolate(float Alpha, std::vector<FObjectRenderState>& OutStates) const;
+};
+
+/**
+ * 공 시뮬레이션
+ * 고정 스텝으로 공을 갱신하고, 스텝마다 스냅샷을 Triple Buffer로 렌더 쪽에 공개한다.
+ * StartThread로 전용 스레드에서 돌리거나, Tick으로 호출 스레드에서 직접 돌릴 수 있다.
+ */
+class USimulation
+{
+public:
+    USimulation();
+    ~USimulation();
+
+    USimulation(const USimulation&) = delete;
+    USimulation& operator=(const USimulation&) = delete;
+
+    /** 스레드 안전, 다음 스텝부터 적용됩니다. */
+    void SetSettings(const FSimulationSettings& NewSettings);
+    FSimulationSettings GetSettings() const;
+
+    /** 스텝 하나를 진행하고 스냅샷을 공개합니다. 시뮬레이션 스레드(또는 Tick)에서만 호출 */
+    void Step(float TimeStep);
+
+    /**
+     * 스레드를 쓰지 않을 때 호출 스레드에서 DeltaTime만큼 시뮬레이션을 진행합니다.
+     * 프레임당 스텝 수는 FSimulationSettings::MaxSubSteps로 제한됨
+     */
+    void Tick(float DeltaTime);
+
+    void StartThread();
+    void StopThread();
+    bool IsThreaded() const { return SimulationThread.joinable(); }
+
+    /**
+     * 렌더 스레드 전용: 가장 최근에 공개된 스냅샷을 가져옵니다.
+     * 새 스냅샷이 없으면 이전에 가져온 것을 그대로 돌려줍니다.
+     */
+    const FSimulationSnapshot& ConsumeSnapshot();
+
+    /**
+     * 렌더 스레드 전용: Snapshot을 그릴 때 사용할 보간 비율 [0, 1]
+     * Tick으로 돌릴 때는 남은 누적 시간, 스레드로 돌릴 때는 Snapshot이 공개된 뒤 흐른 시간을 스텝 길이로 나눈 값
+     */
+    float GetInterpolationAlpha(const FSimulationSnapshot& Snapshot) const;
+
+    /** 지금까지 진행된 스텝 수 (어느 스레드에서든 읽을 수 있음) */
+    uint64 GetStepCount() const { return StepCount.load(std::memory_order_relaxed); }
+
+    /**
+     * 공을 모두 지우고 Seed로 다시 만들어서 처음 상태로 돌립니다. 스레드가 돌고 있으면 멈춤
+     * 같은 Seed와 설정에서 같은 DeltaTime으로 Tick하면 항상 같은 상태가 나옴
+     */
+    void Reset(uint32 Seed);
+
+    /** 공 상태(위치, 속도, 회전)와 시뮬레이션 시간의 해시, 스레드를 쓰지 않을 때만 호출 */
+    uint64 GetStateHash() const;
+
+private:
+    void ApplySettings();
+    void SetBallCount(int32 NumBalls);
+    void ApplyBallSettings(UObject* Ball) const;
+    void ResolveBallCollisions();
+    void CapturePreviousState();
+    void PublishSnapshot(float TimeStep);
+    void ThreadMain();
+
+private:
+    TArray<UObject*> Balls;
+    FSimulationSettings Settings;          // 시뮬레이션 쪽에서 사용하는 설정
+    double SimulationTime = 0.0;
+
+    // ResolveBallCollisions에서 쓰는 SoA 작업 공간, 스텝마다 재사용
+    std::vector<float> CollisionX, CollisionY, CollisionZ, CollisionRadius;
+    std::vector<float> DeltaX, DeltaY, DeltaZ, DistanceSq;
+    std::vector<uint32> HitIndices;
+
+    FPlatformClock Clock;
+    FTimeManager Time{ &Clock };           // 시뮬레이션 스레드(또는 Tick 호출 스레드)만 접근
+
+    mutable std::mutex SettingsMutex;
+    FSimulationSettings PendingSettings;   // UI 쪽에서 쓰는 설정
+    bool bSettingsDirty = true;
+
+    TTripleBuffer<FSimulationSnapshot> Snapshots;
+    std::atomic<uint64> StepCount = 0;
+
+    std::thread SimulationThread;
+    std::atomic<bool> bStopRequested = false;
+};
@@ -1,4 +1,7 @@
-﻿#include <iostream>
+﻿#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
 #include <memory>
 #include <Windows.h>
 
@@ -8,10 +11,20 @@
 #include "ImGui/imgui_impl_dx11.h"
 
 #include "Enum.h"
+#include "InputRecording.h"
 #include "InputSystem.h"
 #include "URenderer.h"
 #include "PrimitiveVertices.h"
 #include "UObject.h"
+#include "USimulation.h"
+#include "ProfilerPanel.h"
+#include "Benchmark/BenchmarkMain.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/MemoryAllocInfo.h"
+#include "Core/Profiler/Profiler.h"
+#include "Core/Time/Clock.h"
+#include "Core/Time/FramePacer.h"
+#include "Core/Time/TimeManager.h"
 
 DirectX::XMFLOAT4 EncodeUUID(unsigned int UUID)
 {
@@ -25,11 +38,49 @@ DirectX::XMFLOAT4 EncodeUUID(unsigned int UUID)
 	return color;
 }
 
+/** ImGui는 operator new 대신 malloc을 쓰므로 할당 함수를 바꿔서 ImGui 태그로 셈 */
+void* ImGuiMemAlloc(size_t Size, void*)
+{
+	return FMemoryAllocInfo::Allocate(Size, alignof(std::max_align_t), EMemoryTag::ImGui);
+}
+
+void ImGuiMemFree(void* Ptr, void*)
+{
+	FMemoryAllocInfo::Free(Ptr);
+}
+
 int DecodeUUID(DirectX::XMFLOAT4 f)
 {
 	return (static_cast<unsigned int>(f.w)<<24) | (static_cast<unsigned int>(f.z)<<16) | (static_cast<unsigned int>(f.y)<<8) | (static_cast<unsigned int>(f.x));
 }
 
+/** 이 프로그램을 띄운 콘솔이 있으면 거기에, 없으면 새 콘솔을 열어서 표준 출력을 연결 */
+void AttachParentConsole()
+{
+	if (!AttachConsole(ATTACH_PARENT_PROCESS))
+	{
+		AllocConsole();
+	}
+	freopen_s((FILE**)stdout, "CONOUT$", "w", stdout);
+}
+
+/** 창을 만들지 않고 콘솔에서 벤치마크만 실행, 이 프로그램을 띄운 콘솔이 있으면 거기에 출력 */
+int RunBenchmarkMode(int Argc, wchar_t** Argv)
+{
+	AttachParentConsole();
+
+	std::vector<std::string> Args;
+	for (int i = 2; i < Argc; ++i)
+	{
+		const int Length = WideCharToMultiByte(CP_UTF8, 0, Argv[i], -1, nullptr, 0, nullptr, nullptr);
+		std::string Arg(Length > 0 ? Length - 1 : 0, '\0');
+		WideCharToMultiByte(CP_UTF8, 0, Argv[i], -1, Arg.data(), Length, nullptr, nullptr);
+		Args.push_back(Arg);
+	}
+
+	return RunBenchmarkMain(Args);
+}
+
 FVector GetWndWH(HWND hWnd)
 {
 	RECT Rect;
@@ -61,7 +112,7 @@ void HandleMouseMove()
 	if (GetCursorPos(&Pts))
 	{
 		FVector PtV = FVector(Pts.x , Pts.y, 0);
-		InputSystem::Get().SetMousePos(PtV);
+		InputSystem::Get().MouseMove(PtV);
 	}
 }
 
@@ -108,9 +159,6 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
     return 0;
 }
 
-float UObject::Gravity = 9.81f;
-unsigned int UObject::UUID_GEN = 0;
-
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLine, int nShowCmd)
 {
 #pragma region Init Window
@@ -119,6 +167,34 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
     UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
+	// -bench [out.json] ... 로 실행하면 벤치마크만 돌리고 종료
+	if (__argc >= 2 && wcscmp(__wargv[1], L"-bench") == 0)
+	{
+		return RunBenchmarkMode(__argc, __wargv);
+	}
+
+	// -record <file> [-seed N]: 입력을 녹화하고 창을 닫을 때 저장
+	// -replay <file>: 녹화한 입력을 같은 고정 스텝으로 재생하고, 끝나면 상태 해시를 출력하고 종료
+	std::filesystem::path RecordPath;
+	std::filesystem::path ReplayPath;
+	uint32 RandomSeed = 1;
+	for (int i = 1; i + 1 < __argc; ++i)
+	{
+		if (wcscmp(__wargv[i], L"-record") == 0)
+		{
+			RecordPath = __wargv[++i];
+		}
+		else if (wcscmp(__wargv[i], L"-replay") == 0)
+		{
+			ReplayPath = __wargv[++i];
+		}
+		else if (wcscmp(__wargv[i], L"-seed") == 0)
+		{
+			RandomSeed = static_cast<uint32>(wcstoul(__wargv[++i], nullptr, 10));
+		}
+	}
+	const bool bDeterministic = !RecordPath.empty() || !ReplayPath.empty();
+
     // 윈도우 클래스 이름 및 타이틀 이름
     constexpr WCHAR WndClassName[] = L"DX11 Test Window Class";
     constexpr WCHAR WndTitle[] = L"DX11 Test Window";
@@ -136,7 +212,15 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
         nullptr, nullptr, hInstance, nullptr
     );
 #pragma endregion Init Window
-	AllocConsole(); // 콘솔 창 생성
+	// 녹화/재생 결과는 실행한 쪽 콘솔에서 받아 볼 수 있도록 부모 콘솔에 붙음
+	if (bDeterministic)
+	{
+		AttachParentConsole();
+	}
+	else
+	{
+		AllocConsole(); // 콘솔 창 생성
+	}
 
 	// 표준 출력 및 입력을 콘솔과 연결
 	freopen_s((FILE**)stdout, "CONOUT$", "w", stdout);
@@ -147,6 +231,23 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	SetWindowPos(consoleWindow, 0, 1100, 200, 0, 0, SWP_NOSIZE | SWP_NOZORDER);
 	
 	std::cout << "Debug Console Opened!" << '\n';
+
+	FInputRecording InputRecording;
+	if (!ReplayPath.empty() && !InputRecording.Load(ReplayPath))
+	{
+		std::cout << "Failed to load replay: " << ReplayPath.string() << std::endl;
+		FreeConsole();
+		return 1;
+	}
+
+	// 워커 스레드가 생기기 전에 프로파일러 초기화
+	FProfiler::Get();
+	PROFILE_THREAD_NAME("Main");
+
+	// 최근 프레임들의 프로파일 결과를 모아서 패널로 보여줌
+	FProfilerHistory ProfilerHistory(FProfiler::Get().GetSecondsPerTick());
+	FProfilerPanel ProfilerPanel;
+	bool bShowProfilerPanel = false;
 #pragma region Init Renderer & ImGui
     // 렌더러 초기화
     URenderer Renderer;
@@ -154,8 +255,10 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
     Renderer.CreateShader();
     Renderer.CreateConstantBuffer();
 	Renderer.CreateDepthStencilBuffer(GetWndWH(hWnd));
+	Renderer.CreateDeferredContexts(4);
 	// ImGui 초기화
     IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(ImGuiMemAlloc, ImGuiMemFree);
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
@@ -167,7 +270,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 #pragma endregion Init Renderer & ImGui
 
 #pragma region Create Vertex Buffer
-	ID3D11Buffer* VertexBufferSphere = Renderer.CreateVertexBuffer(CubeVertices, 100000);
+	Renderer.CreatePrimitiveBuffers(100000);
 
 	// ID3D11Buffer* VertexBufferAxisX = Renderer.CreateVertexBuffer(AxisXVertices, sizeof(AxisXVertices));
 	// ID3D11Buffer* VertexBufferAxisY = Renderer.CreateVertexBuffer(AxisYVertices, sizeof(AxisYVertices));
@@ -176,103 +279,160 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 
     // FPS 제한
     constexpr int TargetFPS = 60;
-    constexpr double TargetDeltaTime = 1000.0f / TargetFPS; // 1 FPS의 목표 시간 (ms)
 
     // 고성능 타이머 초기화
-    LARGE_INTEGER Frequency;
-    QueryPerformanceFrequency(&Frequency);
+    FPlatformClock MainClock;
+    FFramePacer FramePacer(MainClock, 1.0 / TargetFPS);
+
+    // 녹화/재생 중에는 실제 시간 대신 프레임마다 FrameTime씩 가는 시계를 써서 매번 같은 스텝이 나오게 함
+    const double FrameTime = ReplayPath.empty() ? 1.0 / TargetFPS : InputRecording.GetFrameTime();
+    FFakeClock FrameClock;
+    const IClock* UpdateClock = bDeterministic ? static_cast<const IClock*>(&FrameClock) : &MainClock;
 
-    LARGE_INTEGER StartTime;
-    QueryPerformanceCounter(&StartTime);
+    // Fixed Update에 사용되는 시간 관리자 (프레임당 스텝 수 제한)
+    FTimeManager FixedTime(UpdateClock);
 
-    float Accumulator = 0.0; // Fixed Update에 사용되는 값
-    constexpr float FixedTimeStep = 1.0f / TargetFPS;
+	// 입력 이벤트 시각도 같은 시계로 잼
+	InputSystem::Get().SetClock(UpdateClock);
 	
-	// UBalls 배열
-	int ArrSize = 1;
-	int ArrCap = 4;
-	UObject** Balls = new UObject*[ArrCap];
-	Balls[0] = new UObject;
+	// 공 시뮬레이션 (UI에서는 설정만 바꾸고, 렌더링은 스냅샷으로 함)
+	USimulation Simulation;
+	FSimulationSettings SimulationSettings = Simulation.GetSettings();
+	bool bThreadedSimulation = false;
+	int PhysicsHz = 60;
+
+	// 재생은 녹화할 때의 시드와 설정으로 처음부터 다시 시작, 시뮬레이션은 스레드 없이 프레임마다 Tick
+	if (!ReplayPath.empty())
+	{
+		const std::span<const uint8> RecordedSettings = InputRecording.GetUserData();
+		if (RecordedSettings.size() == sizeof(FSimulationSettings))
+		{
+			memcpy(&SimulationSettings, RecordedSettings.data(), sizeof(FSimulationSettings));
+			PhysicsHz = static_cast<int>(std::lround(1.0f / SimulationSettings.FixedTimeStep));
+		}
+		Simulation.SetSettings(SimulationSettings);
+		Simulation.Reset(InputRecording.GetRandomSeed());
+		InputSystem::Get().StartReplay(&InputRecording);
+	}
+	else if (!RecordPath.empty())
+	{
+		InputRecording.Reset(static_cast<float>(FrameTime), RandomSeed);
+		InputRecording.SetUserData({ reinterpret_cast<const uint8*>(&SimulationSettings), sizeof(FSimulationSettings) });
+		Simulation.Reset(RandomSeed);
+		InputSystem::Get().StartRecording(&InputRecording);
+	}
+
+	// 두 고정 스텝 사이를 보간한 렌더링용 공 상태
+	bool bInterpolation = true;
+	std::vector<FObjectRenderState> RenderStates;
 
-	Renderer.ObjCount = 1;
+	// 초당 시뮬레이션 스텝 수 측정
+	uint64 LastStepCount = 0;
+	float StepRateTimer = 0.0f;
+	float SimulationStepRate = 0.0f;
+
+	Renderer.ObjCount = SimulationSettings.NumBalls;
 
 	std::unique_ptr<UObject> zeroObject = std::make_unique<UObject>();
 	zeroObject->Location = FVector(0, 0, 0);
 	zeroObject->Scale = FVector(1, 1, 1);
 	zeroObject->Rotation = FVector(0, 0, 0);
 	
+	// 오클루전 컬링
+	bool bOcclusionCulling = true;
+	std::vector<uint8> VisibleMask;
+	FOcclusionStats OcclusionStats;
+	
 	std::unique_ptr<UCamera> Camera = std::make_unique<UCamera>();
 	// Camera->SetCameraPosition(FVector(0, 0, -5));
+	Camera->SetViewport(Renderer.GetViewport().Width, Renderer.GetViewport().Height);
 	std::unique_ptr<InputHandler> Input = std::make_unique<InputHandler>();
 	
 	// Main Loop
     bool bIsExit = false;
     while (bIsExit == false)
     {
-        // DeltaTime 계산 (초 단위)
-        const LARGE_INTEGER EndTime = StartTime;
-        QueryPerformanceCounter(&StartTime);
+    	PROFILE_SCOPE("Frame");
 
-        const float DeltaTime =
-            static_cast<float>(StartTime.QuadPart - EndTime.QuadPart) / static_cast<float>(Frequency.QuadPart);
-		
-        // 누적 시간 추가
-        Accumulator += DeltaTime;
+    	// 지난 프레임의 임시 메모리를 한꺼번에 되돌림
+    	FFrameArena::Get().Reset();
+    	FMemoryAllocInfo::BeginFrame();
 
-    	InputSystem::Get().ExpireOnceMouse();
-    	
-        // 메시지(이벤트) 처리
-        MSG msg;
-        while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
-        {
-            // 키 입력 메시지를 번역
-            TranslateMessage(&msg);
+    	ProfilerHistory.Update(FProfiler::Get());
 
-            // 메시지를 등록한 Proc에 전달
-            DispatchMessage(&msg);
+    	if (bDeterministic)
+    	{
+    		FrameClock.Advance(FrameTime);
+    	}
 
-            if (msg.message == WM_QUIT)
-            {
-                bIsExit = true;
-                break;
-            }
-        }
+        // DeltaTime 계산 (초 단위) 및 누적 시간 추가
+        const float DeltaTime = FixedTime.Tick();
 
-    	
-		// Update 로직
-		Input->InputUpdate(Camera.get());
-		HandleMouseMove();
-    	
-		for (int i = 0; i < ArrSize; ++i)
-		{
-			Balls[i]->Update(DeltaTime);
-		}
+    	{
+    		PROFILE_SCOPE("Input");
+    		MEMORY_TAG_SCOPE(Input);
+
+	        // 메시지(이벤트) 처리
+	        MSG msg;
+	        while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+	        {
+	            // 키 입력 메시지를 번역
+	            TranslateMessage(&msg);
+
+	            // 메시지를 등록한 Proc에 전달
+	            DispatchMessage(&msg);
+
+	            if (msg.message == WM_QUIT)
+	            {
+	                bIsExit = true;
+	                break;
+	            }
+	        }
+
+			// 이번 프레임에 쌓인 입력 이벤트를 한꺼번에 적용
+			HandleMouseMove();
+			InputSystem::Get().ProcessEvents();
+
+			// Update 로직
+			Input->InputUpdate(Camera.get());
+    	}
     	
     	// FixedTimeStep 만큼 업데이트
-    	while (Accumulator >= FixedTimeStep)
+    	float TimeStep;
+    	while (FixedTime.ConsumeStep(TimeStep))
     	{
-			Camera->FixedUpdate(DeltaTime);
-    		
-    		for (int i = 0; i < ArrSize; ++i)
-    		{
-				Balls[i]->FixedUpdate(FixedTimeStep);
-    		}
-
-    		// 공 충돌 처리
-    		// for (int i = 0; i < ArrSize; ++i)
-    		// {
-    		// 	for (int j = i + 1; j < ArrSize; ++j)
-    		// 	{
-    		// 		if (UObject::CheckCollision(*Balls[i], *Balls[j]))
-    		// 		{
-    		// 			Balls[i]->HandleBallCollision(*Balls[j]);
-    		// 		}
-    		// 	}
-    		// }
-
-    		Accumulator -= FixedTimeStep;
+    		PROFILE_SCOPE("FixedUpdate");
+			Camera->FixedUpdate(TimeStep);
     	}
 
+    	// 스레드를 쓰지 않으면 여기서 직접 시뮬레이션을 진행
+    	if (!Simulation.IsThreaded())
+    	{
+    		PROFILE_SCOPE("Simulation");
+    		Simulation.Tick(DeltaTime);
+    	}
+
+    	// 녹화의 마지막 프레임까지 시뮬레이션했으면 종료
+    	if (InputSystem::Get().IsReplayFinished())
+    	{
+    		bIsExit = true;
+    	}
+
+    	StepRateTimer += DeltaTime;
+    	if (StepRateTimer >= 1.0f)
+    	{
+    		const uint64 StepCount = Simulation.GetStepCount();
+    		SimulationStepRate = static_cast<float>(StepCount - LastStepCount) / StepRateTimer;
+    		LastStepCount = StepCount;
+    		StepRateTimer = 0.0f;
+    	}
+
+    	// 가장 최근에 끝난 시뮬레이션 스텝의 공 상태
+    	const FSimulationSnapshot& Snapshot = Simulation.ConsumeSnapshot();
+    	const float InterpolationAlpha = bInterpolation ? Simulation.GetInterpolationAlpha(Snapshot) : 1.0f;
+    	Snapshot.Interpolate(InterpolationAlpha, RenderStates);
+    	const int NumBalls = static_cast<int>(RenderStates.size());
+
         // 렌더링 준비 작업
     	//기본적으로 해줘야하는거
         Renderer.Prepare();
@@ -285,7 +445,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
     	// 	Renderer.PreparePicking();
     	// 	Renderer.PreparePickingShader();
 	    //
-    	// 	for (int i = 0; i < ArrSize; ++i)
+    	// 	for (int i = 0; i < NumBalls; ++i)
     	// 	{
     	// 		Balls[i]->UpdateConstantView(Renderer, *Camera);
     	// 		Balls[i]->UpdateConstantUUID(Renderer, EncodeUUID(Balls[i]->UUID));
@@ -299,13 +459,26 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 
     	Renderer.PrepareMain();
     	Renderer.PrepareMainShader();
-    	for (int i = 0; i < ArrSize; ++i)
+    	Renderer.UpdateFrameConstants(*Camera);
+    	OcclusionStats = FOcclusionStats();
+    	if (bOcclusionCulling)
     	{
-    		Renderer.UpdateInstance(*Balls[i], *Camera, i);
-    		// Balls[i]->UpdateConstantView(Renderer, *Camera );
-    		// Renderer.RenderPrimitive(VertexBufferSphere, ARRAYSIZE(SphereVertices));
+    		OcclusionStats = Renderer.CullOccludedObjects(RenderStates.data(), NumBalls, *Camera, VisibleMask);
     	}
-    	Renderer.RenderInstance(VertexBufferSphere);
+    	{
+    		PROFILE_SCOPE("UpdateInstance");
+	    	for (int i = 0; i < NumBalls; ++i)
+	    	{
+	    		if (bOcclusionCulling && VisibleMask[i] == 0)
+	    		{
+	    			continue;
+	    		}
+	    		Renderer.UpdateInstance(RenderStates[i], *Camera, i);
+	    		// Balls[i]->UpdateConstantView(Renderer, *Camera );
+	    		// Renderer.RenderPrimitive(VertexBufferSphere, ARRAYSIZE(SphereVertices));
+	    	}
+    	}
+    	Renderer.RenderInstance();
     	
     	if (InputSystem::Get().GetMouseDown(false))
     	{
@@ -340,35 +513,95 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 
         ImGui::Begin("DX11 Property Window");
         {
+        	PROFILE_SCOPE("ImGui Build");
+
             ImGui::Text("Hello, World!");
         	ImGui::Text("FPS: %.3f", ImGui::GetIO().Framerate);
-        	ImGui::Text("Size: %d, Capacity: %d", ArrSize, ArrCap);
-        	if (ImGui::Checkbox("Gravity", &Balls[0]->bApplyGravity))
+        	const FFramePacerStats& PacerStats = FramePacer.GetStats();
+        	ImGui::Text("Frame: %.3f ms, Jitter: %.3f ms, Max Error: %.3f ms", PacerStats.MeanFrameTime * 1000.0, PacerStats.FrameTimeJitter * 1000.0, PacerStats.MaxFrameTimeError * 1000.0);
+        	ImGui::Text("Sleep: %.3f ms, Spin: %.3f ms", PacerStats.LastSleepTime * 1000.0, PacerStats.LastSpinTime * 1000.0);
+        	ImGui::Text("Balls: %d, Simulation: %.1f steps/s", NumBalls, SimulationStepRate);
+        	const FFrameArena& FrameArena = FFrameArena::Get();
+        	ImGui::Text("Frame Arena: %.1f KB (Peak %.1f KB / %.1f KB)", FrameArena.GetLastFrameBytes() / 1024.0, FrameArena.GetHighWaterMark() / 1024.0, FrameArena.GetCapacity() / 1024.0);
+        	if (FMemoryAllocInfo::IsEnabled())
         	{
-        		for (int i = 1; i < ArrSize; ++i)
-        		{
-        			Balls[i]->bApplyGravity = Balls[0]->bApplyGravity;
-        		}
+        		const FMemoryTagStats MemoryStats = FMemoryAllocInfo::GetTotalStats();
+        		ImGui::Text("Heap: %.1f MB (Sampled Peak %.1f MB), Allocs/Frame: %llu", MemoryStats.LiveBytes / (1024.0 * 1024.0), MemoryStats.SampledPeakBytes / (1024.0 * 1024.0), MemoryStats.FrameAllocations);
+        	}
+        	bool bProfilerEnabled = FProfiler::Get().IsEnabled();
+        	if (ImGui::Checkbox("Profiler", &bProfilerEnabled))
+        	{
+        		FProfiler::Get().SetEnabled(bProfilerEnabled);
+        	}
+        	ImGui::SameLine();
+        	if (ImGui::Button("Export Trace"))
+        	{
+        		FProfiler::Get().ExportChromeTrace("ProfileTrace.json");
+        	}
+        	ImGui::SameLine();
+        	ImGui::Checkbox("Profiler Panel", &bShowProfilerPanel);
+        	if (InputSystem::Get().IsReplaying())
+        	{
+        		ImGui::Text("Replay: %u / %u frames", InputSystem::Get().GetReplayFrame(), InputRecording.NumFrames());
         	}
-        	if (Balls[0]->bApplyGravity)
+        	else if (!RecordPath.empty())
         	{
-        		ImGui::SliderFloat("Gravity Factor", &UObject::Gravity, -20.0f, 20.0f);
+        		ImGui::Text("Recording: %u frames, %u events", InputRecording.NumFrames(), InputRecording.NumEvents());
         	}
 
-        	if (ImGui::SliderFloat("Bounce Factor", &Balls[0]->BounceFactor, 0.0f, 1.0f))
+        	// 녹화/재생 중에는 녹화되지 않는 UI 조작으로 상태가 달라지지 않도록 막음
+        	ImGui::BeginDisabled(bDeterministic);
+        	if (ImGui::Checkbox("Threaded Simulation", &bThreadedSimulation))
         	{
-        		for (int i = 1; i < ArrSize; ++i)
+        		if (bThreadedSimulation)
         		{
-        			Balls[i]->BounceFactor = Balls[0]->BounceFactor;
+        			Simulation.StartThread();
         		}
-        	}
-        	if (ImGui::SliderFloat("Friction", &Balls[0]->Friction, 0.0f, 1.0f))
-        	{
-        		for (int i = 1; i < ArrSize; ++i)
+        		else
         		{
-        			Balls[i]->Friction = Balls[0]->Friction;
+        			Simulation.StopThread();
         		}
         	}
+        	ImGui::EndDisabled();
+        	ImGui::Checkbox("Interpolation", &bInterpolation);
+        	ImGui::Checkbox("Occlusion Culling", &bOcclusionCulling);
+        	ImGui::Checkbox("Sphere Impostor", &Renderer.bUseSphereImpostor);
+        	ImGui::Checkbox("Multithreaded Recording", &Renderer.bMultithreadedRecording);
+        	if (bOcclusionCulling)
+        	{
+        		ImGui::Text("Occluders: %u, Culled: %u (%.1f%%)", OcclusionStats.NumOccluders, OcclusionStats.NumCulled, OcclusionStats.GetCulledRatio() * 100.0f);
+        	}
+
+        	// 바뀐 설정은 시뮬레이션의 다음 스텝에서 한 번에 적용됨
+        	ImGui::BeginDisabled(bDeterministic);
+        	bool bSettingsChanged = false;
+        	if (ImGui::SliderInt("Physics Hz", &PhysicsHz, 10, 120))
+        	{
+        		SimulationSettings.FixedTimeStep = 1.0f / static_cast<float>(PhysicsHz);
+        		bSettingsChanged = true;
+        	}
+        	int MaxSubSteps = static_cast<int>(SimulationSettings.MaxSubSteps);
+        	if (ImGui::SliderInt("Max Substeps", &MaxSubSteps, 1, 16))
+        	{
+        		SimulationSettings.MaxSubSteps = static_cast<uint32>(MaxSubSteps);
+        		bSettingsChanged = true;
+        	}
+        	bSettingsChanged |= ImGui::Checkbox("Adaptive Time Step", &SimulationSettings.bAdaptiveTimeStep);
+        	const FTimeStats& SimulationTimeStats = Snapshot.TimeStats;
+        	ImGui::Text("Step: %.1f ms, Steps/Frame: %u", SimulationTimeStats.CurrentTimeStep * 1000.0f, SimulationTimeStats.FrameSteps);
+        	ImGui::Text("Dropped: %.3f s (%llu frames)", SimulationTimeStats.DroppedTime, SimulationTimeStats.NumThrottledFrames);
+        	bSettingsChanged |= ImGui::Checkbox("Gravity", &SimulationSettings.bApplyGravity);
+        	if (SimulationSettings.bApplyGravity)
+        	{
+        		bSettingsChanged |= ImGui::SliderFloat("Gravity Factor", &SimulationSettings.Gravity, -20.0f, 20.0f);
+        	}
+
+        	bSettingsChanged |= ImGui::SliderFloat("Bounce Factor", &SimulationSettings.BounceFactor, 0.0f, 1.0f);
+        	bSettingsChanged |= ImGui::SliderFloat("Friction", &SimulationSettings.Friction, 0.0f, 1.0f);
+        	bSettingsChanged |= ImGui::Checkbox("Ball Collision", &SimulationSettings.bBallCollision);
+
+        	const char* PrimitiveNames[] = { "Triangle", "Cube", "Sphere", "Mixed" };
+        	bSettingsChanged |= ImGui::Combo("Primitive", &SimulationSettings.PrimitiveMode, PrimitiveNames, IM_ARRAYSIZE(PrimitiveNames));
 
         	ImGui::SliderFloat("CameraX", &Camera->Location.X, -10.0f, 10.0f);
         	ImGui::SliderFloat("CameraY", &Camera->Location.Y, -10.0f, 10.0f);
@@ -381,72 +614,67 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
         	if (ImGui::InputInt("Number of Ball", &Renderer.ObjCount))
         	{
         		Renderer.ObjCount = max(Renderer.ObjCount, 1);
-        		const int Diff = Renderer.ObjCount - ArrSize;
-        		if (Diff > 0)
-		        {
-			        if (Renderer.ObjCount > ArrCap)
-			        {
-			        	int NewCap = Renderer.ObjCount > ArrCap * 2
-			        		? static_cast<int>(static_cast<float>(Renderer.ObjCount) * 1.5f)
-			        		: ArrCap * 2;
-
-			        	UObject** NewBalls = new UObject*[NewCap];
-			        	for (int i = 0; i < ArrSize; ++i)
-			        	{
-			        		NewBalls[i] = Balls[i];
-			        	}
-			        	delete[] Balls;
-			        	ArrCap = NewCap;
-			        	Balls = NewBalls;
-			        }
-
-			        for (int i = 0; i < Diff; ++i)
-			        {
-			        	UObject* Ball = new UObject;
-			        	Ball->bApplyGravity = Balls[0]->bApplyGravity;
-				        Balls[ArrSize + i] = Ball;
-			        }
-        			ArrSize = Renderer.ObjCount;
-		        }
-		        else if (Diff < 0)
-        		{
-		        	for (int i = 0; i < -Diff; ++i)
-		        	{
-		        		int IndexToRemove = rand() % ArrSize;
-		        		delete Balls[IndexToRemove];
-		        		Balls[IndexToRemove] = Balls[ArrSize - 1];
-		        		ArrSize--;
-		        	}
-        		}
+        		SimulationSettings.NumBalls = Renderer.ObjCount;
+        		bSettingsChanged = true;
         	}
+
+        	if (bSettingsChanged)
+        	{
+        		Simulation.SetSettings(SimulationSettings);
+        	}
+        	ImGui::EndDisabled();
         }
         ImGui::End();
 
+        if (bShowProfilerPanel)
+        {
+        	ProfilerPanel.Draw(ProfilerHistory, &bShowProfilerPanel);
+        }
+
         // ImGui 렌더링
-        ImGui::Render();
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        {
+        	PROFILE_SCOPE("ImGui Render");
+	        ImGui::Render();
+	        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        }
 
         // 현재 화면에 보여지는 버퍼와 그리기 작업을 위한 버퍼를 서로 교환
-        Renderer.SwapBuffer();
+        {
+        	PROFILE_SCOPE("Present");
+	        Renderer.SwapBuffer();
+        }
+
         // FPS 제한
-        double ElapsedTime;
-        do
         {
-            Sleep(0);
+        	PROFILE_SCOPE("FrameWait");
+	        FramePacer.WaitForNextFrame();
+        }
+    }
 
-            LARGE_INTEGER CurrentTime;
-            QueryPerformanceCounter(&CurrentTime);
+	Simulation.StopThread();
 
-            ElapsedTime = static_cast<double>(CurrentTime.QuadPart - StartTime.QuadPart) * 1000.0 / static_cast<double>(Frequency.QuadPart);
-        } while (ElapsedTime < TargetDeltaTime);
-    }
+	// 녹화와 재생이 같은 상태에 도달했는지 비교할 수 있도록 마지막 상태를 출력
+	if (bDeterministic)
+	{
+		if (!RecordPath.empty())
+		{
+			InputSystem::Get().StartRecording(nullptr);
+			const bool bSaved = InputRecording.Save(RecordPath);
+			std::cout << (bSaved ? "Saved " : "Failed to save ") << InputRecording.NumFrames() << " frames (" << InputRecording.NumEvents() << " events) to " << RecordPath.string() << '\n';
+		}
 
-	delete[] Balls;
+		std::cout << std::setprecision(9);
+		std::cout << "Simulation State Hash: " << std::hex << Simulation.GetStateHash() << std::dec << ", Steps: " << Simulation.GetStepCount() << '\n';
+		std::cout << "Camera Location: " << Camera->Location.X << ", " << Camera->Location.Y << ", " << Camera->Location.Z
+			<< " Rotation: " << Camera->Rotation.X << ", " << Camera->Rotation.Y << ", " << Camera->Rotation.Z << std::endl;
+	}
 
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
 
+	Renderer.ReleaseDeferredContexts();
+	Renderer.ReleasePrimitiveBuffers();
 	Renderer.ReleaseDepthStencilBuffer();
     Renderer.ReleaseConstantBuffer();
     Renderer.ReleaseShader();